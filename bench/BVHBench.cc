@@ -0,0 +1,80 @@
+#include "fabric/utils/BVH.hh"
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace fabric;
+
+namespace {
+
+constexpr float kWorldExtent = 1024.0f;
+
+// Chunk-sized boxes scattered over a square world, like streamed terrain
+void populate(BVH<int>& bvh, int count) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(0.0f, kWorldExtent);
+    std::uniform_real_distribution<float> height(0.0f, 64.0f);
+    for (int i = 0; i < count; ++i) {
+        Vec3f min(pos(rng), height(rng), pos(rng));
+        bvh.insert(AABB(min, Vec3f(min.x + 32.0f, min.y + 32.0f, min.z + 32.0f)), i);
+    }
+}
+
+// Axis-aligned box frustum covering about a tenth of the world
+Frustum boxFrustum() {
+    Frustum frustum;
+    frustum.planes = {{
+        {1.0f, 0.0f, 0.0f, -400.0f},
+        {-1.0f, 0.0f, 0.0f, 720.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f, 128.0f},
+        {0.0f, 0.0f, 1.0f, -400.0f},
+        {0.0f, 0.0f, -1.0f, 720.0f},
+    }};
+    return frustum;
+}
+
+} // namespace
+
+static void BM_BVHBuild(benchmark::State& state) {
+    BVH<int> bvh;
+    populate(bvh, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        bvh.build();
+        benchmark::ClobberMemory();
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BVHBuild)->RangeMultiplier(4)->Range(256, 16384)->Complexity()->Unit(benchmark::kMicrosecond);
+
+static void BM_BVHQueryAABB(benchmark::State& state) {
+    BVH<int> bvh;
+    populate(bvh, static_cast<int>(state.range(0)));
+    bvh.build();
+
+    AABB region(Vec3f(480.0f, 0.0f, 480.0f), Vec3f(544.0f, 64.0f, 544.0f));
+    size_t found = 0;
+    for (auto _ : state) {
+        auto results = bvh.query(region);
+        found = results.size();
+        benchmark::DoNotOptimize(results);
+    }
+    state.counters["results"] = static_cast<double>(found);
+}
+BENCHMARK(BM_BVHQueryAABB)->RangeMultiplier(4)->Range(256, 16384);
+
+static void BM_BVHQueryFrustum(benchmark::State& state) {
+    BVH<int> bvh;
+    populate(bvh, static_cast<int>(state.range(0)));
+    bvh.build();
+
+    auto frustum = boxFrustum();
+    size_t found = 0;
+    for (auto _ : state) {
+        auto results = bvh.queryFrustum(frustum);
+        found = results.size();
+        benchmark::DoNotOptimize(results);
+    }
+    state.counters["results"] = static_cast<double>(found);
+}
+BENCHMARK(BM_BVHQueryFrustum)->RangeMultiplier(4)->Range(256, 16384);
@@ -0,0 +1,18 @@
+#include "fabric/core/Log.hh"
+#include "fabric/utils/MemoryHeaps.hh"
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv) {
+    fabric::log::init();
+    // Heaps belong to the thread that creates them; benchmarks run on this one
+    fabric::MemoryHeaps::configure({});
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        fabric::log::shutdown();
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    fabric::log::shutdown();
+    return 0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "fabric/core/ChunkedGrid.hh"
+#include "fabric/core/Spatial.hh"
+
+#include <cmath>
+
+// Canonical voxel worlds shared by the benchmarks. Deterministic so runs on
+// different machines and commits mesh and trace the same geometry.
+
+namespace fabric::bench {
+
+using Essence = Vector4<float, Space::World>;
+
+// Rolling heightmap over a chunksX x chunksZ footprint, chunk row y = 0
+inline void fillTerrain(ChunkedGrid<float>& density, int chunksX, int chunksZ) {
+    for (int z = 0; z < chunksZ * kChunkSize; ++z) {
+        for (int x = 0; x < chunksX * kChunkSize; ++x) {
+            float h = 12.0f + 6.0f * std::sin(static_cast<float>(x) * 0.19f) * std::cos(static_cast<float>(z) * 0.13f);
+            int height = static_cast<int>(h);
+            for (int y = 0; y < height; ++y) {
+                density.set(x, y, z, 1.0f);
+            }
+        }
+    }
+}
+
+// Solid ball centred in chunk (0, 0, 0)
+inline void fillSphere(ChunkedGrid<float>& density, int radius) {
+    constexpr int kCenter = kChunkSize / 2;
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int y = 0; y < kChunkSize; ++y) {
+            for (int x = 0; x < kChunkSize; ++x) {
+                int dx = x - kCenter, dy = y - kCenter, dz = z - kCenter;
+                if (dx * dx + dy * dy + dz * dz <= radius * radius)
+                    density.set(x, y, z, 1.0f);
+            }
+        }
+    }
+}
+
+// Worst case for greedy meshing: every face exposed, nothing merges
+inline void fillCheckerboard(ChunkedGrid<float>& density) {
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int y = 0; y < kChunkSize; ++y) {
+            for (int x = 0; x < kChunkSize; ++x) {
+                if (((x + y + z) & 1) == 0)
+                    density.set(x, y, z, 1.0f);
+            }
+        }
+    }
+}
+
+// Two alternating materials in chunk (0, 0, 0) so the palette is exercised
+inline void fillEssence(ChunkedGrid<Essence>& essence) {
+    for (int z = 0; z < kChunkSize; ++z) {
+        for (int y = 0; y < kChunkSize; ++y) {
+            for (int x = 0; x < kChunkSize; ++x) {
+                bool stone = ((x / 4 + z / 4) & 1) != 0;
+                essence.set(x, y, z, stone ? Essence(0.5f, 0.5f, 0.5f, 1.0f) : Essence(0.2f, 0.6f, 0.2f, 1.0f));
+            }
+        }
+    }
+}
+
+} // namespace fabric::bench
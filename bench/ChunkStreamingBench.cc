@@ -0,0 +1,50 @@
+#include "fabric/core/ChunkStreaming.hh"
+#include <benchmark/benchmark.h>
+
+using namespace fabric;
+
+namespace {
+
+StreamingConfig benchConfig(int radius) {
+    StreamingConfig config;
+    config.baseRadius = radius;
+    config.maxRadius = radius;
+    config.maxLoadsPerTick = 64;
+    config.maxUnloadsPerTick = 64;
+    return config;
+}
+
+} // namespace
+
+// Standing still after the initial load: pure steady-state cost per tick
+static void BM_ChunkStreamingUpdateStationary(benchmark::State& state) {
+    ChunkStreamingManager manager(benchConfig(static_cast<int>(state.range(0))));
+    for (int i = 0; i < 10000; ++i) {
+        auto update = manager.update(0.0f, 0.0f, 0.0f, 0.0f);
+        if (update.toLoad.empty() && update.toUnload.empty())
+            break;
+    }
+
+    for (auto _ : state) {
+        auto update = manager.update(0.0f, 0.0f, 0.0f, 0.0f);
+        benchmark::DoNotOptimize(update);
+    }
+    state.counters["tracked"] = static_cast<double>(manager.trackedChunkCount());
+}
+BENCHMARK(BM_ChunkStreamingUpdateStationary)->Arg(4)->Arg(8)->Unit(benchmark::kMicrosecond);
+
+// Flying in a straight line at a few chunks per second
+static void BM_ChunkStreamingUpdateMoving(benchmark::State& state) {
+    ChunkStreamingManager manager(benchConfig(static_cast<int>(state.range(0))));
+    float x = 0.0f;
+    // Lists in frame memory, rewound every tick as in the main loop
+    FrameArenas::setEnabled(true);
+    for (auto _ : state) {
+        FrameArenas::advance();
+        x += 2.0f;
+        auto update = manager.update(x, 0.0f, 0.0f, 0.0f);
+        benchmark::DoNotOptimize(update);
+    }
+    FrameArenas::setEnabled(false);
+}
+BENCHMARK(BM_ChunkStreamingUpdateMoving)->Arg(4)->Arg(8)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,115 @@
+#include "fabric/core/ChunkedGrid.hh"
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+constexpr int kExtent = 2 * kChunkSize; // 2x2x2 chunks
+
+ChunkedGrid<float> makeFilledGrid() {
+    ChunkedGrid<float> grid;
+    for (int z = 0; z < kExtent; ++z)
+        for (int y = 0; y < kExtent; ++y)
+            for (int x = 0; x < kExtent; ++x)
+                grid.set(x, y, z, static_cast<float>((x ^ y ^ z) & 1));
+    return grid;
+}
+
+struct Coord {
+    int x, y, z;
+};
+
+std::vector<Coord> randomCoords(size_t count, int extent) {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> dist(0, extent - 1);
+    std::vector<Coord> coords(count);
+    for (auto& c : coords)
+        c = {dist(rng), dist(rng), dist(rng)};
+    return coords;
+}
+
+} // namespace
+
+static void BM_ChunkedGridSetSequential(benchmark::State& state) {
+    for (auto _ : state) {
+        ChunkedGrid<float> grid;
+        for (int z = 0; z < kChunkSize; ++z)
+            for (int y = 0; y < kChunkSize; ++y)
+                for (int x = 0; x < kChunkSize; ++x)
+                    grid.set(x, y, z, 1.0f);
+        benchmark::DoNotOptimize(grid);
+    }
+    state.SetItemsProcessed(state.iterations() * kChunkVolume);
+}
+BENCHMARK(BM_ChunkedGridSetSequential);
+
+static void BM_ChunkedGridGetSequential(benchmark::State& state) {
+    auto grid = makeFilledGrid();
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (int z = 0; z < kExtent; ++z)
+            for (int y = 0; y < kExtent; ++y)
+                for (int x = 0; x < kExtent; ++x)
+                    sum += grid.get(x, y, z);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kExtent * kExtent * kExtent);
+}
+BENCHMARK(BM_ChunkedGridGetSequential);
+
+static void BM_ChunkedGridGetRandom(benchmark::State& state) {
+    auto grid = makeFilledGrid();
+    auto coords = randomCoords(4096, kExtent);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& c : coords)
+            sum += grid.get(c.x, c.y, c.z);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(coords.size()));
+}
+BENCHMARK(BM_ChunkedGridGetRandom);
+
+static void BM_ChunkedGridSetRandom(benchmark::State& state) {
+    auto grid = makeFilledGrid();
+    auto coords = randomCoords(4096, kExtent);
+    for (auto _ : state) {
+        for (const auto& c : coords)
+            grid.set(c.x, c.y, c.z, 0.5f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(coords.size()));
+}
+BENCHMARK(BM_ChunkedGridSetRandom);
+
+static void BM_ChunkedGridGetMissing(benchmark::State& state) {
+    auto grid = makeFilledGrid();
+    auto coords = randomCoords(4096, kExtent);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& c : coords)
+            sum += grid.get(c.x + 1000, c.y, c.z);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(coords.size()));
+}
+BENCHMARK(BM_ChunkedGridGetMissing);
+
+static void BM_ChunkedGridNeighbors6(benchmark::State& state) {
+    auto grid = makeFilledGrid();
+    auto coords = randomCoords(4096, kExtent);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto& c : coords) {
+            auto n = grid.getNeighbors6(c.x, c.y, c.z);
+            sum += n[0] + n[5];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(coords.size()));
+}
+BENCHMARK(BM_ChunkedGridNeighbors6);
@@ -0,0 +1,96 @@
+#include "fabric/codec/Codec.hh"
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace fabric::codec;
+
+namespace {
+
+constexpr int kRecords = 1024;
+
+// A small mixed record, roughly a networked entity update
+void writeRecord(ByteWriter& w, int i) {
+    w.writeU32LE(static_cast<uint32_t>(i));
+    w.writeU16LE(static_cast<uint16_t>(i * 3));
+    w.writeI64LE(-static_cast<int64_t>(i) * 1000);
+    w.writeVarInt(static_cast<uint64_t>(i) * 37);
+    w.writeString("entity");
+}
+
+std::vector<uint8_t> encodeRecords() {
+    ByteWriter w;
+    for (int i = 0; i < kRecords; ++i)
+        writeRecord(w, i);
+    return w.data();
+}
+
+} // namespace
+
+static void BM_CodecWrite(benchmark::State& state) {
+    ByteWriter w(64 * kRecords);
+    for (auto _ : state) {
+        w.clear();
+        for (int i = 0; i < kRecords; ++i)
+            writeRecord(w, i);
+        benchmark::DoNotOptimize(w.data().data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(w.size()));
+}
+BENCHMARK(BM_CodecWrite);
+
+static void BM_CodecRead(benchmark::State& state) {
+    auto bytes = encodeRecords();
+    for (auto _ : state) {
+        ByteReader r(bytes.data(), bytes.size());
+        uint64_t sum = 0;
+        for (int i = 0; i < kRecords; ++i) {
+            sum += r.readU32LE();
+            sum += r.readU16LE();
+            sum += static_cast<uint64_t>(r.readI64LE());
+            sum += r.readVarInt();
+            sum += r.readString(6).size();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+BENCHMARK(BM_CodecRead);
+
+static void BM_CodecVarIntRoundTrip(benchmark::State& state) {
+    ByteWriter w(10 * kRecords);
+    for (auto _ : state) {
+        w.clear();
+        for (uint64_t v = 1; v < (uint64_t{1} << 40); v *= 3)
+            w.writeVarInt(v);
+        ByteReader r(w.data().data(), w.size());
+        uint64_t sum = 0;
+        while (r.remaining() > 0)
+            sum += r.readVarInt();
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_CodecVarIntRoundTrip);
+
+static void BM_CodecFrameDecode(benchmark::State& state) {
+    auto payload = encodeRecords();
+    std::vector<uint8_t> stream;
+    for (int i = 0; i < 16; ++i) {
+        auto frame = LengthDelimitedFrame::encode(std::span<const uint8_t>(payload.data(), payload.size() / 16));
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+
+    for (auto _ : state) {
+        std::span<const uint8_t> rest(stream);
+        size_t frames = 0;
+        size_t consumed = 0;
+        while (auto frame = LengthDelimitedFrame::tryDecode(rest, consumed)) {
+            rest = rest.subspan(consumed);
+            ++frames;
+        }
+        benchmark::DoNotOptimize(frames);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(stream.size()));
+}
+BENCHMARK(BM_CodecFrameDecode);
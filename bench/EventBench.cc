@@ -0,0 +1,49 @@
+#include "fabric/core/Event.hh"
+#include <benchmark/benchmark.h>
+
+using namespace fabric;
+
+static void BM_EventDispatch(benchmark::State& state) {
+    EventDispatcher dispatcher;
+    int calls = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        dispatcher.addEventListener("move_forward", [&calls](Event&) { ++calls; });
+    }
+
+    Event event("move_forward", "input");
+    for (auto _ : state) {
+        dispatcher.dispatchEvent(event);
+    }
+    benchmark::DoNotOptimize(calls);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventDispatch)->Arg(1)->Arg(8)->Arg(32);
+
+static void BM_EventDispatchNoListeners(benchmark::State& state) {
+    EventDispatcher dispatcher;
+    dispatcher.addEventListener("other", [](Event&) {});
+
+    Event event("move_forward", "input");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dispatcher.dispatchEvent(event));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventDispatchNoListeners);
+
+// Full cost of an input event as the engine produces one: construct, attach data, dispatch
+static void BM_EventCreateAndDispatch(benchmark::State& state) {
+    EventDispatcher dispatcher;
+    float total = 0.0f;
+    dispatcher.addEventListener("mouse_move", [&total](Event& e) { total += e.getData<float>("dx"); });
+
+    for (auto _ : state) {
+        Event event("mouse_move", "input");
+        event.setData("dx", 1.0f);
+        event.setData("dy", -1.0f);
+        dispatcher.dispatchEvent(event);
+    }
+    benchmark::DoNotOptimize(total);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventCreateAndDispatch);
@@ -0,0 +1,81 @@
+#include "fabric/core/SceneStream.hh"
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+// About 250 bytes of text JSON per record, so 400k records is a ~100 MB scene
+constexpr int kLargeScene = 400000;
+
+Scene makeScene(int count) {
+    Scene scene;
+    scene.entities.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        SceneRecord r;
+        r.name = "entity_" + std::to_string(i);
+        r.parent = i % 16 == 0 ? -1 : i - 1;
+        float f = static_cast<float>(i);
+        r.position = {f * 0.25f, f * -0.5f, f * 0.125f};
+        r.rotation = Quaternion<float>(0.1f, 0.2f, 0.3f, 0.927f);
+        r.scale = {1.0f + f * 0.001f, 1.0f, 1.0f};
+        scene.entities.push_back(std::move(r));
+    }
+    return scene;
+}
+
+// Encoded scenes are cached across benchmarks; building the 100 MB one takes seconds
+const std::vector<uint8_t>& sceneBytes(int count, JsonFormat format) {
+    static std::map<std::pair<int, JsonFormat>, std::vector<uint8_t>> cache;
+    auto& bytes = cache[{count, format}];
+    if (bytes.empty())
+        bytes = encodeJson(makeScene(count), format);
+    return bytes;
+}
+
+void streamBench(benchmark::State& state, JsonFormat format) {
+    const auto& bytes = sceneBytes(static_cast<int>(state.range(0)), format);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        size_t n = streamScene(bytes, format, [&](const SceneRecord& r) { sum += r.position.x; });
+        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+    state.counters["bytes"] = static_cast<double>(bytes.size());
+}
+
+} // namespace
+
+// Current path: parse text into a DOM, then convert through from_json
+static void BM_SceneLoadTextDom(benchmark::State& state) {
+    const auto& bytes = sceneBytes(static_cast<int>(state.range(0)), JsonFormat::Text);
+    for (auto _ : state) {
+        auto scene = decodeJson<Scene>(bytes, JsonFormat::Text);
+        benchmark::DoNotOptimize(scene.entities.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+    state.counters["bytes"] = static_cast<double>(bytes.size());
+}
+BENCHMARK(BM_SceneLoadTextDom)->Arg(1000)->Arg(kLargeScene)->Unit(benchmark::kMillisecond);
+
+static void BM_SceneLoadTextSax(benchmark::State& state) {
+    streamBench(state, JsonFormat::Text);
+}
+BENCHMARK(BM_SceneLoadTextSax)->Arg(1000)->Arg(kLargeScene)->Unit(benchmark::kMillisecond);
+
+static void BM_SceneLoadMessagePackSax(benchmark::State& state) {
+    streamBench(state, JsonFormat::MessagePack);
+}
+BENCHMARK(BM_SceneLoadMessagePackSax)->Arg(1000)->Arg(kLargeScene)->Unit(benchmark::kMillisecond);
+
+static void BM_SceneLoadCborSax(benchmark::State& state) {
+    streamBench(state, JsonFormat::Cbor);
+}
+BENCHMARK(BM_SceneLoadCborSax)->Arg(1000)->Arg(kLargeScene)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,42 @@
+#include "fabric/core/Simulation.hh"
+#include <benchmark/benchmark.h>
+
+using namespace fabric;
+
+// One tick over state.range(0) chunks with a settling rule that reads six
+// neighbours per cell, the shape of the falling-sand style rules
+static void BM_SimulationTick(benchmark::State& state) {
+    SimulationHarness sim;
+    int chunks = static_cast<int>(state.range(0));
+    for (int c = 0; c < chunks; ++c) {
+        int base = c * kChunkSize;
+        sim.density().fill(base, 0, 0, base + kChunkSize - 1, kChunkSize / 2, kChunkSize - 1, 1.0f);
+    }
+
+    sim.registerRule("settle", [](DensityField& d, EssenceField&, int x, int y, int z, double dt) {
+        auto n = d.grid().getNeighbors6(x, y, z);
+        float below = n[3];
+        float here = d.read(x, y, z);
+        if (here > 0.0f && below < 1.0f)
+            d.write(x, y, z, here - static_cast<float>(dt) * 0.01f);
+    });
+
+    for (auto _ : state) {
+        sim.tick(1.0 / 60.0);
+    }
+    state.SetItemsProcessed(state.iterations() * chunks * kChunkVolume);
+}
+BENCHMARK(BM_SimulationTick)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+
+// Overhead of the tick loop itself with a rule that does nothing
+static void BM_SimulationTickEmptyRule(benchmark::State& state) {
+    SimulationHarness sim;
+    sim.density().write(0, 0, 0, 1.0f);
+    sim.registerRule("noop", [](DensityField&, EssenceField&, int, int, int, double) {});
+
+    for (auto _ : state) {
+        sim.tick(1.0 / 60.0);
+    }
+    state.SetItemsProcessed(state.iterations() * kChunkVolume);
+}
+BENCHMARK(BM_SimulationTickEmptyRule)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,42 @@
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+using namespace fabric;
+
+// Submit a batch of trivial tasks and wait for all of them: queueing,
+// wakeup and future overhead, which dominates small chunk jobs
+static void BM_ThreadPoolSubmitThroughput(benchmark::State& state) {
+    Utils::ThreadPoolExecutor pool(static_cast<size_t>(state.range(0)));
+    constexpr int kBatch = 1024;
+    std::atomic<int> counter{0};
+    std::vector<std::future<void>> futures;
+    futures.reserve(kBatch);
+
+    for (auto _ : state) {
+        futures.clear();
+        for (int i = 0; i < kBatch; ++i) {
+            futures.push_back(pool.submit([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto& f : futures) {
+            f.wait();
+        }
+    }
+    benchmark::DoNotOptimize(counter.load());
+    state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK(BM_ThreadPoolSubmitThroughput)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+// Single task round trip: submit, run on a worker, get() the result
+static void BM_ThreadPoolRoundTrip(benchmark::State& state) {
+    Utils::ThreadPoolExecutor pool(2);
+    int value = 0;
+    for (auto _ : state) {
+        value = pool.submit([](int x) { return x + 1; }, value).get();
+    }
+    benchmark::DoNotOptimize(value);
+}
+BENCHMARK(BM_ThreadPoolRoundTrip)->UseRealTime();
@@ -0,0 +1,74 @@
+#include "fabric/core/Rendering.hh"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+struct Pose {
+    PreviousTransform prev;
+    Position pos;
+    Rotation rot;
+    Scale scl;
+};
+
+std::vector<Pose> makePoses(size_t count) {
+    std::vector<Pose> poses(count);
+    for (size_t i = 0; i < count; ++i) {
+        float f = static_cast<float>(i);
+        poses[i].prev = {{f, 0.0f, -f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+        poses[i].pos = {f + 0.1f, 0.05f, -f};
+        poses[i].rot = {0.0f, 0.0998f, 0.0f, 0.995f};
+        poses[i].scl = {1.0f, 1.0f, 1.0f};
+    }
+    return poses;
+}
+
+} // namespace
+
+// One Transform pair at a time: slerp plus a Transform matrix rebuild per entity
+static void BM_InterpolatePerEntity(benchmark::State& state) {
+    auto poses = makePoses(static_cast<size_t>(state.range(0)));
+    std::vector<RenderTransform> out(poses.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < poses.size(); ++i) {
+            const auto& p = poses[i];
+            Transform<float> prev, current;
+            prev.setPosition(Vector3<float, Space::World>(p.prev.position.x, p.prev.position.y, p.prev.position.z));
+            prev.setRotation(
+                Quaternion<float>(p.prev.rotation.x, p.prev.rotation.y, p.prev.rotation.z, p.prev.rotation.w));
+            current.setPosition(Vector3<float, Space::World>(p.pos.x, p.pos.y, p.pos.z));
+            current.setRotation(Quaternion<float>(p.rot.x, p.rot.y, p.rot.z, p.rot.w));
+            out[i].matrix = TransformInterpolator::interpolate(prev, current, 0.5f).getMatrix().elements;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InterpolatePerEntity)->Arg(1024)->Arg(65536)->Unit(benchmark::kMicrosecond);
+
+// The interpolation systems' path: gather into SoA lanes, then batched lerp/nlerp
+static void BM_InterpolateBatch(benchmark::State& state) {
+    auto poses = makePoses(static_cast<size_t>(state.range(0)));
+    std::vector<RenderTransform> out(poses.size());
+    TransformBatch batch;
+    for (auto _ : state) {
+        for (size_t begin = 0; begin < poses.size(); begin += TransformBatch::kSliceSize) {
+            size_t n = std::min(TransformBatch::kSliceSize, poses.size() - begin);
+            batch.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                const auto& p = poses[begin + i];
+                batch.setPrevious(i, p.prev);
+                batch.setCurrent(i, p.pos, p.rot, p.scl);
+            }
+            batch.interpolate(0.5f, std::span<RenderTransform>(out).subspan(begin, n));
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InterpolateBatch)->Arg(1024)->Arg(65536)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,161 @@
+#include "BenchWorlds.hh"
+#include "fabric/core/VoxelLight.hh"
+#include "fabric/core/VoxelMesher.hh"
+#include "fabric/core/VoxelRaycast.hh"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace fabric;
+using namespace fabric::bench;
+
+namespace {
+
+enum World : int {
+    kTerrain = 0,
+    kSphere = 1,
+    kCheckerboard = 2
+};
+
+const char* worldName(int world) {
+    switch (world) {
+        case kTerrain:
+            return "terrain";
+        case kSphere:
+            return "sphere";
+        default:
+            return "checkerboard";
+    }
+}
+
+} // namespace
+
+static void BM_VoxelMesherMeshChunkData(benchmark::State& state) {
+    ChunkedGrid<float> density;
+    ChunkedGrid<Essence> essence;
+    switch (state.range(0)) {
+        case kTerrain:
+            fillTerrain(density, 2, 2);
+            break;
+        case kSphere:
+            fillSphere(density, 14);
+            break;
+        default:
+            fillCheckerboard(density);
+    }
+    fillEssence(essence);
+
+    size_t quads = 0;
+    for (auto _ : state) {
+        auto data = VoxelMesher::meshChunkData(0, 0, 0, density, essence);
+        quads = data.vertices.size() / 4;
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetLabel(worldName(static_cast<int>(state.range(0))));
+    state.counters["quads"] = static_cast<double>(quads);
+    state.SetItemsProcessed(state.iterations() * kChunkVolume);
+}
+BENCHMARK(BM_VoxelMesherMeshChunkData)->Arg(kTerrain)->Arg(kSphere)->Arg(kCheckerboard)->Unit(benchmark::kMicrosecond);
+
+static void BM_CastRayDown(benchmark::State& state) {
+    ChunkedGrid<float> density;
+    fillTerrain(density, 4, 4);
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(0.0f, 4.0f * kChunkSize);
+    std::vector<std::pair<float, float>> origins(1024);
+    for (auto& o : origins)
+        o = {dist(rng), dist(rng)};
+
+    size_t hits = 0;
+    for (auto _ : state) {
+        hits = 0;
+        for (auto [x, z] : origins) {
+            if (castRay(density, x, 40.0f, z, 0.0f, -1.0f, 0.0f))
+                ++hits;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(origins.size());
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(origins.size()));
+}
+BENCHMARK(BM_CastRayDown);
+
+// Long grazing rays across chunk boundaries, the player look-at case
+static void BM_CastRayGrazing(benchmark::State& state) {
+    ChunkedGrid<float> density;
+    fillTerrain(density, 4, 4);
+
+    std::vector<std::array<float, 3>> dirs(256);
+    for (size_t i = 0; i < dirs.size(); ++i) {
+        float angle = static_cast<float>(i) * 0.0245f;
+        float dx = std::cos(angle), dz = std::sin(angle), dy = -0.08f;
+        float len = std::sqrt(dx * dx + dy * dy + dz * dz);
+        dirs[i] = {dx / len, dy / len, dz / len};
+    }
+
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (const auto& d : dirs) {
+            if (castRay(density, 2.0f, 24.0f, 2.0f, d[0], d[1], d[2], 180.0f))
+                ++hits;
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+BENCHMARK(BM_CastRayGrazing);
+
+// Light from scratch for a 4x4 chunk terrain: every chunk added, one propagate
+static void BM_VoxelLightFull(benchmark::State& state) {
+    ChunkedGrid<float> density;
+    fillTerrain(density, 4, 4);
+    Utils::ThreadPoolExecutor pool(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        VoxelLighting lighting(density, 0.5f, state.range(0) > 0 ? &pool : nullptr);
+        for (int cz = 0; cz < 4; ++cz)
+            for (int cx = 0; cx < 4; ++cx)
+                lighting.addChunk(cx, 0, cz);
+        lighting.propagate();
+        benchmark::DoNotOptimize(lighting.lastChangedCells());
+    }
+    state.counters["threads"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_VoxelLightFull)->Arg(0)->Arg(4)->Unit(benchmark::kMillisecond);
+
+// Place and remove one voxel floating over the terrain, shading the column
+// under it: the incremental update the full pass above replaces
+static void BM_VoxelLightEdit(benchmark::State& state) {
+    ChunkedGrid<float> density;
+    fillTerrain(density, 4, 4);
+    VoxelLighting lighting(density);
+    for (int cz = 0; cz < 4; ++cz)
+        for (int cx = 0; cx < 4; ++cx)
+            lighting.addChunk(cx, 0, cz);
+    lighting.propagate();
+
+    // Six cells above the surface of a column in the middle of the terrain
+    constexpr int kX = 2 * kChunkSize + 5;
+    constexpr int kZ = 2 * kChunkSize + 7;
+    int y = kChunkSize - 1;
+    while (y > 0 && density.get(kX, y, kZ) <= 0.5f)
+        --y;
+    y = std::min(y + 6, kChunkSize - 1);
+
+    size_t cells = 0;
+    for (auto _ : state) {
+        float value = density.get(kX, y, kZ) > 0.5f ? 0.0f : 1.0f;
+        density.set(kX, y, kZ, value);
+        lighting.voxelChanged(kX, y, kZ);
+        benchmark::DoNotOptimize(lighting.propagate());
+        cells = lighting.lastChangedCells();
+    }
+    state.counters["cells"] = static_cast<double>(cells);
+}
+BENCHMARK(BM_VoxelLightEdit)->Unit(benchmark::kMicrosecond);
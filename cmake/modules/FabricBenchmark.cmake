@@ -0,0 +1,14 @@
+# FabricBenchmark.cmake - Fetch and configure Google Benchmark
+
+CPMAddPackage(
+    NAME benchmark
+    GITHUB_REPOSITORY google/benchmark
+    GIT_TAG v1.9.4
+    OPTIONS
+        "BENCHMARK_ENABLE_TESTING OFF"
+        "BENCHMARK_ENABLE_GTEST_TESTS OFF"
+        "BENCHMARK_ENABLE_INSTALL OFF"
+        "BENCHMARK_ENABLE_WERROR OFF"
+    SYSTEM
+    EXCLUDE_FROM_ALL
+)
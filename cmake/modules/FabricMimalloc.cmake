@@ -1,5 +1,14 @@
 # FabricMimalloc.cmake - Fetch and configure mimalloc
 
+# With FABRIC_TRACK_ALLOCATIONS the engine's AllocationHooks.cc defines
+# operator new/delete (forwarding to mi_malloc); mimalloc's own C++ and
+# malloc override must be off or the symbols collide.
+if(FABRIC_TRACK_ALLOCATIONS)
+    set(FABRIC_MI_OVERRIDE OFF)
+else()
+    set(FABRIC_MI_OVERRIDE ON)
+endif()
+
 CPMAddPackage(
     NAME mimalloc
     GITHUB_REPOSITORY microsoft/mimalloc
@@ -9,7 +18,7 @@ CPMAddPackage(
         "MI_BUILD_STATIC ON"
         "MI_BUILD_OBJECT OFF"
         "MI_BUILD_TESTS OFF"
-        "MI_OVERRIDE ON"
+        "MI_OVERRIDE ${FABRIC_MI_OVERRIDE}"
         "MI_SECURE OFF"
         "MI_PADDING OFF"
         "MI_INSTALL_TOPLEVEL OFF"
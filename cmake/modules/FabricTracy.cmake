@@ -1,6 +1,11 @@
 # FabricTracy.cmake - Fetch and configure Tracy Profiler
 
 option(FABRIC_ENABLE_PROFILING "Enable Tracy profiler instrumentation" OFF)
+option(FABRIC_ENABLE_BUILTIN_PROFILER "Enable built-in ring buffer profiler with Chrome trace export" OFF)
+
+if(FABRIC_ENABLE_PROFILING AND FABRIC_ENABLE_BUILTIN_PROFILER)
+    message(FATAL_ERROR "FABRIC_ENABLE_PROFILING and FABRIC_ENABLE_BUILTIN_PROFILER are mutually exclusive")
+endif()
 
 if(FABRIC_ENABLE_PROFILING)
     CPMAddPackage(
@@ -16,10 +21,13 @@ if(FABRIC_ENABLE_PROFILING)
     )
 endif()
 
-# Convenience function: link Tracy to a target (no-op when profiling is disabled)
+# Convenience function: link Tracy to a target (no-op when profiling is disabled).
+# The built-in profiler is compiled into FabricLib and only needs the define.
 function(fabric_link_tracy TARGET)
     if(FABRIC_ENABLE_PROFILING)
         target_link_libraries(${TARGET} PUBLIC Tracy::TracyClient)
         target_compile_definitions(${TARGET} PUBLIC FABRIC_PROFILING_ENABLED)
+    elseif(FABRIC_ENABLE_BUILTIN_PROFILER)
+        target_compile_definitions(${TARGET} PUBLIC FABRIC_BUILTIN_PROFILER_ENABLED)
     endif()
 endfunction()
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace fabric {
@@ -19,6 +20,8 @@ enum class CharacterState : uint8_t {
     Boosting
 };
 
+inline constexpr size_t kCharacterStateCount = static_cast<size_t>(CharacterState::Boosting) + 1;
+
 // ECS components (POD structs for Flecs)
 
 struct Velocity {
@@ -3,6 +3,7 @@
 #include "fabric/core/ChunkStreaming.hh"
 #include "fabric/core/Event.hh"
 #include "fabric/core/VoxelMesher.hh"
+#include "fabric/utils/Metrics.hh"
 
 #include <unordered_map>
 #include <unordered_set>
@@ -14,6 +15,11 @@ inline constexpr const char* kVoxelChangedEvent = "voxel_changed";
 struct ChunkMeshConfig {
     int maxRemeshPerTick = 4;
     float threshold = 0.5f;
+    // Mesh buffers; null uses the MemoryHeap::Mesh heap
+    std::pmr::memory_resource* resource = nullptr;
+    // Per-vertex light (VoxelLighting::light()); null meshes everything at
+    // full sky. Mark the chunks VoxelLighting::propagate() returns dirty.
+    const ChunkedGrid<uint8_t>* light = nullptr;
 };
 
 class ChunkMeshManager {
@@ -28,11 +34,18 @@ class ChunkMeshManager {
     // Process dirty chunks up to per-tick budget. Returns number of chunks re-meshed.
     int update();
 
+    // Drop the mesh and any pending re-mesh for a chunk that streamed out
+    void removeChunk(int cx, int cy, int cz);
+
     const ChunkMeshData* meshFor(const ChunkCoord& coord) const;
     bool isDirty(const ChunkCoord& coord) const;
     size_t dirtyCount() const;
     size_t meshCount() const;
 
+    // Publish dirty/mesh counts and remesh latency. Removed on destruction, so
+    // the registry must outlive this manager.
+    void registerMetrics(MetricsRegistry& registry);
+
     // Emit a voxel_changed event (convenience for callers who modify grids)
     static void emitVoxelChanged(EventDispatcher& dispatcher, int cx, int cy, int cz);
 
@@ -41,10 +54,14 @@ class ChunkMeshManager {
     const ChunkedGrid<float>& density_;
     const ChunkedGrid<Vector4<float, Space::World>>& essence_;
     ChunkMeshConfig config_;
+    std::pmr::memory_resource* meshResource_;
     std::string handlerId_;
 
     std::unordered_set<ChunkCoord, ChunkCoordHash> dirty_;
     std::unordered_map<ChunkCoord, ChunkMeshData, ChunkCoordHash> meshes_;
+
+    MetricsRegistry* metrics_ = nullptr;
+    Histogram* remeshTime_ = nullptr;
 };
 
 } // namespace fabric
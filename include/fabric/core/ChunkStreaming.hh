@@ -1,9 +1,12 @@
 #pragma once
 
 #include "fabric/core/ChunkedGrid.hh"
+#include "fabric/utils/FrameArena.hh"
+#include "fabric/utils/Metrics.hh"
 
 #include <algorithm>
 #include <cmath>
+#include <memory_resource>
 #include <unordered_set>
 #include <vector>
 
@@ -31,14 +34,18 @@ struct ChunkCoordHash {
     }
 };
 
+// Lists live in the calling thread's frame arena when frame memory is
+// enabled (see FrameArenas): read them this frame or the next, and copy
+// anything that must persist
 struct StreamingUpdate {
-    std::vector<ChunkCoord> toLoad;
-    std::vector<ChunkCoord> toUnload;
+    std::pmr::vector<ChunkCoord> toLoad{FrameArenas::resource()};
+    std::pmr::vector<ChunkCoord> toUnload{FrameArenas::resource()};
 };
 
 class ChunkStreamingManager {
   public:
     explicit ChunkStreamingManager(const StreamingConfig& config = {});
+    ~ChunkStreamingManager();
 
     StreamingUpdate update(float viewX, float viewY, float viewZ, float speed);
 
@@ -46,10 +53,21 @@ class ChunkStreamingManager {
     size_t trackedChunkCount() const;
     const StreamingConfig& config() const;
 
+    // Publish tracked chunk count, radius and update latency. Removed on
+    // destruction, so the registry must outlive this manager.
+    void registerMetrics(MetricsRegistry& registry);
+
   private:
     StreamingConfig config_;
     int currentRadius_ = 0;
     std::unordered_set<ChunkCoord, ChunkCoordHash> tracked_;
+
+    // Candidate lists reused across updates so a stationary view does not allocate
+    std::vector<ChunkCoord> loadScratch_;
+    std::vector<ChunkCoord> unloadScratch_;
+
+    MetricsRegistry* metrics_ = nullptr;
+    Histogram* updateTime_ = nullptr;
 };
 
 } // namespace fabric
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "fabric/utils/MemoryHeaps.hh"
+
 #include <array>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <tuple>
 #include <vector>
 
@@ -15,8 +18,12 @@ inline constexpr int kChunkShift = 5;
 inline constexpr int kChunkMask = kChunkSize - 1;
 inline constexpr int kChunkVolume = kChunkSize * kChunkSize * kChunkSize;
 
+// Chunk arrays come from resource, by default the ChunkStorage heap
 template <typename T> class ChunkedGrid {
   public:
+    explicit ChunkedGrid(std::pmr::memory_resource* resource = nullptr)
+        : resource_(resource ? resource : MemoryHeaps::resource(MemoryHeap::ChunkStorage)) {}
+
     // C++20 arithmetic right shift gives floor division for power-of-2
     static void worldToChunk(int wx, int wy, int wz, int& cx, int& cy, int& cz, int& lx, int& ly, int& lz) {
         cx = wx >> kChunkShift;
@@ -40,21 +47,45 @@ template <typename T> class ChunkedGrid {
     void set(int x, int y, int z, const T& value) {
         int cx, cy, cz, lx, ly, lz;
         worldToChunk(x, y, z, cx, cy, cz, lx, ly, lz);
-        auto key = packKey(cx, cy, cz);
-        auto& chunk = chunks_[key];
-        if (!chunk) {
-            chunk = std::make_unique<std::array<T, kChunkVolume>>();
-            chunk->fill(T{});
-        }
-        (*chunk)[localIndex(lx, ly, lz)] = value;
+        ensureChunk(cx, cy, cz)[localIndex(lx, ly, lz)] = value;
     }
 
     bool hasChunk(int cx, int cy, int cz) const { return chunks_.contains(packKey(cx, cy, cz)); }
 
     void removeChunk(int cx, int cy, int cz) { chunks_.erase(packKey(cx, cy, cz)); }
 
+    void clear() { chunks_.clear(); }
+
+    // kChunkVolume cells, x fastest then y then z. The chunk is created
+    // filled with T{} if it does not exist.
+    T* ensureChunk(int cx, int cy, int cz) {
+        auto& chunk = chunks_[packKey(cx, cy, cz)];
+        if (!chunk) {
+            chunk = ChunkPtr(std::pmr::polymorphic_allocator<Chunk>(resource_).template new_object<Chunk>(),
+                             ChunkDeleter{resource_});
+            chunk->fill(T{});
+        }
+        return chunk->data();
+    }
+
+    // Null if the chunk does not exist
+    const T* chunkData(int cx, int cy, int cz) const {
+        auto it = chunks_.find(packKey(cx, cy, cz));
+        return it == chunks_.end() ? nullptr : it->second->data();
+    }
+
     size_t chunkCount() const { return chunks_.size(); }
 
+    // Forget every chunk without returning its memory. Only for use right
+    // before the backing heap is released wholesale (MemoryHeaps::release).
+    void abandonChunks() {
+        for (auto& [_, chunk] : chunks_)
+            static_cast<void>(chunk.release());
+        chunks_.clear();
+    }
+
+    std::pmr::memory_resource* resource() const { return resource_; }
+
     std::vector<std::tuple<int, int, int>> activeChunks() const {
         std::vector<std::tuple<int, int, int>> result;
         result.reserve(chunks_.size());
@@ -97,7 +128,16 @@ template <typename T> class ChunkedGrid {
     }
 
   private:
-    std::map<int64_t, std::unique_ptr<std::array<T, kChunkVolume>>> chunks_;
+    using Chunk = std::array<T, kChunkVolume>;
+
+    struct ChunkDeleter {
+        std::pmr::memory_resource* resource;
+        void operator()(Chunk* chunk) const { std::pmr::polymorphic_allocator<Chunk>(resource).delete_object(chunk); }
+    };
+    using ChunkPtr = std::unique_ptr<Chunk, ChunkDeleter>;
+
+    std::pmr::memory_resource* resource_;
+    std::map<int64_t, ChunkPtr> chunks_;
 
     static int64_t packKey(int cx, int cy, int cz) {
         return (static_cast<int64_t>(cx) << 42) | (static_cast<int64_t>(cy & 0x1FFFFF) << 21) |
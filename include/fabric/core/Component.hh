@@ -1,16 +1,62 @@
 #pragma once
 
+#include "fabric/utils/ErrorHandling.hh"
+#include <algorithm>
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
 namespace fabric {
 
-/// Base component class. Provides lifecycle methods, property storage, and child management.
+class Component;
+
+using PropertyId = uint32_t;
+
+/**
+ * @brief Interned property name
+ *
+ * Names are interned once in a process-wide registry and components store
+ * and compare only the resulting id. Declare keys once, for example
+ * `static const PropertyKey kWidth("width");`, and pass them instead of
+ * strings on hot paths. Interning and lookup are thread-safe: each thread
+ * caches the ids it has resolved, so only a thread's first sight of a name
+ * takes the registry's shared lock, and only a new name takes it exclusively.
+ */
+class PropertyKey {
+  public:
+    explicit PropertyKey(std::string_view name) : id_(intern(name)) {}
+
+    PropertyId id() const { return id_; }
+    const std::string& name() const { return nameOf(id_); }
+
+    bool operator==(const PropertyKey&) const = default;
+
+    static PropertyId intern(std::string_view name);
+    // Id of an already interned name, without registering it
+    static std::optional<PropertyId> find(std::string_view name);
+    static const std::string& nameOf(PropertyId id);
+
+  private:
+    PropertyId id_;
+};
+
+/**
+ * @brief Base component class
+ *
+ * Provides lifecycle methods, property storage, and child management.
+ * Properties live in a small array sorted by interned id and children are
+ * indexed by id, so lookups neither lock nor compare strings. Components
+ * are not thread-safe: a component and its subtree must be used from one
+ * thread at a time, and callers sharing one across threads synchronize
+ * around it themselves. Only PropertyKey is safe to use concurrently.
+ */
 class Component {
   public:
     /**
@@ -21,6 +67,11 @@ class Component {
      */
     using PropertyValue = std::variant<bool, int, float, double, std::string, std::shared_ptr<Component>>;
 
+    template <typename T>
+    static constexpr bool kIsPropertyType =
+        std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double> ||
+        std::is_same_v<T, std::string> || std::is_same_v<T, std::shared_ptr<Component>>;
+
     /**
      * @brief Component constructor
      *
@@ -74,25 +125,51 @@ class Component {
      * @brief Set a property value
      *
      * @tparam T Type of the property value (must be one of the types in PropertyValue)
-     * @param name Property name
+     * @param key Interned property key
      * @param value Property value
      */
-    template <typename T> void setProperty(const std::string& name, const T& value);
+    template <typename T> void setProperty(PropertyKey key, const T& value);
+
+    /**
+     * @brief Set a property value by name, interning the name on first use
+     */
+    template <typename T> void setProperty(const std::string& name, const T& value) {
+        setProperty<T>(PropertyKey(name), value);
+    }
 
     /**
      * @brief Get a property value
      *
      * @tparam T Expected type of the property value
-     * @param name Property name
+     * @param key Interned property key
      * @return Property value
      * @throws FabricException if property doesn't exist or is wrong type
      */
+    template <typename T> T getProperty(PropertyKey key) const;
+
+    /**
+     * @brief Get a property value by name
+     *
+     * @throws FabricException if property doesn't exist or is wrong type
+     */
     template <typename T> T getProperty(const std::string& name) const;
 
+    /**
+     * @brief Non-throwing lookup
+     *
+     * @return Pointer to the stored value, or null if the property is missing
+     *         or holds another type. Valid until the property set changes.
+     */
+    template <typename T> const T* findProperty(PropertyKey key) const;
+
+    bool hasProperty(PropertyKey key) const;
     bool hasProperty(const std::string& name) const;
 
+    bool removeProperty(PropertyKey key);
     bool removeProperty(const std::string& name);
 
+    size_t propertyCount() const { return properties.size(); }
+
     /**
      * @brief Add a child component
      *
@@ -107,13 +184,79 @@ class Component {
 
     std::vector<std::shared_ptr<Component>> getChildren() const;
 
+    const std::vector<std::shared_ptr<Component>>& children() const { return childList; }
+
+    /**
+     * @brief Process-wide counter bumped whenever any child list changes
+     *
+     * Lets caches of tree structure (see ComponentScheduler) detect edits
+     * without walking the tree.
+     */
+    static uint64_t structureEpoch();
+
   private:
+    using PropertyEntry = std::pair<PropertyId, PropertyValue>;
+
+    const PropertyValue* findValue(PropertyId key) const;
+    bool eraseValue(PropertyId key);
+    [[noreturn]] void throwMissingProperty(PropertyId key) const;
+    [[noreturn]] void throwWrongPropertyType(PropertyId key) const;
+
     std::string id;
-    mutable std::mutex propertiesMutex; // Mutex for thread-safe property access
-    std::unordered_map<std::string, PropertyValue> properties;
+    std::vector<PropertyEntry> properties; // Sorted by id
 
-    mutable std::mutex childrenMutex; // Mutex for thread-safe children access
-    std::vector<std::shared_ptr<Component>> children;
+    std::vector<std::shared_ptr<Component>> childList;
+    // Child id -> position in childList; keys view the children's own ids
+    std::unordered_map<std::string_view, size_t> childIndex;
 };
 
+inline const Component::PropertyValue* Component::findValue(PropertyId key) const {
+    auto it = std::lower_bound(properties.begin(), properties.end(), key,
+                               [](const PropertyEntry& entry, PropertyId k) { return entry.first < k; });
+    return it != properties.end() && it->first == key ? &it->second : nullptr;
+}
+
+template <typename T> void Component::setProperty(PropertyKey key, const T& value) {
+    static_assert(kIsPropertyType<T>, "Property type not supported. Must be one of the types in PropertyValue.");
+
+    auto it = std::lower_bound(properties.begin(), properties.end(), key.id(),
+                               [](const PropertyEntry& entry, PropertyId k) { return entry.first < k; });
+    if (it != properties.end() && it->first == key.id())
+        it->second = value;
+    else
+        properties.emplace(it, key.id(), value);
+}
+
+template <typename T> T Component::getProperty(PropertyKey key) const {
+    static_assert(kIsPropertyType<T>, "Property type not supported. Must be one of the types in PropertyValue.");
+
+    const PropertyValue* value = findValue(key.id());
+    if (!value)
+        throwMissingProperty(key.id());
+    if (const T* typed = std::get_if<T>(value))
+        return *typed;
+    throwWrongPropertyType(key.id());
+}
+
+template <typename T> T Component::getProperty(const std::string& name) const {
+    static_assert(kIsPropertyType<T>, "Property type not supported. Must be one of the types in PropertyValue.");
+
+    auto key = PropertyKey::find(name);
+    if (!key)
+        throwError("Property '" + name + "' not found in component '" + id + "'");
+    const PropertyValue* value = findValue(*key);
+    if (!value)
+        throwMissingProperty(*key);
+    if (const T* typed = std::get_if<T>(value))
+        return *typed;
+    throwWrongPropertyType(*key);
+}
+
+template <typename T> const T* Component::findProperty(PropertyKey key) const {
+    static_assert(kIsPropertyType<T>, "Property type not supported. Must be one of the types in PropertyValue.");
+
+    const PropertyValue* value = findValue(key.id());
+    return value ? std::get_if<T>(value) : nullptr;
+}
+
 } // namespace fabric
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "fabric/core/Component.hh"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fabric {
+
+namespace Utils {
+class ThreadPoolExecutor;
+}
+
+/**
+ * @brief Updates a component tree from a flattened, cached node array
+ *
+ * The tree is flattened in pre-order into an array of update records that is
+ * rebuilt only when some component's child list changes. Each update walks
+ * the array with plain pointers, so no shared_ptr is copied per node.
+ *
+ * Subtrees larger than the grain are split: their root joins a serial spine
+ * that runs first, and their children become candidates themselves. The
+ * remaining subtrees are contiguous ranges of the array and run in parallel
+ * on the worker pool, with the calling thread helping. A parent always
+ * updates before its children; siblings in different ranges may update
+ * concurrently and in any order, so update() must touch only the node's own
+ * state and must not add or remove children.
+ */
+class ComponentScheduler {
+  public:
+    static constexpr size_t kDefaultMinRangeSize = 64;
+
+    /**
+     * @param root Tree to update; may be null
+     * @param workers Pool for parallel ranges; null updates everything on the calling thread
+     */
+    explicit ComponentScheduler(std::shared_ptr<Component> root = nullptr,
+                                Utils::ThreadPoolExecutor* workers = nullptr);
+
+    void setRoot(std::shared_ptr<Component> root);
+    const std::shared_ptr<Component>& getRoot() const { return root_; }
+
+    void setWorkers(Utils::ThreadPoolExecutor* workers);
+
+    /**
+     * @brief Smallest subtree worth handing to another thread
+     *
+     * The effective grain also scales with tree size so each worker gets a
+     * few ranges to balance against.
+     */
+    void setMinRangeSize(size_t nodes);
+
+    /**
+     * @brief Update every component in the tree
+     *
+     * Rebuilds the flattened array first if the tree structure changed.
+     * Exceptions from update() propagate after all ranges have finished.
+     */
+    void update(float deltaTime);
+
+    /// Flatten the tree now instead of on the next update
+    void rebuild();
+
+    size_t nodeCount() const { return records_.size(); }
+    size_t serialCount() const { return spine_.size(); }
+    size_t rangeCount() const { return ranges_.size(); }
+    uint64_t rebuildCount() const { return rebuildCount_; }
+
+  private:
+    struct UpdateRecord {
+        Component* node;
+        uint32_t subtreeEnd; // One past the last descendant
+    };
+
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    void partition(uint32_t index, uint32_t grain);
+    void runRange(Range range, float deltaTime) const;
+
+    std::shared_ptr<Component> root_;
+    Utils::ThreadPoolExecutor* workers_;
+    size_t minRangeSize_ = kDefaultMinRangeSize;
+
+    std::vector<UpdateRecord> records_;
+    // Holds the flattened nodes so records never dangle between rebuilds
+    std::vector<std::shared_ptr<Component>> keepAlive_;
+    std::vector<uint32_t> spine_;
+    std::vector<Range> ranges_;
+
+    uint64_t builtEpoch_ = 0;
+    bool dirty_ = true;
+    uint64_t rebuildCount_ = 0;
+};
+
+} // namespace fabric
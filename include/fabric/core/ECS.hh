@@ -1,8 +1,15 @@
 #pragma once
 
+#include "fabric/core/EntityCommands.hh"
+
 #include <flecs.h>
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace fabric {
 
@@ -25,11 +32,35 @@ struct BoundingBox {
     float maxX, maxY, maxZ;
 };
 
+// World-space AABB of BoundingBox under LocalToWorld (or BoundingBox itself
+// without one). Derived data: maintained by updateWorldBounds(), never set directly.
+struct WorldBounds {
+    float minX, minY, minZ;
+    float maxX, maxY, maxZ;
+};
+
 // World-space transform matrix, updated by CASCADE system from Position/Rotation/Scale hierarchy
 struct LocalToWorld {
     std::array<float, 16> matrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
 };
 
+// Local transform at the start of the latest fixed step, captured by
+// World::runFrame before every Simulation step; Position, Rotation and Scale
+// hold the state after it. Seeded from them when added, and brings a
+// RenderTransform along. Add to entities that move in Simulation.
+struct PreviousTransform {
+    Position position{0.0f, 0.0f, 0.0f};
+    Rotation rotation{0.0f, 0.0f, 0.0f, 1.0f};
+    Scale scale{1.0f, 1.0f, 1.0f};
+};
+
+// World matrix at render time: PreviousTransform and the current transform
+// blended by World::fixedStepAlpha(), written in RenderExtraction. SceneView
+// draws it instead of LocalToWorld; simulation code never reads it.
+struct RenderTransform {
+    std::array<float, 16> matrix = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+};
+
 // Tag component for entities that are part of the scene graph
 struct SceneEntity {};
 
@@ -38,6 +69,25 @@ struct Renderable {
     uint64_t sortKey;
 };
 
+// Engine phases, run in this order by World::runFrame. Place a system with
+// world.system<...>().kind<phase::Transforms>(). They are not Flecs builtin
+// phases, so flecs::world::progress() never runs them on its own; systems
+// in the builtin phases (OnUpdate by default) run between Simulation and
+// Transforms.
+namespace phase {
+struct Input {};            // Poll devices and route input
+struct Simulation {};       // Fixed-step gameplay, zero or more times per frame
+struct Transforms {};       // Position, Rotation, Scale -> LocalToWorld
+struct Bounds {};           // BoundingBox, LocalToWorld -> WorldBounds
+struct Culling {};          // Per-view visibility
+struct RenderExtraction {}; // Draw lists for submission
+} // namespace phase
+
+struct SystemTiming {
+    std::string name;
+    double seconds = 0.0; // Total time spent in the system since enableSystemStats()
+};
+
 // Flecs world wrapper with RAII lifecycle management
 class World {
   public:
@@ -55,12 +105,52 @@ class World {
     // Advance the world by deltaTime (runs all registered systems)
     bool progress(float deltaTime = 0.0f);
 
-    // Register Position, Rotation, Scale, BoundingBox, LocalToWorld, SceneEntity, Renderable
+    // Register Position, Rotation, Scale, BoundingBox, WorldBounds, LocalToWorld, PreviousTransform,
+    // RenderTransform, SceneEntity, Renderable
     void registerCoreComponents();
 
     // Propagate Position/Rotation/Scale through ChildOf hierarchy into LocalToWorld
     void updateTransforms();
 
+    // See fabric::updateWorldBounds
+    void updateWorldBounds();
+
+    // Create one pipeline per engine phase and register the engine systems:
+    // root and child transforms (CASCADE order), the WorldBounds systems and
+    // render-rate interpolation (multithreaded for roots), which runs first in
+    // RenderExtraction. Call once, after registerCoreComponents().
+    //
+    // Transforms and bounds are only recomputed for tables whose inputs
+    // changed (Flecs change detection), so a static scene costs nothing per
+    // frame. Write Position, Rotation and Scale through set() or a system
+    // field; a raw pointer write without modified() goes unnoticed. Flecs
+    // only reports table changes to plain query iterators, so the transform
+    // and bounds systems run on the calling thread, not on Flecs workers.
+    void registerEnginePipeline(double fixedDt = 1.0 / 60.0);
+
+    // Flecs worker threads for systems marked multi_threaded(); the others
+    // stay on the thread calling runFrame. 0 or 1 runs everything there.
+    void setThreads(int32_t threads);
+
+    // Command buffers submitted from worker threads; runFrame() flushes them
+    // before Input, flushCommands() anywhere else on the world's thread
+    EntityCommandQueue& commands() { return *commands_; }
+    size_t flushCommands();
+
+    // One frame: submitted commands, Input, Simulation once per whole fixed
+    // step accumulated, the builtin Flecs phases, then Transforms, Bounds,
+    // Culling and RenderExtraction. Returns the number of fixed steps run.
+    int runFrame(double deltaTime);
+
+    // Fraction of a fixed step left over after the last runFrame
+    double fixedStepAlpha() const { return fixedDt_ > 0.0 ? accumulator_ / fixedDt_ : 0.0; }
+    double fixedDt() const { return fixedDt_; }
+
+    // Measure time per system and import the Flecs stats addon, so the same
+    // numbers also reach the Flecs explorer
+    void enableSystemStats();
+    std::vector<SystemTiming> systemTimings() const;
+
     // Create a scene entity with Position + Rotation + Scale + LocalToWorld + SceneEntity tag
     flecs::entity createSceneEntity(const char* name = nullptr);
 
@@ -68,7 +158,20 @@ class World {
     flecs::entity createChildEntity(flecs::entity parent, const char* name = nullptr);
 
   private:
+    static constexpr size_t kPhaseCount = 6;
+
     flecs::world* world_;
+    std::unique_ptr<EntityCommandQueue> commands_;
+    std::array<flecs::entity_t, kPhaseCount> pipelines_{}; // One per phase, in run order
+    flecs::entity_t snapshotTransforms_ = 0;               // PreviousTransform capture
+    double fixedDt_ = 0.0;
+    double accumulator_ = 0.0;
 };
 
+// Give every entity with a BoundingBox a WorldBounds and recompute it for
+// tables whose BoundingBox or LocalToWorld changed since the previous call
+// (Flecs change detection), so static entities cost nothing after their
+// first update. Runs as two phase-less systems created on first use.
+void updateWorldBounds(flecs::world& world);
+
 } // namespace fabric
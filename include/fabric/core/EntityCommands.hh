@@ -0,0 +1,141 @@
+#pragma once
+
+#include "fabric/utils/FrameArena.hh"
+
+#include <flecs.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fabric {
+
+// Target of a recorded command: an entity that already exists, or one
+// created earlier in the same buffer (resolved when the buffer is applied)
+struct DeferredEntity {
+    static constexpr uint32_t kExisting = UINT32_MAX;
+
+    flecs::entity_t id = 0;
+    uint32_t pending = kExisting;
+
+    DeferredEntity() = default;
+    DeferredEntity(flecs::entity_t entity) : id(entity) {}
+    DeferredEntity(flecs::entity entity) : id(entity.id()) {}
+
+    bool isPending() const { return pending != kExisting; }
+};
+
+// Records entity create/destroy/set/add/remove/child_of on any thread
+// without touching the Flecs world. Component values and names are copied
+// into a buffer-owned arena; component ids are resolved only when the
+// buffer is applied, so recording never registers anything. One buffer
+// belongs to one job at a time and is not thread-safe.
+class EntityCommandBuffer {
+  public:
+    static constexpr size_t kArenaCapacity = size_t{64} << 10;
+
+    explicit EntityCommandBuffer(uint64_t sortKey = 0);
+    ~EntityCommandBuffer();
+
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    // Merge order key: EntityCommandQueue applies buffers by ascending key
+    uint64_t sortKey() const { return sortKey_; }
+    void setSortKey(uint64_t key) { sortKey_ = key; }
+
+    DeferredEntity create(const char* name = nullptr);
+    void destroy(DeferredEntity target);
+    void childOf(DeferredEntity target, DeferredEntity parent);
+
+    template <typename T> void set(DeferredEntity target, T value) {
+        static_assert(std::is_move_constructible_v<T>, "Deferred components must be move constructible");
+        void* payload = arena_.allocate(sizeof(T), alignof(T));
+        new (payload) T(std::move(value));
+        Command cmd{Op::Set, target};
+        cmd.payload = payload;
+        cmd.apply = [](flecs::entity e, void* p) { e.set<T>(std::move(*static_cast<T*>(p))); };
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            cmd.drop = [](void* p) { static_cast<T*>(p)->~T(); };
+        commands_.push_back(cmd);
+    }
+
+    template <typename T> void add(DeferredEntity target) {
+        Command cmd{Op::Add, target};
+        cmd.apply = [](flecs::entity e, void*) { e.add<T>(); };
+        commands_.push_back(cmd);
+    }
+
+    template <typename T> void remove(DeferredEntity target) {
+        Command cmd{Op::Remove, target};
+        cmd.apply = [](flecs::entity e, void*) { e.remove<T>(); };
+        commands_.push_back(cmd);
+    }
+
+    size_t size() const { return commands_.size(); }
+    bool empty() const { return commands_.empty(); }
+
+    // Replay the commands in recording order on the world's thread. Entities
+    // created by this buffer are returned in create() order. Commands aimed
+    // at entities that are no longer alive are dropped; replayed, if given,
+    // receives the number that were not. Clears the buffer.
+    std::vector<flecs::entity> apply(flecs::world& world, size_t* replayed = nullptr);
+
+    // Drop everything recorded and rewind the arena
+    void clear();
+
+  private:
+    enum class Op : uint8_t { Create, Destroy, ChildOf, Set, Add, Remove };
+
+    struct Command {
+        Op op;
+        DeferredEntity target;
+        DeferredEntity parent{};
+        const char* name = nullptr;
+        void* payload = nullptr;
+        void (*apply)(flecs::entity, void*) = nullptr;
+        void (*drop)(void*) = nullptr;
+    };
+
+    uint64_t sortKey_;
+    uint32_t created_ = 0;
+    std::vector<Command> commands_;
+    FrameArena arena_;
+};
+
+// Collects command buffers filled on worker threads and merges them at a
+// sync point. Workers acquire() a buffer per job, record into it and
+// submit() it; flush() on the world's thread applies every submitted buffer
+// by ascending sortKey inside one Flecs defer block, so the result does not
+// depend on which thread finished first. Give each job a distinct key (chunk
+// coordinate, request sequence); equal keys keep submission order.
+class EntityCommandQueue {
+  public:
+    EntityCommandQueue() = default;
+
+    EntityCommandQueue(const EntityCommandQueue&) = delete;
+    EntityCommandQueue& operator=(const EntityCommandQueue&) = delete;
+
+    // Thread-safe. Buffers are recycled, so their arenas stay warm.
+    std::unique_ptr<EntityCommandBuffer> acquire(uint64_t sortKey = 0);
+    void submit(std::unique_ptr<EntityCommandBuffer> buffer);
+
+    // World thread only. Returns the number of commands applied, leaving out
+    // those dropped because their target was no longer alive. Buffers are
+    // recycled and the defer block closed even if a command throws.
+    size_t flush(flecs::world& world);
+
+    size_t pendingBuffers() const;
+
+  private:
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<EntityCommandBuffer>> submitted_;
+    std::vector<std::unique_ptr<EntityCommandBuffer>> free_;
+};
+
+} // namespace fabric
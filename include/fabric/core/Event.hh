@@ -6,6 +6,7 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -80,6 +81,9 @@ class EventDispatcher {
 
     bool dispatchEvent(Event& event);
 
+    // Total dispatchEvent() calls, including events nobody listens to
+    uint64_t dispatchedCount() const;
+
   private:
     struct HandlerEntry {
         std::string id;
@@ -87,8 +91,13 @@ class EventDispatcher {
         int32_t priority = 0;
     };
 
+    using HandlerList = std::vector<HandlerEntry>;
+
+    // Copy-on-write: add/remove publish a new list, dispatch only bumps a
+    // refcount, so a dispatch with registered listeners does not allocate
     mutable std::mutex listenersMutex;
-    std::unordered_map<std::string, std::vector<HandlerEntry>> listeners;
+    std::unordered_map<std::string, std::shared_ptr<const HandlerList>> listeners;
+    std::atomic<uint64_t> dispatched{0};
 };
 
 } // namespace fabric
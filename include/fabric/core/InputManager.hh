@@ -2,24 +2,69 @@
 
 #include "fabric/core/Event.hh"
 #include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
 #include <SDL3/SDL.h>
+#include <span>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 namespace fabric {
 
+namespace codec {
+class ByteReader;
+class ByteWriter;
+} // namespace codec
+
+using ActionId = uint16_t;
+
+inline constexpr size_t kMaxInputActions = 128;
+using ActionSet = std::bitset<kMaxInputActions>;
+
+// Action and mouse state for one frame, compact enough to record every frame
+// or send every tick. Wire format: varint action count, then the active,
+// pressed and released bits packed into ceil(count / 8) bytes each, mouse
+// deltas as f32 LE and a u8 mouse button mask.
+struct InputStateFrame {
+    uint16_t actionCount = 0;
+    ActionSet active;
+    ActionSet pressed;  // Went down during the frame
+    ActionSet released; // Went up during the frame
+    float mouseDeltaX = 0, mouseDeltaY = 0;
+    uint8_t mouseButtons = 0; // Bit n is SDL button n + 1
+
+    bool operator==(const InputStateFrame&) const = default;
+
+    void encode(codec::ByteWriter& out) const;
+    // Throws FabricException on truncated data or an out-of-range count
+    static InputStateFrame decode(codec::ByteReader& in);
+
+    std::vector<uint8_t> serialize() const;
+    static InputStateFrame deserialize(std::span<const uint8_t> data);
+};
+
 // Translates SDL3 events into Fabric EventDispatcher actions.
-// Standalone; no main loop wiring yet.
+// Actions are interned to small integer ids on first bind; held state is a
+// bitset, so polling by ActionId is a bit test. The string overloads look the
+// id up and are kept for convenience off hot paths.
 class InputManager {
   public:
     InputManager();
     explicit InputManager(EventDispatcher& dispatcher);
 
-    // Bind an action name to an SDL keycode
-    void bindKey(const std::string& action, SDL_Keycode key);
+    // Bind an action name to an SDL keycode, interning the action
+    ActionId bindKey(const std::string& action, SDL_Keycode key);
     void unbindKey(const std::string& action);
 
+    // Id for an action name, interning it if new. Throws FabricException once
+    // kMaxInputActions names exist.
+    ActionId actionId(const std::string& action);
+    std::optional<ActionId> findAction(const std::string& action) const;
+    const std::string& actionName(ActionId id) const;
+    size_t actionCount() const { return actions_.size(); }
+
     // Process a single SDL event. Returns true if consumed.
     bool processEvent(const SDL_Event& event);
 
@@ -30,16 +75,40 @@ class InputManager {
     float mouseDeltaY() const;
     bool mouseButton(int button) const;
 
-    // Reset per-frame deltas (call at start of frame)
+    // Reset per-frame deltas and edges, and snapshot held actions as the
+    // previous frame's state (call once per frame)
     void beginFrame();
 
     // Query if action is currently active (key held)
+    bool isActionActive(ActionId action) const { return active_.test(action); }
     bool isActionActive(const std::string& action) const;
 
+    // Edges since the last beginFrame(); a tap inside one frame reports both
+    bool wasActionPressed(ActionId action) const { return pressed_.test(action); }
+    bool wasActionReleased(ActionId action) const { return released_.test(action); }
+
+    const ActionSet& activeActions() const { return active_; }
+    const ActionSet& previousActions() const { return previous_; }
+
+    // Snapshot this frame's state, or overwrite it from a recorded or remote
+    // frame. applyFrame() sets state directly and dispatches no events.
+    InputStateFrame captureFrame() const;
+    void applyFrame(const InputStateFrame& frame);
+
   private:
+    struct ActionInfo {
+        std::string name;
+        std::string releasedName; // Event type sent on key up
+    };
+
     EventDispatcher* dispatcher_ = nullptr;
-    std::unordered_map<SDL_Keycode, std::string> keyBindings_;
-    std::unordered_set<std::string> activeActions_;
+    std::vector<ActionInfo> actions_;
+    std::unordered_map<std::string, ActionId> actionIds_;
+    std::unordered_map<SDL_Keycode, ActionId> keyBindings_;
+    ActionSet active_;
+    ActionSet previous_;
+    ActionSet pressed_;
+    ActionSet released_;
     float mouseX_ = 0, mouseY_ = 0;
     float mouseDeltaX_ = 0, mouseDeltaY_ = 0;
     std::array<bool, 5> mouseButtons_ = {};
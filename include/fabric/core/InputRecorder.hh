@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <SDL3/SDL.h>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace fabric {
+
+enum class InputSampleType : uint8_t {
+    KeyDown,
+    KeyUp,
+    MouseMotion,
+    MouseButtonDown,
+    MouseButtonUp,
+    Quit
+};
+
+// One input event reduced to the fields InputManager and InputRouter consume
+struct InputSample {
+    InputSampleType type = InputSampleType::KeyDown;
+    uint8_t button = 0;
+    uint16_t mod = 0;
+    uint32_t key = 0;
+    float x = 0, y = 0;
+    float dx = 0, dy = 0;
+
+    bool operator==(const InputSample&) const = default;
+
+    // Events the game never reads (window, text, wheel, key repeat) map to nullopt
+    static std::optional<InputSample> fromEvent(const SDL_Event& event);
+    SDL_Event toEvent() const;
+};
+
+// Everything polled in one frame, plus that frame's wall time. Replaying the
+// dt sequence through the fixed-step accumulator reproduces the same ticks.
+struct InputFrame {
+    uint64_t dtNs = 0;
+    std::vector<InputSample> samples;
+};
+
+// A recorded session. Binary .finput format: "FINP" magic, u32 version,
+// varint frame count, then per frame a varint dt and varint sample count.
+struct InputRecording {
+    static constexpr uint32_t kFileVersion = 1;
+
+    std::vector<InputFrame> frames;
+
+    std::vector<uint8_t> serialize() const;
+
+    // Throws FabricException on a bad magic, unknown version or truncated data
+    static InputRecording deserialize(std::span<const uint8_t> data);
+
+    bool save(const std::string& path) const;
+    static std::optional<InputRecording> load(const std::string& path);
+
+    double durationSeconds() const;
+    size_t sampleCount() const;
+};
+
+// Captures the events a frame loop feeds to InputRouter, one InputFrame per
+// beginFrame() call.
+class InputRecorder {
+  public:
+    void beginFrame(double dtSeconds);
+    void record(const SDL_Event& event);
+
+    const InputRecording& recording() const { return recording_; }
+    size_t frameCount() const { return recording_.frames.size(); }
+    bool save(const std::string& path) const { return recording_.save(path); }
+
+  private:
+    InputRecording recording_;
+};
+
+// Plays a recording back frame by frame as synthesized SDL events
+class InputReplayer {
+  public:
+    using EventSink = std::function<void(const SDL_Event&)>;
+
+    explicit InputReplayer(InputRecording recording);
+
+    // Emit the next frame's events to sink and return its recorded dt in
+    // seconds. Returns 0 once the recording is exhausted.
+    double nextFrame(const EventSink& sink);
+
+    bool finished() const { return next_ >= recording_.frames.size(); }
+    size_t frameIndex() const { return next_; }
+    size_t frameCount() const { return recording_.frames.size(); }
+    void rewind() { next_ = 0; }
+
+  private:
+    InputRecording recording_;
+    size_t next_ = 0;
+};
+
+} // namespace fabric
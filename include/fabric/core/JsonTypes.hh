@@ -1,13 +1,70 @@
 #pragma once
 
 #include "fabric/core/Spatial.hh"
+#include <cstdint>
 #include <nlohmann/json.hpp>
+#include <span>
+#include <vector>
 
 // ADL-visible to_json/from_json for core Fabric spatial types.
 // Enables: nlohmann::json j = myVec3; auto v = j.get<Vector3<float>>();
+// The same serializers drive the binary encodings below, so anything with
+// to_json/from_json can also travel as MessagePack or CBOR.
 
 namespace fabric {
 
+enum class JsonFormat : uint8_t {
+    Text,
+    MessagePack,
+    Cbor
+};
+
+inline nlohmann::json::input_format_t saxInputFormat(JsonFormat format) {
+    switch (format) {
+        case JsonFormat::MessagePack:
+            return nlohmann::json::input_format_t::msgpack;
+        case JsonFormat::Cbor:
+            return nlohmann::json::input_format_t::cbor;
+        case JsonFormat::Text:
+            break;
+    }
+    return nlohmann::json::input_format_t::json;
+}
+
+// Encode through the value's to_json. Text is compact UTF-8 JSON.
+template <typename T> std::vector<uint8_t> encodeJson(const T& value, JsonFormat format) {
+    nlohmann::json j = value;
+    switch (format) {
+        case JsonFormat::MessagePack:
+            return nlohmann::json::to_msgpack(j);
+        case JsonFormat::Cbor:
+            return nlohmann::json::to_cbor(j);
+        case JsonFormat::Text:
+            break;
+    }
+    auto text = j.dump();
+    return {text.begin(), text.end()};
+}
+
+// Decode through the value's from_json; throws nlohmann::json::exception on malformed input
+template <typename T> T decodeJson(std::span<const uint8_t> bytes, JsonFormat format) {
+    switch (format) {
+        case JsonFormat::MessagePack:
+            return nlohmann::json::from_msgpack(bytes.begin(), bytes.end()).template get<T>();
+        case JsonFormat::Cbor:
+            return nlohmann::json::from_cbor(bytes.begin(), bytes.end()).template get<T>();
+        case JsonFormat::Text:
+            break;
+    }
+    return nlohmann::json::parse(bytes.begin(), bytes.end()).template get<T>();
+}
+
+// Stream bytes into a nlohmann::json_sax handler without building a DOM.
+// Returns false if the input is malformed or the handler stopped early.
+template <typename Sax> bool parseJsonSax(std::span<const uint8_t> bytes, JsonFormat format, Sax& sax) {
+    return nlohmann::json::sax_parse(bytes.begin(), bytes.end(), &sax, saxInputFormat(format));
+}
+
 // --- Vector2 ---
 
 template <typename T, typename SpaceTag> void to_json(nlohmann::json& j, const Vector2<T, SpaceTag>& v) {
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "fabric/utils/Metrics.hh"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace asio {
+class io_context;
+} // namespace asio
+
+namespace fabric {
+
+// Minimal HTTP/1.1 endpoint serving a MetricsRegistry in the Prometheus text
+// format at GET /metrics. Runs on an Asio io_context, by default the engine's
+// async::context(), so scrapes are handled inside fabric::async::poll() on the
+// main thread. One request per connection; the connection closes after the
+// response.
+class MetricsServer {
+  public:
+    static constexpr uint16_t kDefaultPort = 9464;
+    static constexpr size_t kMaxRequestBytes = 8192;
+
+    explicit MetricsServer(MetricsRegistry& registry);
+    MetricsServer(MetricsRegistry& registry, asio::io_context& context);
+    ~MetricsServer();
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    // Bind and start accepting. Loopback unless told otherwise; port 0 picks
+    // an ephemeral port (see port()). Returns false if the bind fails.
+    bool start(const std::string& address = "127.0.0.1", uint16_t port = kDefaultPort);
+    void stop();
+
+    bool running() const;
+    uint16_t port() const;
+    uint64_t requestCount() const;
+
+    // Full HTTP response for a raw request head
+    static std::string buildResponse(std::string_view request, const MetricsRegistry& registry);
+
+    // Opaque; shared with in-flight connections so they outlive stop()
+    struct State;
+
+  private:
+    MetricsRegistry& registry_;
+    asio::io_context& context_;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace fabric
@@ -2,27 +2,56 @@
 
 #include "fabric/core/CharacterTypes.hh"
 #include "fabric/core/StateMachine.hh"
-#include <memory>
 #include <string>
+#include <type_traits>
 
 namespace fabric {
 
+// Sprint 5b active transitions: Grounded, Falling, Jumping, Flying, Dashing, Boosting
+inline constexpr TransitionTable<CharacterState, kCharacterStateCount> kMovementTransitions{
+    {CharacterState::Grounded, CharacterState::Jumping},  {CharacterState::Grounded, CharacterState::Falling},
+    {CharacterState::Grounded, CharacterState::Flying},   {CharacterState::Grounded, CharacterState::Dashing},
+    {CharacterState::Jumping, CharacterState::Falling},   {CharacterState::Jumping, CharacterState::Flying},
+    {CharacterState::Falling, CharacterState::Grounded},  {CharacterState::Falling, CharacterState::Flying},
+    {CharacterState::Flying, CharacterState::Falling},    {CharacterState::Flying, CharacterState::Grounded},
+    {CharacterState::Flying, CharacterState::Boosting},   {CharacterState::Dashing, CharacterState::Grounded},
+    {CharacterState::Dashing, CharacterState::Falling},   {CharacterState::Boosting, CharacterState::Flying},
+    {CharacterState::Boosting, CharacterState::Falling},
+};
+
+// Per-character movement state; trivially copyable, usable as a Flecs component
+using MovementState = FixedStateMachine<kMovementTransitions>;
+
 class MovementFSM {
   public:
-    MovementFSM();
+    MovementFSM() : state_(CharacterState::Grounded) {}
 
     bool tryTransition(CharacterState target);
-    CharacterState currentState() const;
-
-    bool isGrounded() const;
-    bool isAirborne() const;
-    bool isFlying() const;
-    bool canDash() const;
+    CharacterState currentState() const { return state_.state; }
+    const MovementState& state() const { return state_; }
+
+    bool isGrounded() const { return isGrounded(state_.state); }
+    bool isAirborne() const { return isAirborne(state_.state); }
+    bool isFlying() const { return isFlying(state_.state); }
+    bool canDash() const { return canDash(state_.state); }
+
+    static constexpr bool isGrounded(CharacterState s) { return s == CharacterState::Grounded; }
+    static constexpr bool isAirborne(CharacterState s) {
+        return s == CharacterState::Jumping || s == CharacterState::Falling;
+    }
+    static constexpr bool isFlying(CharacterState s) {
+        return s == CharacterState::Flying || s == CharacterState::Boosting;
+    }
+    static constexpr bool canDash(CharacterState s) { return s == CharacterState::Grounded; }
 
     static std::string stateToString(CharacterState state);
 
   private:
-    std::unique_ptr<StateMachine<CharacterState>> sm_;
+    MovementState state_;
 };
 
+static_assert(std::is_trivially_copyable_v<MovementState>);
+static_assert(kMovementTransitions.allows(CharacterState::Grounded, CharacterState::Jumping));
+static_assert(!kMovementTransitions.allows(CharacterState::Grounded, CharacterState::Ragdoll));
+
 } // namespace fabric
@@ -5,17 +5,37 @@
 #include <functional>
 #include <optional>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace fabric {
 
 // Ordered middleware chain with context passing and short-circuit support.
 // Handlers are sorted by priority (lower runs first; stable within equal priority).
-// Each handler receives the context and a next() function. Calling next()
+// Each handler receives the context and a next() callable. Calling next()
 // proceeds to the next handler; skipping it short-circuits the pipeline.
+//
+// Handlers are sorted in place once and re-sorted only after they change,
+// so a copy is a plain copy of the entries. next is a Next value (pipeline,
+// context and index), so an execution makes no allocations; handlers written against
+// std::function<void()> still work but pay for the conversion.
 template <typename Context> class Pipeline {
   public:
-    using Handler = std::function<void(Context&, std::function<void()> next)>;
+    class Next {
+      public:
+        void operator()() const { pipeline_->executeAt(index_, *ctx_); }
+
+      private:
+        friend class Pipeline;
+        Next(const Pipeline* pipeline, Context* ctx, size_t index) : pipeline_(pipeline), ctx_(ctx), index_(index) {}
+
+        const Pipeline* pipeline_;
+        Context* ctx_;
+        size_t index_;
+    };
+
+    using Handler = std::function<void(Context&, Next next)>;
 
     void addHandler(Handler handler, int priority = 0) {
         entries_.push_back(Entry{"", std::move(handler), priority, insertOrder_++});
@@ -36,8 +56,20 @@ template <typename Context> class Pipeline {
         return true;
     }
 
+    // Sort and flatten now so the first execute() after a change doesn't
+    void compile() {
+        if (!dirty_)
+            return;
+        std::stable_sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+            if (a.priority != b.priority)
+                return a.priority < b.priority;
+            return a.order < b.order;
+        });
+        dirty_ = false;
+    }
+
     void execute(Context& ctx) {
-        ensureSorted();
+        compile();
         executeAt(0, ctx);
     }
 
@@ -51,27 +83,53 @@ template <typename Context> class Pipeline {
         size_t order; // insertion order for stable sorting
     };
 
-    void ensureSorted() {
-        if (!dirty_)
-            return;
-        std::stable_sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
-            if (a.priority != b.priority)
-                return a.priority < b.priority;
-            return a.order < b.order;
-        });
-        dirty_ = false;
-    }
-
-    void executeAt(size_t index, Context& ctx) {
+    void executeAt(size_t index, Context& ctx) const {
         if (index >= entries_.size())
             return;
-        auto& entry = entries_[index];
-        entry.handler(ctx, [this, index, &ctx]() { executeAt(index + 1, ctx); });
+        entries_[index].handler(ctx, Next(this, &ctx, index + 1));
     }
 
-    std::vector<Entry> entries_;
+    std::vector<Entry> entries_; // Run order once compiled
     size_t insertOrder_ = 0;
     bool dirty_ = false;
 };
 
+// Pipeline whose handlers are fixed at compile time. Handlers run in the
+// order given; each receives the context and a next() whose type names the
+// following stage, so the whole chain can inline into one call with no
+// type erasure. Build with makeStaticPipeline<Context>(handlers...).
+template <typename Context, typename... Handlers> class StaticPipeline {
+  public:
+    template <size_t I> class Next {
+      public:
+        void operator()() const { pipeline_->template executeAt<I>(*ctx_); }
+
+      private:
+        friend class StaticPipeline;
+        Next(const StaticPipeline* pipeline, Context* ctx) : pipeline_(pipeline), ctx_(ctx) {}
+
+        const StaticPipeline* pipeline_;
+        Context* ctx_;
+    };
+
+    explicit StaticPipeline(Handlers... handlers) : handlers_(std::move(handlers)...) {}
+
+    void execute(Context& ctx) const { executeAt<0>(ctx); }
+
+    static constexpr size_t handlerCount() { return sizeof...(Handlers); }
+
+  private:
+    template <size_t I> void executeAt(Context& ctx) const {
+        if constexpr (I < sizeof...(Handlers))
+            std::get<I>(handlers_)(ctx, Next<I + 1>(this, &ctx));
+    }
+
+    std::tuple<Handlers...> handlers_;
+};
+
+template <typename Context, typename... Handlers>
+StaticPipeline<Context, std::decay_t<Handlers>...> makeStaticPipeline(Handlers&&... handlers) {
+    return StaticPipeline<Context, std::decay_t<Handlers>...>(std::forward<Handlers>(handlers)...);
+}
+
 } // namespace fabric
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fabric/core/Component.hh"
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -10,6 +11,10 @@
 
 namespace fabric {
 
+namespace Utils {
+class ThreadPoolExecutor;
+}
+
 /**
  * @brief Interface for plugins in the Fabric framework
  *
@@ -51,6 +56,15 @@ class Plugin {
      */
     virtual std::string getDescription() const = 0;
 
+    /**
+     * @brief Get the names of plugins this plugin depends on
+     *
+     * Dependencies are initialized before this plugin and shut down after it.
+     *
+     * @return Registered names of required plugins
+     */
+    virtual std::vector<std::string> getDependencies() const { return {}; }
+
     /**
      * @brief Initialize the plugin
      *
@@ -71,6 +85,17 @@ class Plugin {
     virtual std::vector<std::shared_ptr<Component>> getComponents() = 0;
 };
 
+/**
+ * @brief Outcome and timing of one plugin's initialize()
+ */
+struct PluginInitTiming {
+    std::string name;
+    bool success = false;
+    bool skipped = false;              // Not run because a dependency failed or is missing
+    std::chrono::nanoseconds start{0}; // Offset from the start of initializeAll()
+    std::chrono::nanoseconds duration{0};
+};
+
 /**
  * @brief Plugin factory function type
  */
@@ -130,27 +155,47 @@ class PluginManager {
     std::unordered_map<std::string, std::shared_ptr<Plugin>> getPlugins() const;
 
     /**
-     * @brief Initialize all loaded plugins
+     * @brief Initialize all loaded plugins in dependency order
      *
+     * A plugin starts once all of its dependencies have initialized. With a
+     * worker pool, plugins whose dependencies are satisfied initialize
+     * concurrently on it; without one they run in topological order on the
+     * calling thread. Plugins whose dependencies fail or are not loaded are
+     * skipped. A dependency cycle fails before anything is initialized.
+     *
+     * @param workers Pool for concurrent initialization; null initializes on the calling thread
      * @return true if all plugins initialized successfully, false otherwise
      */
-    bool initializeAll();
+    bool initializeAll(Utils::ThreadPoolExecutor* workers = nullptr);
 
     /**
      * @brief Shut down all loaded plugins
      *
-     * This method shuts down plugins in reverse dependency order
-     * to ensure proper cleanup.
+     * Plugins shut down in reverse dependency order, so every plugin shuts
+     * down before the plugins it depends on.
      */
     void shutdownAll();
 
+    /**
+     * @brief Timings from the last initializeAll(), in completion order
+     */
+    std::vector<PluginInitTiming> getInitTimings() const;
+
     PluginManager(const PluginManager&) = delete;
     PluginManager& operator=(const PluginManager&) = delete;
 
   private:
+    using PluginList = std::vector<std::pair<std::string, std::shared_ptr<Plugin>>>;
+
+    // Loaded plugins sorted into dependency order. Throws FabricException on
+    // a cycle; missing dependencies are reported through `missing`.
+    static PluginList dependencyOrder(PluginList plugins, std::vector<std::vector<size_t>>* dependents,
+                                      std::vector<size_t>* dependencyCounts, std::vector<bool>* missing);
+
     mutable std::mutex pluginMutex;
     std::unordered_map<std::string, PluginFactory> pluginFactories;
     std::unordered_map<std::string, std::shared_ptr<Plugin>> loadedPlugins;
+    std::vector<PluginInitTiming> initTimings;
 };
 
 /**
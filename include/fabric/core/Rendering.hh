@@ -1,10 +1,13 @@
 #pragma once
 
+#include "fabric/core/ECS.hh"
 #include "fabric/core/Spatial.hh"
 #include <algorithm>
 #include <array>
 #include <cstdint>
 #include <flecs.h>
+#include <memory_resource>
+#include <span>
 #include <vector>
 
 namespace fabric {
@@ -67,16 +70,21 @@ struct DrawCall {
 // Sorted collection of draw calls per view
 class RenderList {
   public:
+    // Null resource uses the global default
+    explicit RenderList(std::pmr::memory_resource* resource = nullptr)
+        : drawCalls_(resource ? resource : std::pmr::get_default_resource()) {}
+
     void addDrawCall(const DrawCall& call);
     void sortByKey();
     void clear();
+    void reserve(size_t count);
 
-    const std::vector<DrawCall>& drawCalls() const;
+    const std::pmr::vector<DrawCall>& drawCalls() const;
     size_t size() const;
     bool empty() const;
 
   private:
-    std::vector<DrawCall> drawCalls_;
+    std::pmr::vector<DrawCall> drawCalls_;
 };
 
 // Transform interpolation using slerp (rotation) + lerp (position, scale)
@@ -84,12 +92,50 @@ struct TransformInterpolator {
     static Transform<float> interpolate(const Transform<float>& prev, const Transform<float>& current, float alpha);
 };
 
+// Many transform pairs interpolated at once, laid out as one float array per
+// component (structure of arrays) so lerp, nlerp and matrix assembly are
+// plain loops the compiler vectorizes. Rotation uses nlerp: between two fixed
+// steps the arc is small and nlerp stays within a fraction of a degree of
+// slerp without acos/sin. Reuse one batch; resize() keeps its capacity.
+class TransformBatch {
+  public:
+    // Entities per batch that keep all twenty lanes in L1; larger tables are
+    // fed in slices of this size
+    static constexpr size_t kSliceSize = 256;
+
+    void resize(size_t count);
+    size_t size() const { return count_; }
+
+    void setPrevious(size_t i, const PreviousTransform& prev);
+    void setCurrent(size_t i, const Position& pos, const Rotation& rot, const Scale& scl);
+
+    // Blend previous toward current by alpha and write T * R * S into out
+    // (column-major, same layout as Transform::getMatrix). out.size() >= size().
+    void interpolate(float alpha, std::span<RenderTransform> out);
+
+  private:
+    enum Lane : size_t { kPx, kPy, kPz, kRx, kRy, kRz, kRw, kSx, kSy, kSz, kLaneCount };
+
+    float* previous(Lane lane) { return data_.data() + lane * count_; }
+    float* current(Lane lane) { return data_.data() + (kLaneCount + lane) * count_; }
+
+    std::vector<float> data_;
+    size_t count_ = 0;
+};
+
 // Frustum-cull scene entities against a view-projection matrix.
-// Iterates entities with SceneEntity tag. Entities without BoundingBox
-// are always considered visible.
+// Tests the cached WorldBounds of SceneEntity entities through a cached
+// query, one table at a time. Entities without BoundingBox are always
+// considered visible. Bounds are not refreshed here: runFrame's Bounds phase
+// keeps them current, and callers outside the engine pipeline call
+// updateWorldBounds() after moving entities and before culling.
 class FrustumCuller {
   public:
     static std::vector<flecs::entity> cull(const float* viewProjection, flecs::world& world);
+
+    // Same, into out (cleared first) so a per-frame caller reuses its capacity
+    static void cull(const float* viewProjection, flecs::world& world, std::vector<flecs::entity>& out);
+    static void cull(const float* viewProjection, flecs::world& world, std::pmr::vector<flecs::entity>& out);
 };
 
 } // namespace fabric
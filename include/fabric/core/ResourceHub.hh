@@ -3,6 +3,7 @@
 #include "fabric/core/Log.hh"
 #include "fabric/core/Resource.hh"
 #include "fabric/utils/CoordinatedGraph.hh"
+#include "fabric/utils/Metrics.hh"
 #include <any>
 #include <atomic>
 #include <chrono>
@@ -400,6 +401,16 @@ class ResourceHub {
      */
     size_t enforceMemoryBudget();
 
+    /**
+     * @brief Publish memory usage, budget and load queue depth
+     *
+     * Metrics are removed again when the hub is destroyed, so the registry
+     * must outlive the hub.
+     *
+     * @param registry Registry to publish into
+     */
+    void registerMetrics(MetricsRegistry& registry);
+
     /**
      * @brief Disable worker threads for testing
      */
@@ -521,6 +532,8 @@ class ResourceHub {
     // Memory management
     std::atomic<size_t> memoryBudget_;
 
+    MetricsRegistry* metrics_ = nullptr;
+
     // Worker threads
     std::atomic<unsigned int> workerThreadCount_;
     std::vector<std::unique_ptr<std::thread>> workerThreads_;
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "fabric/core/JsonTypes.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace fabric {
+
+class World;
+
+// One entity in a scene file. parent is the index of an earlier record,
+// or -1 for a root.
+struct SceneRecord {
+    std::string name;
+    int64_t parent = -1;
+    Vector3<float, Space::World> position{0.0f, 0.0f, 0.0f};
+    Quaternion<float> rotation;
+    Vector3<float, Space::World> scale{1.0f, 1.0f, 1.0f};
+};
+
+// Scene document: {"entities": [SceneRecord, ...]}. Every record field is
+// optional and unknown keys are ignored, on both the DOM and SAX paths.
+struct Scene {
+    std::vector<SceneRecord> entities;
+};
+
+void to_json(nlohmann::json& j, const SceneRecord& r);
+void from_json(const nlohmann::json& j, SceneRecord& r);
+void to_json(nlohmann::json& j, const Scene& s);
+void from_json(const nlohmann::json& j, Scene& s);
+
+// SAX handler that hands each record to the sink as soon as its closing
+// brace is read, so memory stays flat however large the scene is. A
+// top-level array is read as a bare entity list.
+class SceneStreamReader : public nlohmann::json_sax<nlohmann::json> {
+  public:
+    using Sink = std::function<void(const SceneRecord&)>;
+
+    explicit SceneStreamReader(Sink sink);
+
+    size_t recordCount() const { return count_; }
+    // Empty unless parse_error() was called
+    const std::string& error() const { return error_; }
+
+    bool null() override;
+    bool boolean(bool val) override;
+    bool number_integer(number_integer_t val) override;
+    bool number_unsigned(number_unsigned_t val) override;
+    bool number_float(number_float_t val, const string_t& s) override;
+    bool string(string_t& val) override;
+    bool binary(binary_t& val) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& val) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& lastToken,
+                     const nlohmann::detail::exception& ex) override;
+
+  private:
+    enum class Context : uint8_t {
+        Root,     // Top-level object
+        Entities, // The entity array
+        Record,   // One SceneRecord
+        Vector,   // position, rotation or scale
+        Skip      // Anything unrecognized, nested values included
+    };
+
+    enum class Field : uint8_t {
+        None,
+        Name,
+        Parent,
+        Position,
+        Rotation,
+        Scale
+    };
+
+    Context childContext(bool isObject);
+    void push(bool isObject);
+    void pop();
+    void number(double val);
+
+    Sink sink_;
+    std::vector<Context> stack_;
+    SceneRecord record_;
+    Field field_ = Field::None;
+    bool entitiesKey_ = false;
+    std::array<float*, 4> components_{}; // x, y, z, w of the vector being read
+    int component_ = -1;
+    size_t count_ = 0;
+    std::string error_;
+};
+
+// Stream records out of text, MessagePack or CBOR without building a DOM.
+// Returns the record count; throws FabricException on malformed input.
+size_t streamScene(std::span<const uint8_t> bytes, JsonFormat format, const SceneStreamReader::Sink& sink);
+
+// Create one scene entity per record with Position, Rotation and Scale set.
+// A record whose parent is not an earlier record becomes a root.
+size_t loadScene(World& world, std::span<const uint8_t> bytes, JsonFormat format);
+size_t loadSceneFile(World& world, const std::string& path, JsonFormat format);
+
+} // namespace fabric
@@ -4,7 +4,9 @@
 #include "fabric/core/Rendering.hh"
 #include <cstdint>
 #include <flecs.h>
-#include <vector>
+#include <memory_resource>
+#include <optional>
+#include <span>
 
 namespace fabric {
 
@@ -18,19 +20,34 @@ class SceneView {
     // Set clear color and flags for this view
     void setClearColor(uint32_t rgba);
 
-    // Execute the render pipeline for one frame
+    // Execute the render pipeline for one frame: cull(), extract(), submit().
+    // WorldBounds must be current, as for FrustumCuller.
     void render();
 
+    // The same steps one at a time, for driving the view from the Culling
+    // and RenderExtraction engine phases. Only submit() touches bgfx.
+    void cull();
+    void extract();
+    void submit();
+
     uint8_t viewId() const;
     Camera& camera();
-    const std::vector<flecs::entity>& visibleEntities() const;
+    // Entities that passed culling in the last render(); valid until the
+    // next render() or until the frame after next, whichever comes first
+    std::span<const flecs::entity> visibleEntities() const;
 
   private:
+    // Per-frame outputs, rebuilt from FrameArenas::resource() by every render()
+    struct FrameData {
+        explicit FrameData(std::pmr::memory_resource* arena) : visibleEntities(arena), renderList(arena) {}
+        std::pmr::vector<flecs::entity> visibleEntities;
+        RenderList renderList;
+    };
+
     uint8_t viewId_;
     Camera& camera_;
     flecs::world& world_;
-    RenderList renderList_;
-    std::vector<flecs::entity> visibleEntities_;
+    std::optional<FrameData> frame_;
     uint32_t clearColor_ = 0x303030ff;
 };
 
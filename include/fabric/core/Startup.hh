@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace fabric {
+
+enum class StartupThread : uint8_t {
+    Main,  // Runs on the thread that calls Startup::run()
+    Worker // Runs on a startup worker thread
+};
+
+struct StartupPhaseTiming {
+    std::string name;
+    StartupThread thread = StartupThread::Worker;
+    bool success = false;
+    bool skipped = false;              // Not run because a dependency failed
+    std::chrono::nanoseconds start{0}; // Offset from Startup construction
+    std::chrono::nanoseconds duration{0};
+};
+
+// Runs engine initialization as a graph of named phases. A phase starts
+// once every phase it names in `after` has finished; worker phases with
+// satisfied dependencies run concurrently, main phases run in order on the
+// calling thread (window, graphics and anything else with thread affinity).
+// Each phase is timed against a clock started at construction, and
+// markFirstFrame() closes the timeline with time-to-first-frame.
+class Startup {
+  public:
+    using Task = std::function<void()>;
+
+    // 0 worker threads runs every phase on the calling thread
+    explicit Startup(size_t workerThreads = 2);
+
+    Startup(const Startup&) = delete;
+    Startup& operator=(const Startup&) = delete;
+
+    // Names must be unique and every name in `after` must be added before run()
+    void addPhase(std::string name, std::vector<std::string> after, Task task,
+                  StartupThread thread = StartupThread::Worker);
+
+    // Run all phases. Throws FabricException for unknown dependencies or a
+    // cycle before anything runs. A phase that throws skips its dependents;
+    // once everything in flight has finished the first failure is rethrown.
+    void run();
+
+    // Record time-to-first-frame and log the timeline. Only the first call
+    // counts, so it can sit in the frame loop.
+    void markFirstFrame();
+
+    std::vector<StartupPhaseTiming> timeline() const;
+    std::chrono::nanoseconds elapsed() const;
+    // Zero until markFirstFrame(); safe to read from any thread
+    std::chrono::nanoseconds timeToFirstFrame() const {
+        return std::chrono::nanoseconds(firstFrameNanos_.load(std::memory_order_relaxed));
+    }
+
+    void logTimeline() const;
+
+  private:
+    struct Phase {
+        std::string name;
+        std::vector<std::string> after;
+        Task task;
+        StartupThread thread;
+    };
+
+    size_t workerThreads_;
+    std::chrono::steady_clock::time_point origin_;
+    std::vector<Phase> phases_;
+    std::atomic<int64_t> firstFrameNanos_{0};
+
+    mutable std::mutex timelineMutex_;
+    std::vector<StartupPhaseTiming> timeline_;
+};
+
+} // namespace fabric
@@ -4,11 +4,18 @@
 #include "fabric/utils/ErrorHandling.hh"
 #include "fabric/utils/Utils.hh"
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <mutex>
 #include <set>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace fabric {
@@ -170,4 +177,149 @@ template <typename StateEnum> class StateMachine {
     std::unordered_map<std::string, std::vector<HookEntry>> transitionHooks_;
 };
 
+// Allowed transitions for an enum of N states as one bitmask row per source
+// state, built at compile time:
+//
+//   inline constexpr TransitionTable<Door, 3> kDoorTransitions{
+//       {Door::Closed, Door::Open}, {Door::Open, Door::Closed}, {Door::Closed, Door::Locked}};
+//
+// Self-transitions are always allowed, matching StateMachine.
+template <typename StateEnum, size_t N> class TransitionTable {
+    static_assert(std::is_enum_v<StateEnum>, "TransitionTable needs an enum");
+    static_assert(N > 0 && N <= 64, "TransitionTable supports 1 to 64 states");
+
+  public:
+    using State = StateEnum;
+    static constexpr size_t kStateCount = N;
+
+    constexpr TransitionTable() = default;
+    constexpr TransitionTable(std::initializer_list<std::pair<StateEnum, StateEnum>> transitions) {
+        for (const auto& [from, to] : transitions)
+            allow(from, to);
+    }
+
+    constexpr TransitionTable& allow(StateEnum from, StateEnum to) {
+        rows_[index(from)] |= uint64_t{1} << index(to);
+        return *this;
+    }
+
+    constexpr bool allows(StateEnum from, StateEnum to) const {
+        return from == to || ((rows_[index(from)] >> index(to)) & 1u) != 0;
+    }
+
+    // Bit n set if state n is reachable from `from` in one step
+    constexpr uint64_t targets(StateEnum from) const { return rows_[index(from)]; }
+
+    static constexpr size_t index(StateEnum state) { return static_cast<size_t>(state); }
+
+  private:
+    std::array<uint64_t, N> rows_{};
+};
+
+// Enter and transition hooks for a TransitionTable, kept in flat arrays
+// indexed by state so firing them is two array lookups. Hooks receive Args,
+// typically the owning entity or a context, which lets one hook set serve
+// every machine in a batch. Not thread-safe; register hooks up front.
+template <typename StateEnum, size_t N, typename... Args> class StateHookTable {
+  public:
+    using Hook = std::function<void(StateEnum from, StateEnum to, Args... args)>;
+
+    void onEnter(StateEnum state, Hook hook) {
+        if (!hook)
+            throwError("State hook cannot be null");
+        enter_[index(state)].push_back(std::move(hook));
+    }
+
+    void onTransition(StateEnum from, StateEnum to, Hook hook) {
+        if (!hook)
+            throwError("Transition hook cannot be null");
+        transition_[index(from) * N + index(to)].push_back(std::move(hook));
+    }
+
+    void fire(StateEnum from, StateEnum to, Args... args) const {
+        for (const auto& hook : enter_[index(to)])
+            hook(from, to, args...);
+        for (const auto& hook : transition_[index(from) * N + index(to)])
+            hook(from, to, args...);
+    }
+
+    void clear() {
+        for (auto& hooks : enter_)
+            hooks.clear();
+        for (auto& hooks : transition_)
+            hooks.clear();
+    }
+
+  private:
+    static constexpr size_t index(StateEnum state) { return static_cast<size_t>(state); }
+
+    std::array<std::vector<Hook>, N> enter_;
+    std::array<std::vector<Hook>, N * N> transition_;
+};
+
+// Single-owner state machine over a constexpr TransitionTable. Two bytes for
+// a uint8_t enum, trivially copyable and without locks, so it can be stored
+// directly as an ECS component and stepped in batches with applyTransitions().
+// Unlike StateMachine it neither logs nor locks; callers that share one across
+// threads must synchronize themselves.
+template <const auto& Table> struct FixedStateMachine {
+    using TableType = std::remove_cvref_t<decltype(Table)>;
+    using State = typename TableType::State;
+
+    State state{};
+    State previous{};
+
+    constexpr FixedStateMachine() = default;
+    constexpr explicit FixedStateMachine(State initial) : state(initial), previous(initial) {}
+
+    constexpr bool canTransition(State to) const { return Table.allows(state, to); }
+
+    // Self-transitions succeed without changing previous or firing hooks
+    constexpr bool tryTransition(State to) {
+        if (!Table.allows(state, to))
+            return false;
+        if (to != state) {
+            previous = state;
+            state = to;
+        }
+        return true;
+    }
+
+    template <typename... Args>
+    bool tryTransition(State to, const StateHookTable<State, TableType::kStateCount, Args...>& hooks, Args... args) {
+        State from = state;
+        if (!tryTransition(to))
+            return false;
+        if (from != to)
+            hooks.fire(from, to, args...);
+        return true;
+    }
+
+    // Throws FabricException on a transition the table does not allow
+    void setState(State to) {
+        if (!tryTransition(to))
+            throwError("Invalid state transition from " + std::to_string(TableType::index(state)) + " to " +
+                       std::to_string(TableType::index(to)));
+    }
+
+    constexpr bool operator==(const FixedStateMachine&) const = default;
+};
+
+// Step many machines at once: machine i attempts targets[i]. Returns how many
+// changed state. Rejected requests leave their machine untouched.
+template <const auto& Table>
+size_t applyTransitions(std::span<FixedStateMachine<Table>> machines,
+                        std::span<const typename FixedStateMachine<Table>::State> targets) {
+    if (machines.size() != targets.size())
+        throwError("applyTransitions: machine and target counts differ");
+
+    size_t changed = 0;
+    for (size_t i = 0; i < machines.size(); ++i) {
+        auto before = machines[i].state;
+        if (machines[i].tryTransition(targets[i]) && machines[i].state != before)
+            ++changed;
+    }
+    return changed;
+}
+
 } // namespace fabric
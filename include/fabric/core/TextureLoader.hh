@@ -0,0 +1,159 @@
+#pragma once
+
+#include "fabric/utils/BufferPool.hh"
+#include "fabric/utils/MemoryHeaps.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+
+#include <bgfx/bgfx.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fabric {
+
+using TextureId = uint32_t;
+constexpr TextureId kInvalidTextureId = 0;
+
+enum class TextureLoadState : uint8_t {
+    Pending,
+    Ready,
+    Failed
+};
+
+struct TextureLoaderConfig {
+    size_t workerThreads = 2;
+    // Decoded RGBA8 staging: one slot holds a 1024x1024 image with its mip chain
+    size_t slotSize = 1024 * 1024 * 4 * 4 / 3 + 64;
+    size_t slotCount = 8;
+    // Bytes handed to bgfx per processUploads() call
+    size_t uploadBudgetBytes = 8 * 1024 * 1024;
+    uint64_t samplerFlags = BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP;
+    // Premultiplied RGBA8 shown until the real texture is uploaded
+    uint32_t placeholderColor = 0x40404040;
+};
+
+// RGBA8 pixels for a full mip chain, level 0 first. Lives in a BufferPool
+// slot when one is free and large enough, otherwise on the heap.
+struct DecodedImage {
+    BufferSlot slot;
+    std::vector<uint8_t> heap;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint8_t mipCount = 1;
+    size_t size = 0;
+
+    const uint8_t* data() const { return slot ? slot.data() : heap.data(); }
+    bool pooled() const { return static_cast<bool>(slot); }
+};
+
+// Off-thread image decoding with budgeted main-thread upload.
+// request() returns immediately; the texture handle is the placeholder until
+// a later processUploads() creates the real texture. Requests for a path and
+// mip setting whose modification time has not changed share one texture
+// through a reference count; a touched file decodes again on the next request. The decode
+// threads and staging pool are created by the first request that needs them,
+// so an app that never loads a texture pays for neither.
+// All methods except the static helpers must be called from the main thread.
+class TextureLoader {
+  public:
+    explicit TextureLoader(TextureLoaderConfig config = {});
+    ~TextureLoader();
+
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    // Call after bgfx::init() to create the placeholder texture
+    void init();
+
+    // Call before bgfx::shutdown(); drops queued decodes and destroys textures
+    void shutdown();
+
+    TextureId request(const std::string& path, bool generateMips = false);
+    void release(TextureId id);
+
+    // Upload decoded images until the byte budget is spent. At least one image
+    // is uploaded per call so oversized images still make progress.
+    // Returns the number of bytes uploaded.
+    size_t processUploads();
+
+    TextureLoadState state(TextureId id) const;
+    bgfx::TextureHandle handle(TextureId id) const;
+    bgfx::TextureHandle placeholder() const { return placeholder_; }
+
+    size_t pendingCount() const;
+    size_t liveCount() const;
+    uint64_t cacheHits() const { return cacheHits_; }
+    uint64_t pooledDecodes() const;
+    uint64_t heapDecodes() const;
+
+    // Bytes needed for an RGBA8 image and, optionally, its full mip chain
+    static size_t imageSize(uint32_t width, uint32_t height, bool mips);
+    static uint8_t mipCount(uint32_t width, uint32_t height);
+
+    // Box-filter each level from the previous one. data holds level 0 and
+    // must have room for imageSize(width, height, true) bytes.
+    static void buildMipChain(uint8_t* data, uint32_t width, uint32_t height);
+
+    // Decode a file to RGBA8 with optional mips. Thread-safe; pool may be null.
+    static std::optional<DecodedImage> decodeFile(const std::string& path, bool generateMips, BufferPool* pool);
+
+  private:
+    struct Entry {
+        std::string path;
+        std::filesystem::file_time_type mtime{};
+        bgfx::TextureHandle handle = BGFX_INVALID_HANDLE;
+        TextureLoadState state = TextureLoadState::Pending;
+        uint32_t refs = 0;
+        uint32_t generation = 0;
+        bool mips = false;
+        bool live = false;
+    };
+
+    struct DecodeResult {
+        TextureId id = kInvalidTextureId;
+        uint32_t generation = 0;
+        std::optional<DecodedImage> image;
+    };
+
+    // Shared with in-flight decode tasks so they outlive an early shutdown.
+    // pool is emplaced on the main thread before the first decode is queued.
+    struct Shared {
+        std::optional<BufferPool> pool;
+        std::mutex mutex;
+        std::deque<DecodeResult> ready;
+        uint64_t pooledDecodes = 0;
+        uint64_t heapDecodes = 0;
+    };
+
+    const Entry* find(TextureId id) const;
+    void upload(Entry& entry, const DecodedImage& image);
+    void destroyEntry(TextureId id);
+    // Start decode workers on first use; false once shut down
+    bool ensureWorkers();
+
+    TextureLoaderConfig config_;
+    std::shared_ptr<Shared> shared_;
+    std::unique_ptr<Utils::ThreadPoolExecutor> workers_;
+    bool stopped_ = false;
+
+    bgfx::TextureHandle placeholder_ = BGFX_INVALID_HANDLE;
+
+    // Slot vector: id = index + 1
+    std::vector<Entry> entries_;
+    std::vector<TextureId> freeIds_;
+    // By path, one map per mip setting (index 1 with mips)
+    std::array<std::unordered_map<std::string, TextureId>, 2> cache_;
+    size_t pending_ = 0;
+    uint64_t cacheHits_ = 0;
+};
+
+} // namespace fabric
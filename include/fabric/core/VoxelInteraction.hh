@@ -3,6 +3,7 @@
 #include "fabric/core/Event.hh"
 #include "fabric/core/FieldLayer.hh"
 #include "fabric/core/Rendering.hh"
+#include "fabric/core/VoxelLight.hh"
 #include "fabric/core/VoxelRaycast.hh"
 
 namespace fabric {
@@ -37,10 +38,15 @@ class VoxelInteraction {
     // Check if placing at position would overlap an AABB (player push-out check)
     static bool wouldOverlap(int vx, int vy, int vz, const AABB& playerBounds);
 
+    // Queue a light update for every voxel this creates or destroys; null stops.
+    // The caller still runs VoxelLighting::propagate().
+    void setLighting(VoxelLighting* lighting) { lighting_ = lighting; }
+
   private:
     DensityField& density_;
     EssenceField& essence_;
     EventDispatcher& dispatcher_;
+    VoxelLighting* lighting_ = nullptr;
 };
 
 } // namespace fabric
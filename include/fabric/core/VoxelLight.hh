@@ -0,0 +1,127 @@
+#pragma once
+
+#include "fabric/core/ChunkStreaming.hh"
+#include "fabric/core/ChunkedGrid.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace fabric {
+
+// Packed per-voxel light: sky level in the low nibble, block level in the high
+using VoxelLightGrid = ChunkedGrid<uint8_t>;
+
+inline constexpr uint8_t kMaxLightLevel = 15;
+
+constexpr uint8_t packLight(uint8_t sky, uint8_t block) {
+    return static_cast<uint8_t>((sky & 0xF) | ((block & 0xF) << 4));
+}
+constexpr uint8_t skyLight(uint8_t packed) {
+    return packed & 0xF;
+}
+constexpr uint8_t blockLight(uint8_t packed) {
+    return packed >> 4;
+}
+
+// Sky and block light over the chunks of a density grid, kept up to date by
+// breadth-first flood fill. Edits queue incremental work instead of a
+// recompute: a darkened cell floods a removal outward and relights from the
+// brightest surviving neighbours, so only the region the edit could reach is
+// visited. Queues are kept per chunk; propagate() drains them in rounds where
+// every chunk with work runs on the worker pool, touching only its own cells,
+// and light crossing a chunk face is handed to the neighbour's queue for the
+// next round. Sky light enters the top face of chunks with no tracked chunk
+// above and travels straight down at full strength; every other step costs
+// one level. Cells with density above the threshold are opaque.
+class VoxelLighting {
+  public:
+    // Null workers propagates on the calling thread
+    explicit VoxelLighting(const ChunkedGrid<float>& density, float threshold = 0.5f,
+                           Utils::ThreadPoolExecutor* workers = nullptr);
+
+    const VoxelLightGrid& light() const { return light_; }
+    uint8_t lightAt(int x, int y, int z) const { return light_.get(x, y, z); }
+
+    // Start tracking a chunk whose density is in place: queue its sky and
+    // emitters and let neighbours flood in. The chunk below stops seeing open
+    // sky through it.
+    void addChunk(int cx, int cy, int cz);
+
+    // Stop tracking a chunk and drop its light and queued work. Emitters are kept.
+    void removeChunk(int cx, int cy, int cz);
+
+    // Queue the update for a cell whose density changed
+    void voxelChanged(int x, int y, int z);
+
+    // Block light source at a cell, 0 to remove. Opaque cells may emit.
+    void setEmitter(int x, int y, int z, uint8_t level);
+    uint8_t emitterAt(int x, int y, int z) const { return emitters_.get(x, y, z); }
+
+    // Drain every queue. Returns the chunks whose meshes sample changed
+    // light (changed chunks and those across a changed face), sorted.
+    std::vector<ChunkCoord> propagate();
+
+    bool hasPendingWork() const;
+
+    // Cells whose light was written by the last propagate()
+    size_t lastChangedCells() const { return lastChangedCells_; }
+
+  private:
+    // One queued step for one cell of one chunk
+    struct LightNode {
+        uint16_t index; // Cell within the chunk
+        uint8_t level;
+        uint8_t flags;
+    };
+
+    struct ChunkWork {
+        std::vector<LightNode> removeQueue;
+        std::vector<LightNode> addQueue;
+        std::array<std::vector<LightNode>, 6> outbox; // Per face, routed between rounds
+        size_t changed = 0;
+        uint8_t changedFaces = 0; // Bit per face with a changed cell on it
+        bool dirty = false;
+    };
+
+    struct ChunkTask {
+        ChunkCoord coord;
+        ChunkWork* work;
+        uint8_t* light;
+        const float* density;    // Null: all air
+        const uint8_t* emitters; // Null: none
+        bool skyOpen;            // No tracked chunk above
+    };
+
+    enum class Round { Remove, Add };
+
+    ChunkWork& workFor(const ChunkCoord& coord);
+    // Queue a relight of the cell across face from index, if that chunk is tracked
+    void relightNeighbor(const ChunkCoord& coord, int index, int face);
+
+    // One round over every chunk with work in the round's queues, then route
+    // the outboxes. False if there was no work.
+    bool runRound(Round round);
+    void drainRemove(ChunkTask& task) const;
+    void drainAdd(ChunkTask& task) const;
+    void spread(ChunkTask& task, std::vector<LightNode>& queue, int index, uint8_t level, uint8_t channel,
+                Round round) const;
+    void write(ChunkTask& task, int index, uint8_t channel, uint8_t level) const;
+
+    bool opaque(const ChunkTask& task, int index) const;
+    uint8_t sourceLevel(const ChunkTask& task, int index, uint8_t channel) const;
+
+    const ChunkedGrid<float>& density_;
+    float threshold_;
+    Utils::ThreadPoolExecutor* workers_;
+    VoxelLightGrid light_;
+    ChunkedGrid<uint8_t> emitters_;
+    std::unordered_map<ChunkCoord, ChunkWork, ChunkCoordHash> work_;
+    std::vector<ChunkTask> tasks_;
+    size_t lastChangedCells_ = 0;
+};
+
+} // namespace fabric
@@ -6,14 +6,19 @@
 #include <array>
 #include <bgfx/bgfx.h>
 #include <cstdint>
+#include <memory_resource>
 #include <vector>
 
 namespace fabric {
 
 struct ChunkMeshData {
-    std::vector<VoxelVertex> vertices;
-    std::vector<uint32_t> indices;
-    std::vector<std::array<float, 4>> palette; // RGBA entries indexed by VoxelVertex::paletteIndex()
+    ChunkMeshData() = default;
+    explicit ChunkMeshData(std::pmr::memory_resource* resource)
+        : vertices(resource), indices(resource), palette(resource) {}
+
+    std::pmr::vector<VoxelVertex> vertices;
+    std::pmr::vector<uint32_t> indices;
+    std::pmr::vector<std::array<float, 4>> palette; // RGBA entries indexed by VoxelVertex::paletteIndex()
 };
 
 struct ChunkMesh {
@@ -28,14 +33,23 @@ class VoxelMesher {
   public:
     static bgfx::VertexLayout getVertexLayout();
 
-    // Generate raw mesh data (no bgfx, testable without GPU)
+    // Generate raw mesh data (no bgfx, testable without GPU). With a light
+    // grid (VoxelLighting::light()) each vertex carries the smoothed light of
+    // the open cells around its corner; without one, full sky.
     static ChunkMeshData meshChunkData(int cx, int cy, int cz, const ChunkedGrid<float>& density,
                                        const ChunkedGrid<Vector4<float, Space::World>>& essence,
-                                       float threshold = 0.5f);
+                                       float threshold = 0.5f, const ChunkedGrid<uint8_t>* light = nullptr);
+
+    // Same, into out, reusing its capacity: re-meshing a chunk whose geometry
+    // fits in the previous buffers does not touch the heap
+    static void meshChunkData(int cx, int cy, int cz, const ChunkedGrid<float>& density,
+                              const ChunkedGrid<Vector4<float, Space::World>>& essence, ChunkMeshData& out,
+                              float threshold = 0.5f, const ChunkedGrid<uint8_t>* light = nullptr);
 
     // Generate bgfx mesh (requires bgfx initialized)
     static ChunkMesh meshChunk(int cx, int cy, int cz, const ChunkedGrid<float>& density,
-                               const ChunkedGrid<Vector4<float, Space::World>>& essence, float threshold = 0.5f);
+                               const ChunkedGrid<Vector4<float, Space::World>>& essence, float threshold = 0.5f,
+                               const ChunkedGrid<uint8_t>* light = nullptr);
 
     static void destroyMesh(ChunkMesh& mesh);
 };
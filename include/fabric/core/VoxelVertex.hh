@@ -6,17 +6,19 @@ namespace fabric {
 
 // Packed 8-byte voxel vertex for GPU bandwidth efficiency.
 // posNormalAO: px[7:0] | py[15:8] | pz[23:16] | normalIdx[26:24] | ao[28:27] | pad[31:29]
-// material:    paletteIndex[15:0] | reserved[31:16]
+// material:    paletteIndex[15:0] | skyLight[19:16] | blockLight[23:20] | reserved[31:24]
 struct VoxelVertex {
     uint32_t posNormalAO;
     uint32_t material;
 
-    static VoxelVertex pack(uint8_t px, uint8_t py, uint8_t pz, uint8_t normalIdx, uint8_t ao, uint16_t paletteIdx) {
+    // light is packed as in VoxelLight.hh (sky low nibble, block high); full sky by default
+    static VoxelVertex pack(uint8_t px, uint8_t py, uint8_t pz, uint8_t normalIdx, uint8_t ao, uint16_t paletteIdx,
+                            uint8_t light = 0x0F) {
         VoxelVertex v;
         v.posNormalAO = static_cast<uint32_t>(px) | (static_cast<uint32_t>(py) << 8) |
                         (static_cast<uint32_t>(pz) << 16) | (static_cast<uint32_t>(normalIdx & 0x7) << 24) |
                         (static_cast<uint32_t>(ao & 0x3) << 27);
-        v.material = static_cast<uint32_t>(paletteIdx);
+        v.material = static_cast<uint32_t>(paletteIdx) | (static_cast<uint32_t>(light) << 16);
         return v;
     }
 
@@ -26,6 +28,8 @@ struct VoxelVertex {
     uint8_t normalIndex() const { return static_cast<uint8_t>((posNormalAO >> 24) & 0x7); }
     uint8_t aoLevel() const { return static_cast<uint8_t>((posNormalAO >> 27) & 0x3); }
     uint16_t paletteIndex() const { return static_cast<uint16_t>(material & 0xFFFF); }
+    uint8_t skyLight() const { return static_cast<uint8_t>((material >> 16) & 0xF); }
+    uint8_t blockLight() const { return static_cast<uint8_t>((material >> 20) & 0xF); }
 };
 
 static_assert(sizeof(VoxelVertex) == 8, "VoxelVertex must be 8 bytes");
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "fabric/core/ChunkedGrid.hh"
+#include "fabric/core/ECS.hh"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace fabric {
+
+struct WorldSaveStats {
+    size_t entities = 0;
+    size_t tables = 0;
+    size_t columns = 0;
+    size_t chunks = 0;
+    uint64_t bytes = 0;
+    std::chrono::nanoseconds elapsed{0};
+};
+
+// Binary world snapshot (.fworld). The file is a header, 64-byte aligned
+// sections and a table of contents at the end:
+//   schema  component names and sizes, indexed by the table sections
+//   table   one per Flecs archetype: entity ids, ChildOf parents, then one
+//           column per saved component, exactly as Flecs stores it
+//   grid    one per ChunkedGrid: chunk coordinates, then raw chunk cells
+// Loading maps the file and hands each column straight to ecs_bulk_init,
+// so restore cost is a copy per column, not a parse per entity. Entity ids
+// are kept, so ChildOf links and ids held elsewhere survive the round trip.
+// Only components registered with the schema are saved; names, prefabs and
+// disabled entities are not. Data is native-endian and little-endian only.
+class WorldSave {
+  public:
+    static constexpr uint32_t kVersion = 1;
+
+    WorldSave() = default;
+
+    // Save T under name. T must be trivially copyable; empty types save as tags.
+    template <typename T> WorldSave& component(std::string name) {
+        static_assert(std::is_trivially_copyable_v<T>, "saved components are copied column by column");
+        components_.push_back({std::move(name), std::is_empty_v<T> ? 0u : static_cast<uint32_t>(sizeof(T)),
+                               [](flecs::world& world) { return world.component<T>().id(); }});
+        return *this;
+    }
+
+    // Save a voxel grid alongside the world. load() replaces its chunks.
+    template <typename T> WorldSave& grid(std::string name, ChunkedGrid<T>& grid) {
+        static_assert(std::is_trivially_copyable_v<T>, "grid chunks are copied as raw bytes");
+        grids_.push_back({std::move(name), static_cast<uint32_t>(sizeof(T)),
+                          [&grid](const ChunkVisitor& visit) {
+                              grid.forEachChunk([&](int cx, int cy, int cz) {
+                                  visit(cx, cy, cz, grid.chunkData(cx, cy, cz));
+                              });
+                          },
+                          [&grid](int cx, int cy, int cz) -> void* { return grid.ensureChunk(cx, cy, cz); },
+                          [&grid] { grid.clear(); }});
+        return *this;
+    }
+
+    // Position, Rotation, Scale, BoundingBox, LocalToWorld, SceneEntity, Renderable
+    static WorldSave core();
+
+    // Errors are logged; save returns false and load returns nullopt.
+    // load() validates the whole file before touching the world, and fails
+    // if a saved entity id is already in use with components.
+    bool save(flecs::world& world, const std::string& path, WorldSaveStats* stats = nullptr) const;
+    std::optional<WorldSaveStats> load(flecs::world& world, const std::string& path) const;
+
+  private:
+    using ChunkVisitor = std::function<void(int, int, int, const void*)>;
+
+    struct ComponentEntry {
+        std::string name;
+        uint32_t size;
+        std::function<flecs::entity_t(flecs::world&)> resolve;
+    };
+
+    struct GridEntry {
+        std::string name;
+        uint32_t cellSize;
+        std::function<void(const ChunkVisitor&)> forEachChunk;
+        std::function<void*(int, int, int)> ensureChunk;
+        std::function<void()> clear;
+    };
+
+    void write(flecs::world& world, const std::string& path, WorldSaveStats& stats) const;
+    void read(flecs::world& world, const std::string& path, WorldSaveStats& stats) const;
+
+    std::vector<ComponentEntry> components_;
+    std::vector<GridEntry> grids_;
+};
+
+} // namespace fabric
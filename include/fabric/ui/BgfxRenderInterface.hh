@@ -1,13 +1,20 @@
 #pragma once
 
+#include "fabric/ui/TextureAtlas.hh"
+#include "fabric/ui/UiBatcher.hh"
+
 #include <RmlUi/Core/RenderInterface.h>
 
 #include <bgfx/bgfx.h>
 
-#include <unordered_map>
+#include <memory>
+#include <optional>
+#include <vector>
 
 namespace fabric {
 
+class TextureLoader;
+
 class BgfxRenderInterface : public Rml::RenderInterface {
   public:
     BgfxRenderInterface();
@@ -22,6 +29,14 @@ class BgfxRenderInterface : public Rml::RenderInterface {
     // Call once per frame before Rml::Context::Render() to set up the view
     void beginFrame(uint16_t width, uint16_t height);
 
+    // Call once per frame after Rml::Context::Render() to submit pending batches
+    void endFrame();
+
+    // Route LoadTexture() through an async loader. Images show the loader's
+    // placeholder until processUploads() has created the real texture.
+    // The loader must outlive this interface's shutdown().
+    void setTextureLoader(TextureLoader* loader) { textureLoader_ = loader; }
+
     // -- RenderInterface required methods --
 
     Rml::CompiledGeometryHandle CompileGeometry(Rml::Span<const Rml::Vertex> vertices,
@@ -51,14 +66,54 @@ class BgfxRenderInterface : public Rml::RenderInterface {
     const bgfx::VertexLayout& vertexLayout() const { return layout_; }
     bool isScissorEnabled() const { return scissorEnabled_; }
     Rml::Rectanglei scissorRegion() const { return scissorRect_; }
+    const TextureAtlas& atlas() const { return atlas_; }
+
+    // Number of bgfx::submit calls issued since the last beginFrame()
+    uint32_t submitCount() const { return submitCount_; }
+
+    // Geometry above this vertex count gets static GPU buffers instead of batching
+    static constexpr size_t kMaxBatchedGeometryVertices = 4096;
+
+    // Textures with both dimensions at or below this size are packed into the atlas
+    static constexpr int kMaxAtlasTextureSize = 256;
+    static constexpr uint16_t kAtlasPageSize = 1024;
+    static constexpr uint16_t kAtlasMaxPages = 4;
 
   private:
+    // CPU copy is kept for every geometry so batched and atlas-remapped draws
+    // can rebuild vertices each frame. Large geometry also owns static buffers.
     struct CompiledGeom {
-        bgfx::VertexBufferHandle vbh;
-        bgfx::IndexBufferHandle ibh;
-        uint32_t indexCount;
+        std::vector<Rml::Vertex> vertices;
+        std::vector<uint16_t> indices16; // populated when vertices fit 16-bit indices
+        std::vector<uint32_t> indices32; // populated otherwise
+        bgfx::VertexBufferHandle vbh = BGFX_INVALID_HANDLE;
+        bgfx::IndexBufferHandle ibh = BGFX_INVALID_HANDLE;
+        uint32_t indexCount = 0;
+    };
+
+    struct TextureEntry {
+        bgfx::TextureHandle handle = BGFX_INVALID_HANDLE;
+        UiUvRect uv;
+        std::optional<AtlasRegion> region; // set when packed into the atlas
+        uint32_t asyncId = 0;              // TextureLoader id; the loader owns the handle
+        bool live = false;
     };
 
+    CompiledGeom* findGeometry(Rml::CompiledGeometryHandle geometry) const;
+    const TextureEntry* findTexture(Rml::TextureHandle texture) const;
+
+    Rml::TextureHandle addTexture(const TextureEntry& entry);
+    Rml::TextureHandle createTexture(const uint8_t* rgba, int width, int height);
+    bool uploadToAtlas(TextureEntry& entry, const uint8_t* rgba, int width, int height);
+    void releaseTextureEntry(TextureEntry& entry);
+    void resolveAsyncTextures();
+
+    UiScissor currentScissor() const;
+    void setScissorState(const UiScissor& scissor);
+
+    void flushBatches();
+    void drawImmediate(const CompiledGeom& geom, Rml::Vector2f translation, const TextureEntry* tex);
+
     static constexpr bgfx::ViewId kDefaultViewId = 255;
 
     bgfx::ViewId viewId_ = kDefaultViewId;
@@ -73,10 +128,20 @@ class BgfxRenderInterface : public Rml::RenderInterface {
     bool hasTransform_ = false;
     float transform_[16] = {};
 
-    uintptr_t nextGeomHandle_ = 1;
-    uintptr_t nextTexHandle_ = 1;
-    std::unordered_map<uintptr_t, CompiledGeom> geometries_;
-    std::unordered_map<uintptr_t, bgfx::TextureHandle> textures_;
+    // Slot vectors: handle = index + 1, so lookups are an index instead of a hash
+    std::vector<std::unique_ptr<CompiledGeom>> geometries_;
+    std::vector<uintptr_t> freeGeomSlots_;
+    std::vector<TextureEntry> textures_;
+    std::vector<uintptr_t> freeTexSlots_;
+
+    TextureAtlas atlas_{kAtlasPageSize, kAtlasMaxPages};
+    std::vector<bgfx::TextureHandle> atlasPages_;
+
+    TextureLoader* textureLoader_ = nullptr;
+    std::vector<uintptr_t> pendingAsync_;
+
+    UiBatcher batcher_;
+    uint32_t submitCount_ = 0;
 };
 
 } // namespace fabric
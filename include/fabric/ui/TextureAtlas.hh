@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace fabric {
+
+// Texel rectangle inside one atlas page.
+struct AtlasRegion {
+    uint16_t page = 0;
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint16_t width = 0;
+    uint16_t height = 0;
+};
+
+// Shelf packer for small textures. Each page is a square of pageSize texels
+// split into horizontal shelves whose height is fixed by the first region
+// placed on them. Regions are not reclaimed individually; a page resets once
+// every region on it has been released.
+// CPU-only bookkeeping: the caller owns the GPU texture backing each page.
+class TextureAtlas {
+  public:
+    explicit TextureAtlas(uint16_t pageSize = 1024, uint16_t maxPages = 4);
+
+    // Reserve a width x height region. Opens a new page when existing pages
+    // are full, up to maxPages. Returns nullopt if the region does not fit.
+    std::optional<AtlasRegion> allocate(uint16_t width, uint16_t height);
+
+    void release(const AtlasRegion& region);
+
+    // Drop all pages and regions
+    void clear();
+
+    uint16_t pageSize() const;
+    uint16_t maxPages() const;
+    size_t pageCount() const;
+    uint32_t liveRegions(uint16_t page) const;
+
+  private:
+    struct Shelf {
+        uint16_t y;
+        uint16_t height;
+        uint16_t cursorX;
+    };
+
+    struct Page {
+        std::vector<Shelf> shelves;
+        uint16_t nextShelfY = 0;
+        uint32_t live = 0;
+    };
+
+    std::optional<AtlasRegion> allocateInPage(uint16_t pageIdx, uint16_t width, uint16_t height);
+
+    uint16_t pageSize_;
+    uint16_t maxPages_;
+    std::vector<Page> pages_;
+};
+
+} // namespace fabric
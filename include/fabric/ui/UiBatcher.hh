@@ -0,0 +1,70 @@
+#pragma once
+
+#include <RmlUi/Core/Vertex.h>
+
+#include <bgfx/bgfx.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace fabric {
+
+// Normalized sub-rectangle of a texture. Identity for standalone textures;
+// the packed region for textures stored in an atlas page.
+struct UiUvRect {
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 1.0f;
+    float v1 = 1.0f;
+};
+
+struct UiScissor {
+    bool enabled = false;
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint16_t width = 0;
+    uint16_t height = 0;
+
+    bool operator==(const UiScissor&) const = default;
+};
+
+// Contiguous index range sharing texture and scissor state; one bgfx::submit.
+struct UiDrawBatch {
+    bgfx::TextureHandle texture = BGFX_INVALID_HANDLE;
+    UiScissor scissor;
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+};
+
+// CPU-side accumulator for RmlUi draws. Geometry is pre-translated and
+// UV-remapped into one shared vertex/index stream with 16-bit indices.
+// Consecutive draws with the same texture and scissor extend the previous
+// batch instead of opening a new one. The render interface uploads the
+// stream into bgfx transient buffers once per flush.
+class UiBatcher {
+  public:
+    static constexpr size_t kMaxVertices = 65535;
+    static constexpr size_t kMaxIndices = size_t{1} << 18;
+
+    bool canFit(size_t vertexCount, size_t indexCount) const;
+
+    // Caller must check canFit() first
+    void append(std::span<const Rml::Vertex> vertices, std::span<const uint16_t> indices, float translateX,
+                float translateY, const UiUvRect& uv, bgfx::TextureHandle texture, const UiScissor& scissor);
+
+    void clear();
+    bool empty() const;
+
+    const std::vector<Rml::Vertex>& vertices() const;
+    const std::vector<uint16_t>& indices() const;
+    const std::vector<UiDrawBatch>& batches() const;
+
+  private:
+    std::vector<Rml::Vertex> vertices_;
+    std::vector<uint16_t> indices_;
+    std::vector<UiDrawBatch> batches_;
+};
+
+} // namespace fabric
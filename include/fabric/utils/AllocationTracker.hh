@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fabric {
+
+struct AllocationStats {
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytes = 0; // Requested bytes, not allocator footprint
+};
+
+// Heap allocation counters fed by the global operator new/delete
+// replacements in src/core/AllocationHooks.cc. UnitTests, E2ETests and
+// FabricSoak always link the hooks; Fabric links them when
+// FABRIC_TRACK_ALLOCATIONS is ON. Without the hooks available() is false
+// and every count stays zero.
+//
+// Counts cover C++ new/delete only. C libraries calling malloc directly
+// (Flecs, SDL, bgfx internals) are not seen.
+class AllocationTracker {
+  public:
+    static bool available() noexcept;
+
+    // Process-wide totals, summed over sharded counters
+    static AllocationStats global() noexcept;
+
+    // Totals for the calling thread; cheap enough to read every frame
+    static AllocationStats thread() noexcept;
+
+    // Called by the hooks. Must not allocate.
+    static void noteAllocation(size_t bytes) noexcept;
+    static void noteFree() noexcept;
+    static void markAvailable() noexcept;
+};
+
+// Counts allocations made by the current thread since construction
+class AllocationScope {
+  public:
+    AllocationScope() noexcept : start_(AllocationTracker::thread()) {}
+
+    uint64_t allocations() const noexcept { return AllocationTracker::thread().allocations - start_.allocations; }
+    uint64_t frees() const noexcept { return AllocationTracker::thread().frees - start_.frees; }
+    uint64_t bytes() const noexcept { return AllocationTracker::thread().bytes - start_.bytes; }
+
+  private:
+    AllocationStats start_;
+};
+
+} // namespace fabric
+
+// GoogleTest guard: runs the statement(s) and fails if they allocated on this
+// thread. Warm caches and reserve capacity before the guard; it checks the
+// steady state, e.g. EXPECT_NO_ALLOCATIONS({ dispatcher.dispatchEvent(e); });
+#define EXPECT_NO_ALLOCATIONS(...)                                                                                     \
+    do {                                                                                                               \
+        ::fabric::AllocationScope fabricAllocationScope_;                                                              \
+        __VA_ARGS__;                                                                                                   \
+        uint64_t fabricAllocations_ = fabricAllocationScope_.allocations();                                            \
+        if (!::fabric::AllocationTracker::available())                                                                 \
+            ADD_FAILURE() << "EXPECT_NO_ALLOCATIONS: allocation hooks are not linked into this executable";            \
+        else                                                                                                           \
+            EXPECT_EQ(fabricAllocations_, 0u) << "heap allocations in: " #__VA_ARGS__;                                 \
+    } while (0)
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "fabric/utils/ErrorHandling.hh"
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
 #include <span>
@@ -18,10 +21,12 @@ class BufferPool;
 // Automatically returns the slot to the pool on destruction.
 class BufferSlot {
   public:
-    BufferSlot() : pool_(nullptr), data_(nullptr), size_(0) {}
+    BufferSlot() = default;
     ~BufferSlot();
 
-    BufferSlot(BufferSlot&& other) noexcept : pool_(other.pool_), data_(other.data_), size_(other.size_) {
+    BufferSlot(BufferSlot&& other) noexcept
+        : pool_(other.pool_), data_(other.data_), size_(other.size_), sizeClass_(other.sizeClass_),
+          index_(other.index_) {
         other.pool_ = nullptr;
         other.data_ = nullptr;
         other.size_ = 0;
@@ -33,6 +38,8 @@ class BufferSlot {
             pool_ = other.pool_;
             data_ = other.data_;
             size_ = other.size_;
+            sizeClass_ = other.sizeClass_;
+            index_ = other.index_;
             other.pool_ = nullptr;
             other.data_ = nullptr;
             other.size_ = 0;
@@ -53,75 +60,108 @@ class BufferSlot {
 
   private:
     friend class BufferPool;
-    BufferSlot(BufferPool* pool, uint8_t* data, size_t size) : pool_(pool), data_(data), size_(size) {}
+    BufferSlot(BufferPool* pool, uint8_t* data, size_t size, uint32_t sizeClass, uint32_t index)
+        : pool_(pool), data_(data), size_(size), sizeClass_(sizeClass), index_(index) {}
 
     void release();
 
-    BufferPool* pool_;
-    uint8_t* data_;
-    size_t size_;
+    BufferPool* pool_ = nullptr;
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    uint32_t sizeClass_ = 0;
+    uint32_t index_ = 0;
 };
 
-// Fixed-size slab allocator with borrow/return semantics.
-// All memory is pre-allocated in a single contiguous block.
-// Thread-safe: blocking borrow() and non-blocking tryBorrow().
+struct BufferPoolClass {
+    size_t slotSize = 0;
+    size_t slotCount = 0; // Slots per slab
+};
+
+struct BufferPoolConfig {
+    std::vector<BufferPoolClass> classes;
+    // Add a slab of slotCount slots when a class runs dry, up to maxSlabs.
+    // Growth allocates from resource on the borrowing thread.
+    bool growable = false;
+    size_t maxSlabs = 8;
+    // Per-thread cache of free slots per class; 0 disables
+    size_t magazineSize = 4;
+    // Align slabs to 2 MiB and ask the OS for transparent huge pages (Linux)
+    bool hugePages = false;
+    // Slab memory; null uses the global default resource
+    std::pmr::memory_resource* resource = nullptr;
+};
+
+struct BufferPoolClassStats {
+    size_t slotSize = 0;
+    size_t capacity = 0;  // Slots across all slabs
+    size_t borrowed = 0;  // Slots currently out
+    size_t highWater = 0; // Most slots out at once
+    uint64_t borrows = 0;
+    uint64_t misses = 0;    // tryBorrow() calls that found nothing
+    uint64_t waits = 0;     // borrow() calls that had to block
+    uint64_t waitNanos = 0; // Total time spent blocked
+    uint64_t grows = 0;     // Slabs added after construction
+};
+
+// Size-classed slab pool with borrow/return semantics. A request is served
+// by the smallest class whose slots fit. Free slots sit on a lock-free
+// stack per class (index plus ABA tag in one 64-bit word) fronted by small
+// magazines, one per thread shard, so steady-state borrow/return from
+// worker threads rarely touches shared state.
+// Thread-safe: blocking borrow() and non-blocking tryBorrow(). Slots must be
+// returned before the pool is destroyed.
 class BufferPool {
   public:
-    BufferPool(size_t slotSize, size_t slotCount) : slotSize_(slotSize), slotCount_(slotCount) {
-        storage_.resize(slotSize * slotCount);
-        freeSlots_.reserve(slotCount);
-        for (size_t i = slotCount; i > 0; --i) {
-            freeSlots_.push_back(storage_.data() + (i - 1) * slotSize);
-        }
-    }
+    static constexpr size_t kMagazineShards = 16;
+    static constexpr size_t kMaxMagazineSize = 16;
 
-    // Blocking borrow: waits until a slot is available.
-    BufferSlot borrow() {
-        std::unique_lock lock(mutex_);
-        cv_.wait(lock, [this] { return !freeSlots_.empty(); });
-        return popSlot();
-    }
+    // Single size class, all slots allocated up front
+    BufferPool(size_t slotSize, size_t slotCount, std::pmr::memory_resource* resource = nullptr);
+    explicit BufferPool(const BufferPoolConfig& config);
+    ~BufferPool();
 
-    // Non-blocking borrow: returns nullopt if pool is exhausted.
-    std::optional<BufferSlot> tryBorrow() {
-        std::lock_guard lock(mutex_);
-        if (freeSlots_.empty()) {
-            return std::nullopt;
-        }
-        return popSlot();
-    }
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
 
-    size_t available() const {
-        std::lock_guard lock(mutex_);
-        return freeSlots_.size();
-    }
+    // Borrow from the smallest class (minSize 0) or the smallest class that
+    // holds minSize bytes. borrow() blocks until a slot is free and throws
+    // if no class is large enough.
+    BufferSlot borrow(size_t minSize = 0);
+    std::optional<BufferSlot> tryBorrow(size_t minSize = 0);
+
+    // Free slots across all classes
+    size_t available() const;
+    // Slots across all classes
+    size_t capacity() const;
+    // Largest slot size; anything up to this fits some class
+    size_t slotSize() const;
 
-    size_t capacity() const { return slotCount_; }
-    size_t slotSize() const { return slotSize_; }
+    std::vector<BufferPoolClassStats> stats() const;
 
   private:
     friend class BufferSlot;
-
-    BufferSlot popSlot() {
-        uint8_t* ptr = freeSlots_.back();
-        freeSlots_.pop_back();
-        return BufferSlot(this, ptr, slotSize_);
-    }
-
-    void returnSlot(uint8_t* ptr) {
-        {
-            std::lock_guard lock(mutex_);
-            freeSlots_.push_back(ptr);
-        }
-        cv_.notify_one();
-    }
-
-    size_t slotSize_;
-    size_t slotCount_;
-    std::vector<uint8_t> storage_;
-    std::vector<uint8_t*> freeSlots_;
-    mutable std::mutex mutex_;
-    std::condition_variable cv_;
+    struct SizeClass;
+
+    static constexpr uint32_t kEmpty = UINT32_MAX;
+
+    std::optional<size_t> classFor(size_t minSize) const;
+    std::optional<BufferSlot> tryBorrowFrom(size_t classIndex);
+    uint32_t popFree(SizeClass& sc);
+    void pushFree(SizeClass& sc, uint32_t index);
+    uint32_t stealFromMagazines(SizeClass& sc);
+    bool grow(SizeClass& sc);
+    void addSlab(SizeClass& sc);
+    uint8_t* slotData(const SizeClass& sc, uint32_t index) const;
+    void returnSlot(uint32_t sizeClass, uint32_t index);
+
+    BufferPoolConfig config_;
+    std::pmr::memory_resource* resource_;
+    std::vector<std::unique_ptr<SizeClass>> classes_;
+
+    // Blocking borrowers park here; returners notify only when someone waits
+    std::atomic<uint32_t> waiters_{0};
+    std::mutex waitMutex_;
+    std::condition_variable waitCv_;
 };
 
 // Inline definitions for BufferSlot that depend on BufferPool
@@ -131,7 +171,7 @@ inline BufferSlot::~BufferSlot() {
 
 inline void BufferSlot::release() {
     if (pool_ && data_) {
-        pool_->returnSlot(data_);
+        pool_->returnSlot(sizeClass_, index_);
         pool_ = nullptr;
         data_ = nullptr;
         size_ = 0;
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Built-in zone profiler. Each thread records zone begin/end events into its
+// own fixed-size ring buffer with a raw CPU timestamp; the oldest events are
+// overwritten. Recording is wait-free and never allocates after a thread's
+// first zone. When a thread exits its ring goes to a free list and is reused,
+// events discarded, by the next thread to record a zone, so short-lived
+// threads don't each leave 1 MiB behind. Rings are read only when a trace is
+// exported or a frame is marked, so the exporter and frameMark() pay for
+// timestamp calibration, aggregation and JSON formatting, not the zones.
+// frameMark() folds every zone that ended since the previous mark, on any
+// thread, into a count and total time per zone name, queryable until the
+// next mark and written alongside the events in exported traces.
+// Enabled through FABRIC_ENABLE_BUILTIN_PROFILER, which routes the
+// FABRIC_ZONE_* and FABRIC_FRAME_MARK macros in Profiler.hh here.
+
+namespace fabric::profiler {
+
+// Raw timestamp: TSC on x86, the virtual counter on AArch64, steady_clock
+// nanoseconds elsewhere. Converted to wall time at export.
+inline uint64_t readTimestamp() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+// Fields are relaxed atomics so the exporter can read a ring while its owner
+// writes; on mainstream targets they compile to plain loads and stores.
+struct ZoneEvent {
+    std::atomic<uint64_t> timestamp{0};
+    std::atomic<const char*> name{nullptr}; // nullptr marks a zone end
+};
+
+// Single-producer ring owned by one thread
+class ThreadBuffer {
+  public:
+    static constexpr size_t kCapacity = size_t{1} << 16;
+
+    explicit ThreadBuffer(uint32_t id) : id_(id), events_(std::make_unique<ZoneEvent[]>(kCapacity)) {}
+
+    void push(const char* name) noexcept {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        auto& event = events_[head & (kCapacity - 1)];
+        event.timestamp.store(readTimestamp(), std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    uint32_t id() const { return id_; }
+
+  private:
+    friend class Registry;
+
+    uint32_t id_;
+    std::unique_ptr<ZoneEvent[]> events_;
+    std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> tail_{0}; // events before this index were discarded by reset()
+    std::string name_;
+};
+
+namespace detail {
+
+inline std::atomic<bool> gEnabled{true};
+inline thread_local ThreadBuffer* tlsBuffer = nullptr;
+
+ThreadBuffer* registerThread();
+
+inline ThreadBuffer& currentBuffer() {
+    ThreadBuffer* buffer = tlsBuffer;
+    if (!buffer) [[unlikely]]
+        buffer = tlsBuffer = registerThread();
+    return *buffer;
+}
+
+} // namespace detail
+
+// Name recorded for frame boundaries; exported as global instant events
+inline constexpr const char kFrameMarkName[] = "Frame";
+
+class ScopedZone {
+  public:
+    explicit ScopedZone(const char* name) noexcept {
+        if (detail::gEnabled.load(std::memory_order_relaxed)) {
+            buffer_ = &detail::currentBuffer();
+            buffer_->push(name);
+        }
+    }
+
+    ~ScopedZone() {
+        if (buffer_)
+            buffer_->push(nullptr);
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+  private:
+    ThreadBuffer* buffer_ = nullptr;
+};
+
+void setEnabled(bool enabled);
+bool isEnabled();
+
+// Label for the calling thread in exported traces
+void setThreadName(const char* name);
+
+// Record a frame boundary on the calling thread and update frame statistics.
+// Triggers an automatic export when the frame exceeded the hitch threshold.
+void frameMark();
+uint64_t frameCount();
+double lastFrameMs();
+
+// Zones that ended between the two most recent frame marks. A zone counts
+// toward the frame in which it ends.
+struct ZoneTotal {
+    const char* name;
+    uint64_t count;
+    double totalMs;
+};
+
+// Totals per zone name for the last completed frame, longest first
+std::vector<ZoneTotal> lastFrameZones();
+
+// Write a trace to directory/fabric_hitch_<frame>.json whenever a frame takes
+// longer than thresholdMs, at most once per second. Zero disables.
+void setHitchThreshold(double thresholdMs, const std::string& directory = ".");
+
+// Chrome trace event JSON, loadable by chrome://tracing and ui.perfetto.dev.
+// Returns the number of events written.
+size_t exportChromeTrace(std::ostream& out);
+bool exportChromeTrace(const std::string& path);
+
+// Discard everything recorded so far
+void reset();
+
+// Timestamp ticks per nanosecond, measured against steady_clock
+double ticksPerNanosecond();
+
+} // namespace fabric::profiler
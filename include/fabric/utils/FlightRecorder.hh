@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace fabric {
+
+// How a channel's per-frame value is produced and rendered
+enum class FlightChannelKind : uint8_t {
+    Zone,    // Nanoseconds spent in a scope this frame (summed)
+    Counter, // Events this frame; sampled channels store the delta of a monotonic source
+    Gauge    // Level at the end of the frame (queue depth, pending work)
+};
+
+struct FlightRecorderConfig {
+    size_t frameCapacity = 600;   // ~10 s at 60 Hz
+    double hitchThresholdMs = 50.0;
+    size_t framesAfterHitch = 60; // Keep recording this long so the dump surrounds the hitch
+    std::string directory = ".";
+    std::chrono::milliseconds cooldown{2000};
+};
+
+inline constexpr size_t kFlightMaxChannels = 32;
+
+// One frame as stored in the ring and in dump files
+struct FlightFrame {
+    uint64_t frame = 0;
+    uint64_t startNs = 0; // Relative to the recorder's creation
+    uint64_t durationNs = 0;
+    std::array<uint32_t, kFlightMaxChannels> values{};
+};
+
+// Decoded dump file
+struct FlightDump {
+    struct Channel {
+        std::string name;
+        FlightChannelKind kind = FlightChannelKind::Counter;
+    };
+
+    uint64_t hitchFrame = 0;
+    uint64_t thresholdNs = 0;
+    std::vector<Channel> channels;
+    std::vector<FlightFrame> frames;
+};
+
+// Always-on flight recorder for frame hitches. Keeps the last frameCapacity
+// frames of per-channel zone times, event counts and queue depths in a
+// preallocated ring. When a frame exceeds the hitch threshold, recording
+// continues for framesAfterHitch frames, then the whole window is written to
+// directory/fabric_hitch_<frame>.fflight and a one-line summary is logged.
+// Dumps are converted to Chrome trace JSON with convertToChromeTrace().
+//
+// beginFrame/endFrame, channel registration and sampling run on the frame
+// thread. addZoneTime/count/setGauge may be called from any thread.
+class FlightRecorder {
+  public:
+    using ChannelId = uint8_t;
+    using Sampler = std::function<uint64_t()>;
+
+    static constexpr size_t kMaxChannels = kFlightMaxChannels;
+    static constexpr uint32_t kFileVersion = 1;
+
+    explicit FlightRecorder(FlightRecorderConfig config = {});
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    // Register a channel; throws once kMaxChannels are in use
+    ChannelId addChannel(const std::string& name, FlightChannelKind kind);
+
+    // Channel read once per frame in endFrame(). Counter samplers are treated
+    // as monotonic totals and record the per-frame delta.
+    ChannelId addSampledChannel(const std::string& name, FlightChannelKind kind, Sampler sampler);
+
+    void beginFrame();
+
+    // Close the frame, store it in the ring and run hitch detection.
+    // Returns true if this frame was a hitch.
+    bool endFrame();
+
+    void addZoneTime(ChannelId channel, uint64_t nanoseconds) noexcept { accumulate(channel, nanoseconds); }
+    void count(ChannelId channel, uint64_t n = 1) noexcept { accumulate(channel, n); }
+    void setGauge(ChannelId channel, uint64_t value) noexcept {
+        current_[channel].store(saturate(value), std::memory_order_relaxed);
+    }
+
+    class ScopedZone {
+      public:
+        ScopedZone(FlightRecorder& recorder, ChannelId channel)
+            : recorder_(recorder), channel_(channel), start_(std::chrono::steady_clock::now()) {}
+        ~ScopedZone() {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            recorder_.addZoneTime(channel_, static_cast<uint64_t>(
+                                                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+      private:
+        FlightRecorder& recorder_;
+        ChannelId channel_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    // Write the current window to a file or stream in the .fflight format
+    bool dump(const std::string& path, uint64_t hitchFrame = 0) const;
+    void dump(std::ostream& out, uint64_t hitchFrame = 0) const;
+
+    // Frames currently in the ring, oldest first
+    std::vector<FlightFrame> snapshot() const;
+
+    size_t channelCount() const { return channels_.size(); }
+    uint64_t frameCount() const { return frameCount_; }
+    uint64_t hitchCount() const { return hitchCount_; }
+    uint64_t dumpCount() const { return dumpCount_; }
+    const std::string& lastDumpPath() const { return lastDumpPath_; }
+    const FlightRecorderConfig& config() const { return config_; }
+
+    // One-line description of a frame: duration and the largest zones
+    std::string summarize(const FlightFrame& frame) const;
+
+    static bool readDump(std::istream& in, FlightDump& out);
+
+    // Chrome trace event JSON: one complete event per frame, counter tracks
+    // per channel and an instant marker on the hitch. Returns events written.
+    static size_t writeChromeTrace(const FlightDump& dump, std::ostream& out);
+    static bool convertToChromeTrace(const std::string& dumpPath, const std::string& tracePath);
+
+  private:
+    struct Channel {
+        std::string name;
+        FlightChannelKind kind;
+        Sampler sampler;
+        uint64_t lastSample = 0;
+    };
+
+    static uint32_t saturate(uint64_t value) noexcept {
+        return value > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(value);
+    }
+
+    void accumulate(ChannelId channel, uint64_t value) noexcept {
+        auto& slot = current_[channel];
+        uint32_t seen = slot.load(std::memory_order_relaxed);
+        while (!slot.compare_exchange_weak(seen, saturate(uint64_t{seen} + value), std::memory_order_relaxed)) {
+        }
+    }
+
+    void writeHitchDump();
+
+    FlightRecorderConfig config_;
+    std::vector<Channel> channels_;
+    std::vector<FlightFrame> ring_;
+    std::array<std::atomic<uint32_t>, kMaxChannels> current_{};
+
+    std::chrono::steady_clock::time_point origin_;
+    std::chrono::steady_clock::time_point frameStart_;
+    bool inFrame_ = false;
+
+    uint64_t frameCount_ = 0;
+    uint64_t hitchCount_ = 0;
+    uint64_t dumpCount_ = 0;
+    uint64_t pendingHitch_ = 0; // Frame awaiting its post-hitch window, 0 if none
+    uint64_t pendingHitchDone_ = 0;
+    std::chrono::steady_clock::time_point lastDump_{};
+    std::string lastDumpPath_;
+};
+
+} // namespace fabric
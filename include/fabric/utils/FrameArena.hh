@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace fabric {
+
+// Bump allocator for data that lives a frame or two. allocate() moves a
+// pointer, deallocate() does nothing, and reset() rewinds to the start.
+// Requests past capacity go to upstream and are returned on reset(), after
+// which the block grows to the observed high-water mark so the next frame
+// fits. Not thread-safe: each thread gets its own through FrameArenas.
+class FrameArena : public std::pmr::memory_resource {
+  public:
+    static constexpr size_t kDefaultCapacity = size_t{1} << 20;
+
+    // Null upstream uses the global default resource. The block is
+    // allocated on first use.
+    explicit FrameArena(size_t capacity = kDefaultCapacity, std::pmr::memory_resource* upstream = nullptr);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void reset();
+
+    // Bytes handed out since the last reset, including overflow
+    size_t used() const { return offset_ + overflowBytes_; }
+    size_t capacity() const { return capacity_; }
+    size_t overflowBytes() const { return overflowBytes_; }
+    size_t highWater() const { return highWater_; }
+
+  private:
+    struct Overflow {
+        void* p;
+        size_t bytes;
+        size_t alignment;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    void releaseBlock();
+
+    std::pmr::memory_resource* upstream_;
+    std::byte* block_ = nullptr;
+    size_t capacity_;
+    size_t offset_ = 0;
+    size_t overflowBytes_ = 0;
+    size_t highWater_ = 0;
+    std::vector<Overflow> overflow_;
+};
+
+// Double-buffered, per-thread frame arenas. Memory from current() stays valid
+// through the following frame, so a frame can read what the previous one
+// built; advance() starts a new frame and each thread rewinds its older
+// arena the next time it calls current(). The main thread's arenas draw
+// from MemoryHeap::Temp, other threads' from the default resource, so Temp
+// must not be released while frames are running.
+//
+// A job on a worker can outlive frames, so arenas only rewind between jobs:
+// while a JobScope is open current() keeps returning the arena the job
+// started with, whatever advance() did meanwhile, and what the job allocated
+// counts as allocated in the frame the job ended, staying valid through the
+// frame after that. ThreadPoolExecutor opens one around every task; other
+// worker loops that keep frame memory across frames open their own.
+//
+// Lifetime contract: anything allocated from frame memory must be dropped
+// before the second advance() after the frame it was allocated in. Nothing
+// checks this; a container kept longer reads memory another frame reuses.
+// Copy data that must persist into a container with a lasting resource.
+//
+// Frame memory is opt-in per process: resource(), which engine types such
+// as StreamingUpdate and SceneView default to, hands out the default
+// resource until a main loop that calls advance() every frame calls
+// setEnabled(true). Without that, arenas would never rewind and grow for
+// as long as the process runs (tests, benchmarks, tools).
+class FrameArenas {
+  public:
+    // Call once at the start of every frame, from the main loop
+    static void advance();
+    static uint64_t frame();
+
+    // Route resource() to the frame arenas. Only for loops that advance()
+    // every frame.
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static FrameArena& current();
+    // current() when enabled, otherwise the global default resource
+    static std::pmr::memory_resource* resource();
+
+    // Pins the calling thread's arenas for the duration of a job. Nests.
+    class JobScope {
+      public:
+        JobScope();
+        ~JobScope();
+
+        JobScope(const JobScope&) = delete;
+        JobScope& operator=(const JobScope&) = delete;
+    };
+};
+
+} // namespace fabric
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace fabric {
+
+// Read-only view of a whole file through the OS page cache. Pages are
+// mapped copy-on-write, so callers may hand the bytes to APIs that take
+// non-const pointers without touching the file. Platforms without a mapping
+// API read the file into memory instead. Move-only.
+class MappedFile {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Throws FabricException if the file cannot be opened or mapped
+    static MappedFile open(const std::string& path);
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::span<const uint8_t> bytes() const { return {data_, size_}; }
+
+    explicit operator bool() const { return data_ != nullptr; }
+
+  private:
+    void close();
+
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false; // false: data_ came from new[]
+};
+
+} // namespace fabric
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+
+namespace fabric {
+
+class MetricsRegistry;
+
+// Engine subsystems with their own heap, so memory can be attributed and
+// transient data released in one call instead of freed object by object
+enum class MemoryHeap : uint8_t {
+    ChunkStorage, // ChunkedGrid voxel arrays
+    Mesh,         // ChunkMeshData vertex/index/palette buffers
+    Resources,    // Texture staging and other loaded asset data
+    Temp,         // Short-lived scratch
+};
+
+inline constexpr size_t kMemoryHeapCount = 4;
+
+struct MemoryHeapStats {
+    uint64_t usedBytes = 0;      // Live bytes requested by callers
+    uint64_t peakUsedBytes = 0;  // High-water mark of usedBytes since the last release
+    uint64_t committedBytes = 0; // Memory the backend holds for this heap
+    uint64_t allocations = 0;    // allocate() calls since process start
+};
+
+struct MemoryHeapConfig {
+    // Back ChunkStorage with large/huge OS pages when the backend supports it
+    bool chunkLargePages = false;
+    // Address space reserved up front for large-page chunk storage
+    size_t chunkReserveBytes = size_t{1} << 30;
+};
+
+// A std::pmr::memory_resource with per-heap accounting and bulk release.
+// Allocation is single-threaded: only the thread that created the heap may
+// allocate from it (others throw). Deallocation is allowed from any thread.
+class HeapResource : public std::pmr::memory_resource {
+  public:
+    HeapResource();
+
+    MemoryHeapStats stats() const;
+
+    // Free every block at once. Pointers into the heap dangle afterwards, so
+    // owners must drop them without deallocating (ChunkedGrid::abandonChunks).
+    // Owner thread only.
+    void release();
+
+    // Refresh the committed byte count. Owner thread only; other threads
+    // read the last sampled value.
+    void sampleCommitted();
+
+    bool ownedByCurrentThread() const { return std::this_thread::get_id() == owner_; }
+
+    virtual const char* backendName() const = 0;
+
+  protected:
+    virtual void* allocateBlock(size_t bytes, size_t alignment) = 0;
+    virtual void freeBlock(void* p, size_t bytes, size_t alignment) = 0;
+    virtual void releaseAll() = 0;
+    virtual uint64_t measureCommitted() const = 0;
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::thread::id owner_;
+    std::atomic<uint64_t> used_{0};
+    std::atomic<uint64_t> peak_{0};
+    std::atomic<uint64_t> committed_{0};
+    std::atomic<uint64_t> allocations_{0};
+};
+
+// Process-wide registry of subsystem heaps. Heaps are created together by
+// configure() and live until exit; the calling thread owns them. Every
+// executable calls configure() on its main thread before starting workers
+// (Fabric before Startup::run, FabricSoak, the test and bench mains), and
+// get() throws until it has, rather than letting the first thread to touch
+// a heap, possibly a worker, become its owner.
+// The default backend pools over operator new; executables linking
+// src/core/MimallocHeaps.cc give each heap its own mi_heap_t instead.
+class MemoryHeaps {
+  public:
+    using Factory = std::unique_ptr<HeapResource> (*)(MemoryHeap heap, const MemoryHeapConfig& config);
+
+    // Apply options and create the heaps, owned by the calling thread. Throws
+    // if heaps already exist.
+    static void configure(const MemoryHeapConfig& config);
+    static bool configured();
+
+    // Throws if configure() has not been called
+    static HeapResource& get(MemoryHeap heap);
+    static std::pmr::memory_resource* resource(MemoryHeap heap) { return &get(heap); }
+
+    static MemoryHeapStats stats(MemoryHeap heap) { return get(heap).stats(); }
+    static void release(MemoryHeap heap) { get(heap).release(); }
+    static void sampleCommitted();
+
+    static const char* name(MemoryHeap heap);
+
+    // Publish used/peak/committed bytes per heap. The heaps outlive any registry.
+    static void registerMetrics(MetricsRegistry& registry);
+
+    // Replace the default backend; must run before the heaps are created
+    static void installBackend(Factory factory);
+};
+
+} // namespace fabric
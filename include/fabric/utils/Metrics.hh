@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace fabric {
+
+// Monotonic counter sharded across cache lines. Each thread increments its
+// own shard, so concurrent writers never contend; reads sum the shards.
+class Counter {
+  public:
+    static constexpr size_t kShards = 16;
+
+    void add(uint64_t n = 1) noexcept { shards_[shardIndex()].value.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const noexcept;
+
+  private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+
+    static size_t shardIndex() noexcept;
+
+    std::array<Shard, kShards> shards_;
+};
+
+class Gauge {
+  public:
+    void set(double v) noexcept { value_.store(v, std::memory_order_relaxed); }
+    void add(double delta) noexcept;
+    double value() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<double> value_{0.0};
+};
+
+// Log-linear histogram in the style of HdrHistogram: values below 16 are
+// exact, larger values land in one of 16 sub-buckets per power of two, so
+// any recorded value is reported within 1/16 of its true magnitude.
+// Recording is one relaxed increment on a fixed bucket array.
+class Histogram {
+  public:
+    static constexpr unsigned kSubBucketBits = 4;
+    static constexpr size_t kSubBuckets = size_t{1} << kSubBucketBits;
+    static constexpr size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    // unitScale converts recorded integers to the exported unit,
+    // e.g. 1e-9 for nanoseconds reported as seconds
+    explicit Histogram(double unitScale = 1.0) : unitScale_(unitScale) {}
+
+    void record(uint64_t value) noexcept;
+    void recordDuration(std::chrono::nanoseconds duration) noexcept {
+        record(static_cast<uint64_t>(duration.count() < 0 ? 0 : duration.count()));
+    }
+
+    uint64_t count() const noexcept { return count_.load(std::memory_order_relaxed); }
+    uint64_t sum() const noexcept { return sum_.load(std::memory_order_relaxed); }
+    uint64_t max() const noexcept { return max_.load(std::memory_order_relaxed); }
+
+    // Representative value at quantile q in [0, 1], in recorded units
+    uint64_t percentile(double q) const noexcept;
+
+    double unitScale() const { return unitScale_; }
+
+    static size_t bucketIndex(uint64_t value) noexcept;
+    static uint64_t bucketLowerBound(size_t index) noexcept;
+    static uint64_t bucketUpperBound(size_t index) noexcept;
+
+  private:
+    double unitScale_;
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+// Named metrics rendered in the Prometheus text exposition format.
+// Lookups and registration take a mutex; the returned references are stable
+// until remove(), so hot paths hold on to them and update lock-free.
+// Callback gauges are evaluated on the thread that renders, which lets
+// single-threaded subsystems report state without synchronization as long
+// as rendering happens on their thread (the async context is polled from
+// the main loop).
+class MetricsRegistry {
+  public:
+    Counter& counter(const std::string& name, const std::string& help = {});
+    Gauge& gauge(const std::string& name, const std::string& help = {});
+    Histogram& histogram(const std::string& name, const std::string& help = {}, double unitScale = 1.0);
+    void gaugeCallback(const std::string& name, const std::string& help, std::function<double()> read);
+
+    bool contains(const std::string& name) const;
+    void remove(const std::string& name);
+    size_t size() const;
+
+    void renderPrometheus(std::ostream& out) const;
+    std::string renderPrometheus() const;
+
+    // Prometheus metric name grammar: [a-zA-Z_:][a-zA-Z0-9_:]*
+    static bool isValidName(const std::string& name);
+
+  private:
+    enum class Kind : uint8_t {
+        Counter,
+        Gauge,
+        Histogram,
+        Callback
+    };
+
+    struct Entry {
+        Kind kind;
+        std::string help;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+        std::function<double()> read;
+    };
+
+    Entry& findOrCreate(const std::string& name, const std::string& help, Kind kind);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Entry> entries_;
+};
+
+} // namespace fabric
@@ -2,6 +2,8 @@
 
 // Fabric Profiler Abstraction
 // When FABRIC_PROFILING_ENABLED is defined, these map to Tracy.
+// When FABRIC_BUILTIN_PROFILER_ENABLED is defined, zones and frame marks map
+// to the built-in ring buffer profiler (BuiltinProfiler.hh); the rest are no-ops.
 // Otherwise, they compile to nothing.
 
 #ifdef FABRIC_PROFILING_ENABLED
@@ -56,6 +58,50 @@
 #define FABRIC_PLOT(name, val) TracyPlot(name, val)
 #define FABRIC_PLOT_CONFIG(name, type, step, fill, color) TracyPlotConfig(name, type, step, fill, color)
 
+#elif defined(FABRIC_BUILTIN_PROFILER_ENABLED)
+#include "fabric/utils/BuiltinProfiler.hh"
+
+#define FABRIC_PROFILER_CONCAT_IMPL(a, b) a##b
+#define FABRIC_PROFILER_CONCAT(a, b) FABRIC_PROFILER_CONCAT_IMPL(a, b)
+#define FABRIC_PROFILER_ZONE(name) ::fabric::profiler::ScopedZone FABRIC_PROFILER_CONCAT(fabricZone_, __LINE__)(name)
+
+#define FABRIC_ZONE_SCOPED FABRIC_PROFILER_ZONE(__func__)
+#define FABRIC_ZONE_SCOPED_N(name) FABRIC_PROFILER_ZONE(name)
+#define FABRIC_ZONE_SCOPED_C(color) FABRIC_PROFILER_ZONE(__func__)
+#define FABRIC_ZONE_SCOPED_NC(name, c) FABRIC_PROFILER_ZONE(name)
+#define FABRIC_ZONE_TEXT(txt, len)
+#define FABRIC_ZONE_NAME(txt, len)
+#define FABRIC_ZONE_VALUE(val)
+#define FABRIC_ZONE_COLOR(color)
+#define FABRIC_ZONE_SCOPED_S(depth) FABRIC_PROFILER_ZONE(__func__)
+#define FABRIC_ZONE_SCOPED_NS(name, depth) FABRIC_PROFILER_ZONE(name)
+
+#define FABRIC_FRAME_MARK ::fabric::profiler::frameMark()
+#define FABRIC_FRAME_MARK_NAMED(name)
+#define FABRIC_FRAME_MARK_START(name)
+#define FABRIC_FRAME_MARK_END(name)
+
+#define FABRIC_ALLOC(ptr, size)
+#define FABRIC_FREE(ptr)
+#define FABRIC_ALLOC_N(ptr, size, name)
+#define FABRIC_FREE_N(ptr, name)
+#define FABRIC_ALLOC_S(ptr, size, depth)
+#define FABRIC_FREE_S(ptr, depth)
+
+#define FABRIC_LOCKABLE(type, var) type var
+#define FABRIC_LOCKABLE_N(type, var, desc) type var
+#define FABRIC_SHARED_LOCKABLE(type, var) type var
+#define FABRIC_SHARED_LOCKABLE_N(type, var, d) type var
+#define FABRIC_LOCKABLE_BASE(type) type
+#define FABRIC_SHARED_LOCKABLE_BASE(type) type
+#define FABRIC_LOCK_MARK(var)
+
+#define FABRIC_SET_THREAD_NAME(name) ::fabric::profiler::setThreadName(name)
+#define FABRIC_MESSAGE(txt, len)
+#define FABRIC_MESSAGE_L(txt)
+#define FABRIC_PLOT(name, val)
+#define FABRIC_PLOT_CONFIG(name, type, step, fill, color)
+
 #else
 // All macros compile to nothing when profiling is disabled.
 #define FABRIC_ZONE_SCOPED
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace fabric {
+
+namespace Utils {
+class ThreadPoolExecutor;
+}
+
+// One dependency graph of tasks indexed 0..n-1, run by runTaskGraph
+struct TaskGraph {
+    std::vector<std::vector<size_t>> dependents; // Tasks to release when each task completes
+    std::vector<size_t> dependencyCounts;        // Unfinished dependencies per task
+    std::vector<bool> blocked;                   // Skip without running; empty means none
+
+    // Runs task i and reports success. Called on a worker or the calling
+    // thread; must not throw.
+    std::function<bool(size_t)> run;
+    // Called on the calling thread instead of run() for a task that is
+    // blocked or has a failed dependency. Optional.
+    std::function<void(size_t)> skip;
+    // Tasks that must run on the calling thread. Optional; none by default.
+    std::function<bool(size_t)> onCallingThread;
+};
+
+// Run every task once all of its dependencies have completed. A failed or
+// skipped task skips its dependents. Ready tasks go to the worker pool as
+// soon as they are released, so they overlap with calling-thread tasks,
+// which run one at a time in release order. Null workers runs everything on
+// the calling thread in topological order. Returns task indices in
+// completion order.
+std::vector<size_t> runTaskGraph(TaskGraph& graph, Utils::ThreadPoolExecutor* workers);
+
+// Run body(i) for every i in [0, count). The calling thread and up to
+// count - 1 workers claim indices from a shared counter, so uneven items
+// balance out. Null workers or fewer than two items run inline. Waits for
+// every helper before rethrowing the first exception, so body may reference
+// the caller's state; indices not yet claimed when one throws are skipped.
+void parallelFor(size_t count, Utils::ThreadPoolExecutor* workers, const std::function<void(size_t)>& body);
+
+} // namespace fabric
@@ -4,10 +4,13 @@
 
 namespace fabric {
 
-class Utils {
-  public:
-    // Thread-safe. Generates prefix + `length` random hex digits.
-    static std::string generateUniqueId(const std::string& prefix, int length = 8);
-};
+// A namespace rather than a class so it shares fabric::Utils with the
+// thread pool (ThreadPoolExecutor.hh) and both headers can be included together
+namespace Utils {
+
+// Thread-safe. Generates prefix + `length` random hex digits.
+std::string generateUniqueId(const std::string& prefix, int length = 8);
+
+} // namespace Utils
 
 } // namespace fabric
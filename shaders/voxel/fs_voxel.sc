@@ -1,4 +1,4 @@
-$input v_color0, v_normalAo
+$input v_color0, v_normalAo, v_light
 
 #include "bgfx_shader.sh"
 
@@ -12,6 +12,10 @@ void main() {
     float ndotl = max(dot(normal, u_lightDir.xyz), 0.0);
     float light = 0.3 + 0.7 * ndotl;
 
+    // Voxel light: the sun reaches as far as sky light does, block light
+    // sources shine regardless of it
+    light = max(light * v_light.x, v_light.y);
+
     // AO darkening
     light *= 0.3 + 0.7 * ao;
 
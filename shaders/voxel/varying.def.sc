@@ -1,5 +1,6 @@
 vec4 v_color0    : COLOR0    = vec4(1.0, 1.0, 1.0, 1.0);
 vec4 v_normalAo  : TEXCOORD2 = vec4(0.0, 1.0, 0.0, 1.0);
+vec2 v_light     : TEXCOORD3 = vec2(1.0, 0.0);
 
 vec4 a_texcoord0 : TEXCOORD0;
 vec4 a_texcoord1 : TEXCOORD1;
@@ -1,5 +1,5 @@
 $input a_texcoord0, a_texcoord1
-$output v_color0, v_normalAo
+$output v_color0, v_normalAo, v_light
 
 #include "bgfx_shader.sh"
 
@@ -29,7 +29,11 @@ void main() {
     // Palette index from first 2 bytes of second attribute
     int palIdx = int(a_texcoord1.x) + int(a_texcoord1.y) * 256;
 
+    // Byte 2: skyLight[3:0] | blockLight[7:4]
+    int lightLevels = int(a_texcoord1.z);
+
     gl_Position = mul(u_modelViewProj, vec4(pos, 1.0));
     v_color0 = u_palette[palIdx];
     v_normalAo = vec4(decodeNormal(normalIdx), float(aoLevel) / 3.0);
+    v_light = vec2(float(lightLevels & 15), float(lightLevels >> 4)) / 15.0;
 }
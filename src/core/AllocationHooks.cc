@@ -0,0 +1,155 @@
+// AllocationHooks.cc
+// Global operator new/delete replacements that feed AllocationTracker.
+// Linked into executables (not FabricLib) so each binary opts in once.
+// With FABRIC_USE_MIMALLOC the hooks forward to mimalloc's API; mimalloc is
+// then built without its own new/delete override so the symbols don't clash.
+#include "fabric/utils/AllocationTracker.hh"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(FABRIC_USE_MIMALLOC)
+#include <mimalloc.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace {
+
+void* allocate(std::size_t size) noexcept {
+    fabric::AllocationTracker::noteAllocation(size);
+#if defined(FABRIC_USE_MIMALLOC)
+    return mi_malloc(size ? size : 1);
+#else
+    return std::malloc(size ? size : 1);
+#endif
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t align) noexcept {
+    fabric::AllocationTracker::noteAllocation(size);
+    auto alignment = static_cast<std::size_t>(align);
+#if defined(FABRIC_USE_MIMALLOC)
+    return mi_malloc_aligned(size ? size : 1, alignment);
+#elif defined(_WIN32)
+    return _aligned_malloc(size ? size : 1, alignment);
+#else
+    std::size_t rounded = ((size ? size : 1) + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded);
+#endif
+}
+
+void release(void* p) noexcept {
+    if (!p)
+        return;
+    fabric::AllocationTracker::noteFree();
+#if defined(FABRIC_USE_MIMALLOC)
+    mi_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void releaseAligned(void* p) noexcept {
+    if (!p)
+        return;
+    fabric::AllocationTracker::noteFree();
+#if defined(FABRIC_USE_MIMALLOC)
+    mi_free(p);
+#elif defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+[[maybe_unused]] const bool hooksRegistered = (fabric::AllocationTracker::markAvailable(), true);
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* p = allocate(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* p = allocate(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    if (void* p = allocateAligned(size, align))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    if (void* p = allocateAligned(size, align))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, align);
+}
+
+void operator delete(void* p) noexcept {
+    release(p);
+}
+
+void operator delete[](void* p) noexcept {
+    release(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    release(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    release(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    release(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    release(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    releaseAligned(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    releaseAligned(p);
+}
@@ -1,10 +1,21 @@
 #include "fabric/core/ChunkMeshManager.hh"
 
+#include <chrono>
+
 namespace fabric {
 
+namespace {
+
+constexpr const char* kDirtyMetric = "fabric_chunk_mesh_dirty";
+constexpr const char* kMeshCountMetric = "fabric_chunk_mesh_count";
+constexpr const char* kRemeshMetric = "fabric_chunk_remesh_seconds";
+
+} // namespace
+
 ChunkMeshManager::ChunkMeshManager(EventDispatcher& dispatcher, const ChunkedGrid<float>& density,
                                    const ChunkedGrid<Vector4<float, Space::World>>& essence, ChunkMeshConfig config)
-    : dispatcher_(dispatcher), density_(density), essence_(essence), config_(config) {
+    : dispatcher_(dispatcher), density_(density), essence_(essence), config_(config),
+      meshResource_(config.resource ? config.resource : MemoryHeaps::resource(MemoryHeap::Mesh)) {
     handlerId_ = dispatcher_.addEventListener(kVoxelChangedEvent, [this](Event& e) {
         int cx = e.getData<int>("cx");
         int cy = e.getData<int>("cy");
@@ -15,6 +26,20 @@ ChunkMeshManager::ChunkMeshManager(EventDispatcher& dispatcher, const ChunkedGri
 
 ChunkMeshManager::~ChunkMeshManager() {
     dispatcher_.removeEventListener(kVoxelChangedEvent, handlerId_);
+    if (metrics_) {
+        metrics_->remove(kDirtyMetric);
+        metrics_->remove(kMeshCountMetric);
+        metrics_->remove(kRemeshMetric);
+    }
+}
+
+void ChunkMeshManager::registerMetrics(MetricsRegistry& registry) {
+    metrics_ = &registry;
+    registry.gaugeCallback(kDirtyMetric, "Chunks waiting for a remesh",
+                           [this] { return static_cast<double>(dirtyCount()); });
+    registry.gaugeCallback(kMeshCountMetric, "Chunks with a built mesh",
+                           [this] { return static_cast<double>(meshCount()); });
+    remeshTime_ = &registry.histogram(kRemeshMetric, "Time to remesh one chunk", 1e-9);
 }
 
 void ChunkMeshManager::markDirty(int cx, int cy, int cz) {
@@ -27,13 +52,23 @@ int ChunkMeshManager::update() {
     while (it != dirty_.end() && count < config_.maxRemeshPerTick) {
         auto coord = *it;
         it = dirty_.erase(it);
-        meshes_[coord] =
-            VoxelMesher::meshChunkData(coord.cx, coord.cy, coord.cz, density_, essence_, config_.threshold);
+        auto start = std::chrono::steady_clock::now();
+        // Re-mesh in place so an edited chunk reuses its buffers
+        auto& mesh = meshes_.try_emplace(coord, meshResource_).first->second;
+        VoxelMesher::meshChunkData(coord.cx, coord.cy, coord.cz, density_, essence_, mesh, config_.threshold,
+                                   config_.light);
+        if (remeshTime_)
+            remeshTime_->recordDuration(std::chrono::steady_clock::now() - start);
         ++count;
     }
     return count;
 }
 
+void ChunkMeshManager::removeChunk(int cx, int cy, int cz) {
+    dirty_.erase({cx, cy, cz});
+    meshes_.erase({cx, cy, cz});
+}
+
 const ChunkMeshData* ChunkMeshManager::meshFor(const ChunkCoord& coord) const {
     auto it = meshes_.find(coord);
     if (it == meshes_.end())
@@ -1,12 +1,42 @@
 #include "fabric/core/ChunkStreaming.hh"
 #include "fabric/utils/Profiler.hh"
 
+#include <chrono>
+#include <cstdlib>
+#include <tuple>
+
 namespace fabric {
 
+namespace {
+
+constexpr const char* kTrackedMetric = "fabric_chunk_streaming_tracked";
+constexpr const char* kRadiusMetric = "fabric_chunk_streaming_radius";
+constexpr const char* kUpdateMetric = "fabric_chunk_streaming_update_seconds";
+
+} // namespace
+
 ChunkStreamingManager::ChunkStreamingManager(const StreamingConfig& config) : config_(config) {}
 
+ChunkStreamingManager::~ChunkStreamingManager() {
+    if (metrics_) {
+        metrics_->remove(kTrackedMetric);
+        metrics_->remove(kRadiusMetric);
+        metrics_->remove(kUpdateMetric);
+    }
+}
+
+void ChunkStreamingManager::registerMetrics(MetricsRegistry& registry) {
+    metrics_ = &registry;
+    registry.gaugeCallback(kTrackedMetric, "Chunks currently tracked by streaming",
+                           [this] { return static_cast<double>(trackedChunkCount()); });
+    registry.gaugeCallback(kRadiusMetric, "Current streaming radius in chunks",
+                           [this] { return static_cast<double>(currentRadius()); });
+    updateTime_ = &registry.histogram(kUpdateMetric, "Time spent in ChunkStreamingManager::update", 1e-9);
+}
+
 StreamingUpdate ChunkStreamingManager::update(float viewX, float viewY, float viewZ, float speed) {
     FABRIC_ZONE_SCOPED_N("ChunkStreamingManager::update");
+    auto start = std::chrono::steady_clock::now();
 
     int effectiveRadius = std::min(
         static_cast<int>(static_cast<float>(config_.baseRadius) + speed * config_.speedScale), config_.maxRadius);
@@ -16,57 +46,75 @@ StreamingUpdate ChunkStreamingManager::update(float viewX, float viewY, float vi
     int centerCY = static_cast<int>(std::floor(viewY / static_cast<float>(kChunkSize)));
     int centerCZ = static_cast<int>(std::floor(viewZ / static_cast<float>(kChunkSize)));
 
-    std::unordered_set<ChunkCoord, ChunkCoordHash> desired;
+    // The desired set is the cube of chunks within effectiveRadius (Chebyshev
+    // distance) of the center, so membership is a bounds test, not a set
+    auto inRange = [&](const ChunkCoord& c) {
+        return std::abs(c.cx - centerCX) <= effectiveRadius && std::abs(c.cy - centerCY) <= effectiveRadius &&
+               std::abs(c.cz - centerCZ) <= effectiveRadius;
+    };
+    auto distSq = [&](const ChunkCoord& c) {
+        int dx = c.cx - centerCX;
+        int dy = c.cy - centerCY;
+        int dz = c.cz - centerCZ;
+        return dx * dx + dy * dy + dz * dz;
+    };
+    // Ties broken by coordinate so the order doesn't depend on hash iteration
+    auto coordLess = [](const ChunkCoord& a, const ChunkCoord& b) {
+        return std::tie(a.cx, a.cy, a.cz) < std::tie(b.cx, b.cy, b.cz);
+    };
+
+    // Chunks to load: in range but not tracked
+    auto& newChunks = loadScratch_;
+    newChunks.clear();
     for (int dz = -effectiveRadius; dz <= effectiveRadius; ++dz) {
         for (int dy = -effectiveRadius; dy <= effectiveRadius; ++dy) {
             for (int dx = -effectiveRadius; dx <= effectiveRadius; ++dx) {
-                desired.insert({centerCX + dx, centerCY + dy, centerCZ + dz});
+                ChunkCoord c{centerCX + dx, centerCY + dy, centerCZ + dz};
+                if (!tracked_.contains(c))
+                    newChunks.push_back(c);
             }
         }
     }
 
-    // Chunks to load: in desired but not tracked
-    std::vector<ChunkCoord> newChunks;
-    for (const auto& c : desired) {
-        if (!tracked_.contains(c))
-            newChunks.push_back(c);
-    }
-
     // Sort by distance to center (nearest first)
-    auto distSq = [&](const ChunkCoord& c) {
-        int dx = c.cx - centerCX;
-        int dy = c.cy - centerCY;
-        int dz = c.cz - centerCZ;
-        return dx * dx + dy * dy + dz * dz;
-    };
-    std::sort(newChunks.begin(), newChunks.end(),
-              [&](const ChunkCoord& a, const ChunkCoord& b) { return distSq(a) < distSq(b); });
-
-    // Chunks to unload: in tracked but not desired
-    std::vector<ChunkCoord> oldChunks;
+    std::sort(newChunks.begin(), newChunks.end(), [&](const ChunkCoord& a, const ChunkCoord& b) {
+        int da = distSq(a), db = distSq(b);
+        return da != db ? da < db : coordLess(a, b);
+    });
+
+    // Chunks to unload: tracked but out of range
+    auto& oldChunks = unloadScratch_;
+    oldChunks.clear();
     for (const auto& c : tracked_) {
-        if (!desired.contains(c))
+        if (!inRange(c))
             oldChunks.push_back(c);
     }
 
     // Sort by distance to center (farthest first)
-    std::sort(oldChunks.begin(), oldChunks.end(),
-              [&](const ChunkCoord& a, const ChunkCoord& b) { return distSq(a) > distSq(b); });
+    std::sort(oldChunks.begin(), oldChunks.end(), [&](const ChunkCoord& a, const ChunkCoord& b) {
+        int da = distSq(a), db = distSq(b);
+        return da != db ? da > db : coordLess(a, b);
+    });
+
+    int loadCount = std::min(static_cast<int>(newChunks.size()), config_.maxLoadsPerTick);
+    int unloadCount = std::min(static_cast<int>(oldChunks.size()), config_.maxUnloadsPerTick);
 
     StreamingUpdate result;
+    result.toLoad.reserve(static_cast<size_t>(loadCount));
+    result.toUnload.reserve(static_cast<size_t>(unloadCount));
 
-    int loadCount = std::min(static_cast<int>(newChunks.size()), config_.maxLoadsPerTick);
     for (int i = 0; i < loadCount; ++i) {
         result.toLoad.push_back(newChunks[static_cast<size_t>(i)]);
         tracked_.insert(newChunks[static_cast<size_t>(i)]);
     }
 
-    int unloadCount = std::min(static_cast<int>(oldChunks.size()), config_.maxUnloadsPerTick);
     for (int i = 0; i < unloadCount; ++i) {
         result.toUnload.push_back(oldChunks[static_cast<size_t>(i)]);
         tracked_.erase(oldChunks[static_cast<size_t>(i)]);
     }
 
+    if (updateTime_)
+        updateTime_->recordDuration(std::chrono::steady_clock::now() - start);
     return result;
 }
 
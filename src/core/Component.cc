@@ -1,10 +1,96 @@
 #include "fabric/core/Component.hh"
 #include "fabric/core/Log.hh"
 #include "fabric/utils/ErrorHandling.hh"
-#include <type_traits>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 namespace fabric {
 
+namespace {
+
+struct NameHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+};
+
+using NameMap = std::unordered_map<std::string, PropertyId, NameHash, std::equal_to<>>;
+
+struct PropertyRegistry {
+    std::shared_mutex mutex;
+    NameMap ids;
+    std::deque<std::string> names; // Indexed by id; deque keeps references stable
+};
+
+std::atomic<uint64_t> structureCounter{0};
+
+PropertyRegistry& registry() {
+    static PropertyRegistry instance;
+    return instance;
+}
+
+// Ids never change once interned, so each thread keeps the names it has
+// resolved and only touches the shared registry on its first sight of a name
+NameMap& threadCache() {
+    thread_local NameMap cache;
+    return cache;
+}
+
+std::optional<PropertyId> findShared(PropertyRegistry& reg, std::string_view name) {
+    std::shared_lock lock(reg.mutex);
+    auto it = reg.ids.find(name);
+    if (it == reg.ids.end())
+        return std::nullopt;
+    return it->second;
+}
+
+} // namespace
+
+PropertyId PropertyKey::intern(std::string_view name) {
+    auto& cache = threadCache();
+    if (auto cached = cache.find(name); cached != cache.end())
+        return cached->second;
+
+    auto& reg = registry();
+    PropertyId id;
+    if (auto shared = findShared(reg, name)) {
+        id = *shared;
+    } else {
+        std::unique_lock lock(reg.mutex);
+        auto it = reg.ids.find(name);
+        if (it != reg.ids.end()) {
+            id = it->second;
+        } else {
+            id = static_cast<PropertyId>(reg.names.size());
+            reg.names.emplace_back(name);
+            reg.ids.emplace(reg.names.back(), id);
+        }
+    }
+    cache.emplace(name, id);
+    return id;
+}
+
+std::optional<PropertyId> PropertyKey::find(std::string_view name) {
+    auto& cache = threadCache();
+    if (auto cached = cache.find(name); cached != cache.end())
+        return cached->second;
+
+    // Misses are not cached: another thread may intern the name later
+    auto id = findShared(registry(), name);
+    if (id)
+        cache.emplace(name, *id);
+    return id;
+}
+
+const std::string& PropertyKey::nameOf(PropertyId id) {
+    auto& reg = registry();
+    std::shared_lock lock(reg.mutex);
+    if (id >= reg.names.size())
+        throwError("Unknown property id " + std::to_string(id));
+    return reg.names[id];
+}
+
 Component::Component(const std::string& id) : id(id) {
     if (id.empty()) {
         throwError("Component ID cannot be empty");
@@ -15,14 +101,39 @@ const std::string& Component::getId() const {
     return id;
 }
 
+bool Component::hasProperty(PropertyKey key) const {
+    return findValue(key.id()) != nullptr;
+}
+
 bool Component::hasProperty(const std::string& name) const {
-    std::lock_guard<std::mutex> lock(propertiesMutex);
-    return properties.find(name) != properties.end();
+    auto key = PropertyKey::find(name);
+    return key && findValue(*key) != nullptr;
+}
+
+bool Component::removeProperty(PropertyKey key) {
+    return eraseValue(key.id());
 }
 
 bool Component::removeProperty(const std::string& name) {
-    std::lock_guard<std::mutex> lock(propertiesMutex);
-    return properties.erase(name) > 0;
+    auto key = PropertyKey::find(name);
+    return key && eraseValue(*key);
+}
+
+bool Component::eraseValue(PropertyId key) {
+    auto it = std::lower_bound(properties.begin(), properties.end(), key,
+                               [](const PropertyEntry& entry, PropertyId k) { return entry.first < k; });
+    if (it == properties.end() || it->first != key)
+        return false;
+    properties.erase(it);
+    return true;
+}
+
+void Component::throwMissingProperty(PropertyId key) const {
+    throwError("Property '" + PropertyKey::nameOf(key) + "' not found in component '" + id + "'");
+}
+
+void Component::throwWrongPropertyType(PropertyId key) const {
+    throwError("Property '" + PropertyKey::nameOf(key) + "' has incorrect type");
 }
 
 void Component::addChild(std::shared_ptr<Component> child) {
@@ -30,97 +141,47 @@ void Component::addChild(std::shared_ptr<Component> child) {
         throwError("Cannot add null child to component");
     }
 
-    std::lock_guard<std::mutex> lock(childrenMutex);
-
-    // Check for duplicate IDs
-    for (const auto& existingChild : children) {
-        if (existingChild->getId() == child->getId()) {
-            throwError("Child component with ID '" + child->getId() + "' already exists");
-        }
+    if (childIndex.contains(child->getId())) {
+        throwError("Child component with ID '" + child->getId() + "' already exists");
     }
 
-    children.push_back(child);
-    FABRIC_LOG_DEBUG("Added child '{}' to component '{}'", child->getId(), id);
+    childIndex.emplace(child->getId(), childList.size());
+    childList.push_back(std::move(child));
+    structureCounter.fetch_add(1, std::memory_order_relaxed);
+    FABRIC_LOG_DEBUG("Added child '{}' to component '{}'", childList.back()->getId(), id);
 }
 
 bool Component::removeChild(const std::string& childId) {
-    std::lock_guard<std::mutex> lock(childrenMutex);
-
-    auto it = std::find_if(children.begin(), children.end(),
-                           [&childId](const auto& child) { return child->getId() == childId; });
-
-    if (it != children.end()) {
-        children.erase(it);
-        FABRIC_LOG_DEBUG("Removed child '{}' from component '{}'", childId, id);
-        return true;
+    auto it = childIndex.find(childId);
+    if (it == childIndex.end()) {
+        return false;
     }
 
-    return false;
-}
-
-std::shared_ptr<Component> Component::getChild(const std::string& childId) const {
-    std::lock_guard<std::mutex> lock(childrenMutex);
-
-    auto it = std::find_if(children.begin(), children.end(),
-                           [&childId](const auto& child) { return child->getId() == childId; });
-
-    if (it != children.end()) {
-        return *it;
+    size_t index = it->second;
+    childIndex.erase(it);
+    // Keep the child alive until its id is no longer referenced by the index
+    auto removed = std::move(childList[index]);
+    childList.erase(childList.begin() + static_cast<std::ptrdiff_t>(index));
+    for (size_t i = index; i < childList.size(); ++i) {
+        childIndex[childList[i]->getId()] = i;
     }
+    structureCounter.fetch_add(1, std::memory_order_relaxed);
 
-    return nullptr;
+    FABRIC_LOG_DEBUG("Removed child '{}' from component '{}'", childId, id);
+    return true;
 }
 
-std::vector<std::shared_ptr<Component>> Component::getChildren() const {
-    std::lock_guard<std::mutex> lock(childrenMutex);
-    return children;
+std::shared_ptr<Component> Component::getChild(const std::string& childId) const {
+    auto it = childIndex.find(childId);
+    return it != childIndex.end() ? childList[it->second] : nullptr;
 }
 
-template <typename T> void Component::setProperty(const std::string& name, const T& value) {
-    static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
-                      std::is_same_v<T, double> || std::is_same_v<T, std::string> ||
-                      std::is_same_v<T, std::shared_ptr<Component>>,
-                  "Property type not supported. Must be one of the types in PropertyValue.");
-
-    std::lock_guard<std::mutex> lock(propertiesMutex);
-    properties[name] = value;
+uint64_t Component::structureEpoch() {
+    return structureCounter.load(std::memory_order_relaxed);
 }
 
-template <typename T> T Component::getProperty(const std::string& name) const {
-    static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
-                      std::is_same_v<T, double> || std::is_same_v<T, std::string> ||
-                      std::is_same_v<T, std::shared_ptr<Component>>,
-                  "Property type not supported. Must be one of the types in PropertyValue.");
-
-    std::lock_guard<std::mutex> lock(propertiesMutex);
-
-    auto it = properties.find(name);
-    if (it == properties.end()) {
-        throwError("Property '" + name + "' not found in component '" + id + "'");
-    }
-
-    try {
-        return std::get<T>(it->second);
-    } catch (const std::bad_variant_access&) {
-        throwError("Property '" + name + "' has incorrect type");
-        // This line is never reached due to throwError, but needed for compilation
-        return T();
-    }
+std::vector<std::shared_ptr<Component>> Component::getChildren() const {
+    return childList;
 }
 
-// Explicit template instantiations for common types
-template void Component::setProperty<int>(const std::string&, const int&);
-template void Component::setProperty<float>(const std::string&, const float&);
-template void Component::setProperty<double>(const std::string&, const double&);
-template void Component::setProperty<bool>(const std::string&, const bool&);
-template void Component::setProperty<std::string>(const std::string&, const std::string&);
-template void Component::setProperty<std::shared_ptr<Component>>(const std::string&, const std::shared_ptr<Component>&);
-
-template int Component::getProperty<int>(const std::string&) const;
-template float Component::getProperty<float>(const std::string&) const;
-template double Component::getProperty<double>(const std::string&) const;
-template bool Component::getProperty<bool>(const std::string&) const;
-template std::string Component::getProperty<std::string>(const std::string&) const;
-template std::shared_ptr<Component> Component::getProperty<std::shared_ptr<Component>>(const std::string&) const;
-
 } // namespace fabric
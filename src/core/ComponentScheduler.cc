@@ -0,0 +1,106 @@
+#include "fabric/core/ComponentScheduler.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/TaskGraph.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <algorithm>
+
+namespace fabric {
+
+ComponentScheduler::ComponentScheduler(std::shared_ptr<Component> root, Utils::ThreadPoolExecutor* workers)
+    : root_(std::move(root)), workers_(workers) {}
+
+void ComponentScheduler::setRoot(std::shared_ptr<Component> root) {
+    root_ = std::move(root);
+    dirty_ = true;
+}
+
+void ComponentScheduler::setWorkers(Utils::ThreadPoolExecutor* workers) {
+    workers_ = workers;
+    dirty_ = true;
+}
+
+void ComponentScheduler::setMinRangeSize(size_t nodes) {
+    minRangeSize_ = std::max<size_t>(nodes, 1);
+    dirty_ = true;
+}
+
+void ComponentScheduler::rebuild() {
+    records_.clear();
+    keepAlive_.clear();
+    spine_.clear();
+    ranges_.clear();
+    builtEpoch_ = Component::structureEpoch();
+    dirty_ = false;
+    ++rebuildCount_;
+
+    if (!root_) {
+        return;
+    }
+
+    // Pre-order flatten; subtreeEnd is patched once a node's descendants are placed
+    struct Frame {
+        uint32_t index;
+        size_t nextChild;
+    };
+    std::vector<Frame> stack;
+    records_.push_back({root_.get(), 0});
+    keepAlive_.push_back(root_);
+    stack.push_back({0, 0});
+
+    while (!stack.empty()) {
+        auto& frame = stack.back();
+        const auto& children = records_[frame.index].node->children();
+        if (frame.nextChild < children.size()) {
+            const auto& child = children[frame.nextChild++];
+            auto index = static_cast<uint32_t>(records_.size());
+            records_.push_back({child.get(), 0});
+            keepAlive_.push_back(child);
+            stack.push_back({index, 0});
+        } else {
+            records_[frame.index].subtreeEnd = static_cast<uint32_t>(records_.size());
+            stack.pop_back();
+        }
+    }
+
+    // A few ranges per thread so uneven subtrees still balance
+    size_t threads = workers_ ? workers_->getThreadCount() + 1 : 1;
+    size_t grain = std::max(minRangeSize_, records_.size() / (threads * 4));
+    partition(0, static_cast<uint32_t>(grain));
+
+    FABRIC_LOG_DEBUG("ComponentScheduler flattened {} nodes into {} serial and {} ranges", records_.size(),
+                     spine_.size(), ranges_.size());
+}
+
+void ComponentScheduler::partition(uint32_t index, uint32_t grain) {
+    uint32_t end = records_[index].subtreeEnd;
+    if (end - index <= grain || end == index + 1) {
+        ranges_.push_back({index, end});
+        return;
+    }
+
+    spine_.push_back(index);
+    for (uint32_t child = index + 1; child < end; child = records_[child].subtreeEnd) {
+        partition(child, grain);
+    }
+}
+
+void ComponentScheduler::runRange(Range range, float deltaTime) const {
+    for (uint32_t i = range.begin; i < range.end; ++i) {
+        records_[i].node->update(deltaTime);
+    }
+}
+
+void ComponentScheduler::update(float deltaTime) {
+    if (dirty_ || builtEpoch_ != Component::structureEpoch()) {
+        rebuild();
+    }
+
+    // Spine nodes are in pre-order and precede every range they parent
+    for (uint32_t index : spine_) {
+        records_[index].node->update(deltaTime);
+    }
+
+    parallelFor(ranges_.size(), workers_, [this, deltaTime](size_t r) { runRange(ranges_[r], deltaTime); });
+}
+
+} // namespace fabric
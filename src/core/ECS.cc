@@ -1,26 +1,199 @@
 #include "fabric/core/ECS.hh"
+#include "fabric/core/Rendering.hh"
 #include "fabric/core/Spatial.hh"
+#include "fabric/utils/ErrorHandling.hh"
 #include "fabric/utils/Profiler.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <utility>
 
 namespace fabric {
 
-World::World() : world_(new flecs::world()) {}
+// Singleton holding the phase-less systems behind updateWorldBounds, so
+// their cached queries are built once per world
+struct WorldBoundsSystems {
+    flecs::entity_t attach;
+    flecs::entity_t refresh;
+};
+
+// Singleton set by World::runFrame for the interpolation systems
+struct InterpolationAlpha {
+    float value;
+};
+
+namespace {
+
+// Slots in World::pipelines_, in run order
+enum PhaseSlot : size_t {
+    kInputPhase,
+    kSimulationPhase,
+    kTransformsPhase,
+    kBoundsPhase,
+    kCullingPhase,
+    kRenderExtractionPhase
+};
+
+Matrix4x4<float> localMatrix(const Position& pos, const Rotation& rot, const Scale& scl) {
+    Transform<float> t;
+    t.setPosition(Vector3<float, Space::World>(pos.x, pos.y, pos.z));
+    t.setRotation(Quaternion<float>(rot.x, rot.y, rot.z, rot.w));
+    t.setScale(Vector3<float, Space::World>(scl.x, scl.y, scl.z));
+    return t.getMatrix();
+}
+
+// Parent must already be up to date (CASCADE order)
+void composeWithParent(flecs::entity e, const Matrix4x4<float>& local, LocalToWorld& ltw) {
+    auto parent = e.parent();
+    if (parent.is_valid() && parent.has<LocalToWorld>()) {
+        Matrix4x4<float> parentMat(parent.get<LocalToWorld>().matrix);
+        ltw.matrix = (parentMat * local).elements;
+    } else {
+        ltw.matrix = local.elements;
+    }
+}
+
+// Systems within a phase run in registration order
+int compareEntityIds(flecs::entity_t a, const void*, flecs::entity_t b, const void*) {
+    return (a > b) - (a < b);
+}
+
+template <typename Phase> flecs::entity_t phasePipeline(flecs::world& world) {
+    return world.pipeline().with(flecs::System).with<Phase>().order_by(0, compareEntityIds).build().id();
+}
+
+PreviousTransform snapshot(const Position& pos, const Rotation& rot, const Scale& scl) {
+    return {pos, rot, scl};
+}
+
+// Blend one table's PreviousTransform toward Position/Rotation/Scale into
+// its RenderTransform column, through a per-thread SoA batch
+void interpolateTable(flecs::iter& it, float alpha) {
+    thread_local TransformBatch batch;
+    auto prev = it.field<const PreviousTransform>(0);
+    auto pos = it.field<const Position>(1);
+    auto rot = it.field<const Rotation>(2);
+    auto scl = it.field<const Scale>(3);
+    auto out = it.field<RenderTransform>(4);
+
+    size_t count = it.count();
+    for (size_t begin = 0; begin < count; begin += TransformBatch::kSliceSize) {
+        size_t n = std::min(TransformBatch::kSliceSize, count - begin);
+        batch.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            batch.setPrevious(i, prev[begin + i]);
+            batch.setCurrent(i, pos[begin + i], rot[begin + i], scl[begin + i]);
+        }
+        batch.interpolate(alpha, std::span<RenderTransform>(&out[begin], n));
+    }
+}
+
+float interpolationAlpha(flecs::iter& it) {
+    const auto* alpha = it.world().try_get<InterpolationAlpha>();
+    return alpha ? alpha->value : 1.0f;
+}
+
+WorldBounds localBounds(const BoundingBox& bb) {
+    return {bb.minX, bb.minY, bb.minZ, bb.maxX, bb.maxY, bb.maxZ};
+}
+
+// Transform the box center and project the half extents onto each world
+// axis; equivalent to refitting all eight transformed corners
+WorldBounds transformBounds(const BoundingBox& bb, const std::array<float, 16>& m) {
+    float cx = (bb.minX + bb.maxX) * 0.5f, cy = (bb.minY + bb.maxY) * 0.5f, cz = (bb.minZ + bb.maxZ) * 0.5f;
+    float ex = (bb.maxX - bb.minX) * 0.5f, ey = (bb.maxY - bb.minY) * 0.5f, ez = (bb.maxZ - bb.minZ) * 0.5f;
+
+    WorldBounds wb;
+    auto axis = [&](int row, float& lo, float& hi) {
+        float center = m[row] * cx + m[row + 4] * cy + m[row + 8] * cz + m[row + 12];
+        float extent = std::abs(m[row]) * ex + std::abs(m[row + 4]) * ey + std::abs(m[row + 8]) * ez;
+        lo = center - extent;
+        hi = center + extent;
+    };
+    axis(0, wb.minX, wb.maxX);
+    axis(1, wb.minY, wb.maxY);
+    axis(2, wb.minZ, wb.maxZ);
+    return wb;
+}
+
+WorldBoundsSystems worldBoundsSystems(flecs::world& world) {
+    if (const auto* systems = world.try_get<WorldBoundsSystems>())
+        return *systems;
+
+    world.component<WorldBounds>("WorldBounds");
+
+    WorldBoundsSystems systems{};
+    systems.attach = world.system<>("AttachWorldBounds")
+                         .with<BoundingBox>()
+                         .without<WorldBounds>()
+                         .kind(0)
+                         .each([](flecs::entity e) { e.add<WorldBounds>(); })
+                         .id();
+
+    // WorldBounds is [out] so this system's own writes don't count as changes;
+    // tables are skipped unless BoundingBox, LocalToWorld or membership changed
+    systems.refresh = world.system<const BoundingBox, const LocalToWorld, WorldBounds>("RefreshWorldBounds")
+                          .term_at(1)
+                          .optional()
+                          .term_at(2)
+                          .out()
+                          .detect_changes()
+                          .kind(0)
+                          .run([](flecs::iter& it) {
+                              while (it.next()) {
+                                  if (!it.changed()) {
+                                      it.skip();
+                                      continue;
+                                  }
+                                  auto bb = it.field<const BoundingBox>(0);
+                                  auto wb = it.field<WorldBounds>(2);
+                                  if (it.is_set(1)) {
+                                      auto ltw = it.field<const LocalToWorld>(1);
+                                      for (auto i : it)
+                                          wb[i] = transformBounds(bb[i], ltw[i].matrix);
+                                  } else {
+                                      for (auto i : it)
+                                          wb[i] = localBounds(bb[i]);
+                                  }
+                              }
+                          })
+                          .id();
+
+    world.set<WorldBoundsSystems>(systems);
+    return systems;
+}
+
+} // namespace
+
+World::World() : world_(new flecs::world()), commands_(std::make_unique<EntityCommandQueue>()) {}
 
 World::~World() {
     delete world_;
 }
 
-World::World(World&& other) noexcept : world_(other.world_) {
+World::World(World&& other) noexcept
+    : world_(other.world_),
+      commands_(std::move(other.commands_)),
+      pipelines_(other.pipelines_),
+      snapshotTransforms_(other.snapshotTransforms_),
+      fixedDt_(other.fixedDt_),
+      accumulator_(other.accumulator_) {
     other.world_ = nullptr;
+    other.pipelines_ = {};
 }
 
 World& World::operator=(World&& other) noexcept {
     if (this != &other) {
         delete world_;
         world_ = other.world_;
+        commands_ = std::move(other.commands_);
+        pipelines_ = other.pipelines_;
+        snapshotTransforms_ = other.snapshotTransforms_;
+        fixedDt_ = other.fixedDt_;
+        accumulator_ = other.accumulator_;
         other.world_ = nullptr;
+        other.pipelines_ = {};
     }
     return *this;
 }
@@ -43,7 +216,19 @@ void World::registerCoreComponents() {
     world_->component<Rotation>("Rotation");
     world_->component<Scale>("Scale");
     world_->component<BoundingBox>("BoundingBox");
+    world_->component<WorldBounds>("WorldBounds");
     world_->component<LocalToWorld>("LocalToWorld");
+    auto renderTransform = world_->component<RenderTransform>("RenderTransform");
+    auto previousTransform = world_->component<PreviousTransform>("PreviousTransform");
+    if (!previousTransform.has(flecs::With, renderTransform)) { // Hooks can only be set once
+        previousTransform.add(flecs::With, renderTransform).on_add([](flecs::entity e, PreviousTransform& prev) {
+            const auto* pos = e.try_get<Position>();
+            const auto* rot = e.try_get<Rotation>();
+            const auto* scl = e.try_get<Scale>();
+            if (pos && rot && scl)
+                prev = snapshot(*pos, *rot, *scl);
+        });
+    }
     world_->component<SceneEntity>("SceneEntity");
     world_->component<Renderable>("Renderable");
 }
@@ -60,24 +245,192 @@ void World::updateTransforms() {
                  .build();
 
     q.each([](flecs::entity e, const Position& pos, const Rotation& rot, const Scale& scl, LocalToWorld& ltw) {
-        // Compose local transform from Position * Rotation * Scale
-        Transform<float> t;
-        t.setPosition(Vector3<float, Space::World>(pos.x, pos.y, pos.z));
-        t.setRotation(Quaternion<float>(rot.x, rot.y, rot.z, rot.w));
-        t.setScale(Vector3<float, Space::World>(scl.x, scl.y, scl.z));
-        auto localMatrix = t.getMatrix();
-
-        auto parent = e.parent();
-        if (parent.is_valid() && parent.has<LocalToWorld>()) {
-            // Parent already processed (CASCADE guarantee): multiply parent * local
-            const auto& parentLtw = parent.get<LocalToWorld>();
-            Matrix4x4<float> parentMat(parentLtw.matrix);
-            auto worldMatrix = parentMat * localMatrix;
-            ltw.matrix = worldMatrix.elements;
-        } else {
-            ltw.matrix = localMatrix.elements;
-        }
+        composeWithParent(e, localMatrix(pos, rot, scl), ltw);
+    });
+}
+
+void World::updateWorldBounds() {
+    fabric::updateWorldBounds(*world_);
+}
+
+void updateWorldBounds(flecs::world& world) {
+    FABRIC_ZONE_SCOPED_N("ECS::updateWorldBounds");
+    auto systems = worldBoundsSystems(world);
+    // Attach first: entities that just gained a WorldBounds land in tables
+    // the refresh sees as changed
+    ecs_run(world.c_ptr(), systems.attach, 0.0f, nullptr);
+    ecs_run(world.c_ptr(), systems.refresh, 0.0f, nullptr);
+}
+
+void World::registerEnginePipeline(double fixedDt) {
+    if (pipelines_[kInputPhase])
+        throwError("World::registerEnginePipeline() called twice");
+    if (!(fixedDt > 0.0))
+        throwError("World::registerEnginePipeline() needs a positive fixed step");
+
+    fixedDt_ = fixedDt;
+    accumulator_ = 0.0;
+    pipelines_[kInputPhase] = phasePipeline<phase::Input>(*world_);
+    pipelines_[kSimulationPhase] = phasePipeline<phase::Simulation>(*world_);
+    pipelines_[kTransformsPhase] = phasePipeline<phase::Transforms>(*world_);
+    pipelines_[kBoundsPhase] = phasePipeline<phase::Bounds>(*world_);
+    pipelines_[kCullingPhase] = phasePipeline<phase::Culling>(*world_);
+    pipelines_[kRenderExtractionPhase] = phasePipeline<phase::RenderExtraction>(*world_);
+
+    // Both transform systems skip tables whose inputs did not change since
+    // their last run, which leaves LocalToWorld clean for RefreshWorldBounds.
+    // LocalToWorld is [out] so their own writes don't count as changes. Flecs
+    // change detection needs a plain query iterator, so roots run on the
+    // calling thread rather than on workers.
+    world_->system<const Position, const Rotation, const Scale, LocalToWorld>("RootTransforms")
+        .term_at(3)
+        .out()
+        .without(flecs::ChildOf, flecs::Wildcard)
+        .detect_changes()
+        .kind<phase::Transforms>()
+        .run([](flecs::iter& it) {
+            while (it.next()) {
+                if (!it.changed()) {
+                    it.skip();
+                    continue;
+                }
+                auto pos = it.field<const Position>(0);
+                auto rot = it.field<const Rotation>(1);
+                auto scl = it.field<const Scale>(2);
+                auto ltw = it.field<LocalToWorld>(3);
+                for (auto i : it)
+                    ltw[i].matrix = localMatrix(pos[i], rot[i], scl[i]).elements;
+            }
+        });
+
+    // Children run breadth first after every root. The parent's LocalToWorld,
+    // matched up ChildOf with cascade, orders them and counts as an input, so
+    // a child table is recomposed when it or its parent moved
+    world_->system<const Position, const Rotation, const Scale, LocalToWorld>("ChildTransforms")
+        .term_at(3)
+        .out()
+        .with<const LocalToWorld>()
+        .cascade()
+        .detect_changes()
+        .kind<phase::Transforms>()
+        .run([](flecs::iter& it) {
+            while (it.next()) {
+                if (!it.changed()) {
+                    it.skip();
+                    continue;
+                }
+                auto pos = it.field<const Position>(0);
+                auto rot = it.field<const Rotation>(1);
+                auto scl = it.field<const Scale>(2);
+                auto ltw = it.field<LocalToWorld>(3);
+                Matrix4x4<float> parentMat(it.field<const LocalToWorld>(4)[0].matrix);
+                for (auto i : it)
+                    ltw[i].matrix = (parentMat * localMatrix(pos[i], rot[i], scl[i])).elements;
+            }
+        });
+
+    // Captured before every fixed step by runFrame, so it stays out of any phase
+    snapshotTransforms_ =
+        world_->system<PreviousTransform, const Position, const Rotation, const Scale>("SnapshotTransforms")
+            .kind(0)
+            .each([](PreviousTransform& prev, const Position& pos, const Rotation& rot, const Scale& scl) {
+                prev = snapshot(pos, rot, scl);
+            })
+            .id();
+
+    // Registered here so they run ahead of any extraction system added later
+    world_->system<const PreviousTransform, const Position, const Rotation, const Scale, RenderTransform>(
+              "InterpolateRootTransforms")
+        .without(flecs::ChildOf, flecs::Wildcard)
+        .multi_threaded()
+        .kind<phase::RenderExtraction>()
+        .run([](flecs::iter& it) {
+            float alpha = interpolationAlpha(it);
+            while (it.next())
+                interpolateTable(it, alpha);
+        });
+
+    // Children blend their local transform, then take their parent's render
+    // matrix (or LocalToWorld when the parent is not interpolated)
+    world_->system<const PreviousTransform, const Position, const Rotation, const Scale, RenderTransform>(
+              "InterpolateChildTransforms")
+        .with<const LocalToWorld>()
+        .cascade()
+        .kind<phase::RenderExtraction>()
+        .run([](flecs::iter& it) {
+            float alpha = interpolationAlpha(it);
+            while (it.next()) {
+                interpolateTable(it, alpha);
+                auto out = it.field<RenderTransform>(4);
+                for (auto i : it) {
+                    auto parent = it.entity(i).parent();
+                    const auto* parentRender = parent.try_get<RenderTransform>();
+                    const auto* parentLtw = parent.try_get<LocalToWorld>();
+                    if (!parentRender && !parentLtw)
+                        continue;
+                    Matrix4x4<float> parentMat(parentRender ? parentRender->matrix : parentLtw->matrix);
+                    out[i].matrix = (parentMat * Matrix4x4<float>(out[i].matrix)).elements;
+                }
+            }
+        });
+
+    auto bounds = worldBoundsSystems(*world_);
+    world_->entity(bounds.attach).add<phase::Bounds>();
+    world_->entity(bounds.refresh).add<phase::Bounds>();
+}
+
+void World::setThreads(int32_t threads) {
+    world_->set_threads(threads);
+}
+
+size_t World::flushCommands() {
+    return commands_->flush(*world_);
+}
+
+int World::runFrame(double deltaTime) {
+    FABRIC_ZONE_SCOPED_N("ECS::runFrame");
+    if (!pipelines_[kInputPhase])
+        throwError("World::runFrame() called before registerEnginePipeline()");
+
+    flushCommands();
+
+    auto frameDt = static_cast<ecs_ftime_t>(deltaTime);
+    world_->run_pipeline(pipelines_[kInputPhase], frameDt);
+
+    accumulator_ += deltaTime;
+    int steps = 0;
+    while (accumulator_ >= fixedDt_) {
+        ecs_run(world_->c_ptr(), snapshotTransforms_, 0.0f, nullptr);
+        world_->run_pipeline(pipelines_[kSimulationPhase], static_cast<ecs_ftime_t>(fixedDt_));
+        accumulator_ -= fixedDt_;
+        ++steps;
+    }
+
+    world_->progress(frameDt);
+    world_->set<InterpolationAlpha>({static_cast<float>(fixedStepAlpha())});
+
+    for (size_t slot = kTransformsPhase; slot < kPhaseCount; ++slot)
+        world_->run_pipeline(pipelines_[slot], frameDt);
+    return steps;
+}
+
+void World::enableSystemStats() {
+    world_->import<flecs::stats>();
+    ecs_measure_system_time(world_->c_ptr(), true);
+}
+
+std::vector<SystemTiming> World::systemTimings() const {
+    std::vector<SystemTiming> timings;
+    auto q = world_->query_builder<>().with(flecs::System).build();
+    q.each([&](flecs::entity e) {
+        const ecs_system_t* system = ecs_system_get(world_->c_ptr(), e.id());
+        if (!system)
+            return;
+        const char* name = e.name().c_str();
+        timings.push_back({name && *name ? std::string(name) : "#" + std::to_string(e.id()),
+                           static_cast<double>(system->time_spent)});
     });
+    return timings;
 }
 
 flecs::entity World::createSceneEntity(const char* name) {
@@ -0,0 +1,170 @@
+#include "fabric/core/EntityCommands.hh"
+
+#include "fabric/utils/Profiler.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace fabric {
+
+EntityCommandBuffer::EntityCommandBuffer(uint64_t sortKey) : sortKey_(sortKey), arena_(kArenaCapacity) {}
+
+EntityCommandBuffer::~EntityCommandBuffer() {
+    clear();
+}
+
+DeferredEntity EntityCommandBuffer::create(const char* name) {
+    Command cmd{Op::Create, {}};
+    if (name) {
+        size_t len = std::strlen(name) + 1;
+        auto* copy = static_cast<char*>(arena_.allocate(len, 1));
+        std::memcpy(copy, name, len);
+        cmd.name = copy;
+    }
+    cmd.target.pending = created_++;
+    commands_.push_back(cmd);
+    return cmd.target;
+}
+
+void EntityCommandBuffer::destroy(DeferredEntity target) {
+    commands_.push_back({Op::Destroy, target});
+}
+
+void EntityCommandBuffer::childOf(DeferredEntity target, DeferredEntity parent) {
+    Command cmd{Op::ChildOf, target};
+    cmd.parent = parent;
+    commands_.push_back(cmd);
+}
+
+std::vector<flecs::entity> EntityCommandBuffer::apply(flecs::world& world, size_t* replayed) {
+    std::vector<flecs::entity> created;
+    created.reserve(created_);
+    size_t count = 0;
+
+    auto resolve = [&](DeferredEntity ref) -> flecs::entity {
+        if (ref.isPending() && ref.pending >= created.size())
+            return flecs::entity();
+        flecs::entity_t id = ref.isPending() ? created[ref.pending].id() : ref.id;
+        return id && world.is_alive(id) ? world.entity(id) : flecs::entity();
+    };
+
+    for (auto& cmd : commands_) {
+        if (cmd.op == Op::Create) {
+            created.push_back(cmd.name ? world.entity(cmd.name) : world.entity());
+            ++count;
+            continue;
+        }
+
+        flecs::entity target = resolve(cmd.target);
+        if (!target.is_valid())
+            continue;
+
+        switch (cmd.op) {
+            case Op::Destroy:
+                target.destruct();
+                ++count;
+                break;
+            case Op::ChildOf:
+                if (auto parent = resolve(cmd.parent); parent.is_valid()) {
+                    target.child_of(parent);
+                    ++count;
+                }
+                break;
+            case Op::Set:
+            case Op::Add:
+            case Op::Remove:
+                cmd.apply(target, cmd.payload);
+                ++count;
+                break;
+            case Op::Create:
+                break;
+        }
+    }
+
+    clear();
+    if (replayed)
+        *replayed = count;
+    return created;
+}
+
+void EntityCommandBuffer::clear() {
+    for (auto& cmd : commands_) {
+        if (cmd.drop)
+            cmd.drop(cmd.payload);
+    }
+    commands_.clear();
+    created_ = 0;
+    arena_.reset();
+}
+
+std::unique_ptr<EntityCommandBuffer> EntityCommandQueue::acquire(uint64_t sortKey) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            auto buffer = std::move(free_.back());
+            free_.pop_back();
+            buffer->setSortKey(sortKey);
+            return buffer;
+        }
+    }
+    return std::make_unique<EntityCommandBuffer>(sortKey);
+}
+
+void EntityCommandQueue::submit(std::unique_ptr<EntityCommandBuffer> buffer) {
+    if (!buffer)
+        return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    submitted_.push_back(std::move(buffer));
+}
+
+size_t EntityCommandQueue::flush(flecs::world& world) {
+    FABRIC_ZONE_SCOPED_N("EntityCommandQueue::flush");
+    std::vector<std::unique_ptr<EntityCommandBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers.swap(submitted_);
+    }
+    if (buffers.empty())
+        return 0;
+
+    // Buffers go back to the free list even if a command throws, with
+    // anything left unapplied dropped
+    struct Recycle {
+        EntityCommandQueue& queue;
+        std::vector<std::unique_ptr<EntityCommandBuffer>>& buffers;
+        ~Recycle() {
+            for (auto& buffer : buffers)
+                buffer->clear();
+            std::lock_guard<std::mutex> lock(queue.mutex_);
+            for (auto& buffer : buffers)
+                queue.free_.push_back(std::move(buffer));
+        }
+    } recycle{*this, buffers};
+
+    std::stable_sort(buffers.begin(), buffers.end(),
+                     [](const auto& a, const auto& b) { return a->sortKey() < b->sortKey(); });
+
+    // One defer block: adds and sets on the same entity batch into a single
+    // table move when the block ends. The guard ends it on every exit path.
+    struct DeferScope {
+        flecs::world& world;
+        explicit DeferScope(flecs::world& w) : world(w) { world.defer_begin(); }
+        ~DeferScope() { world.defer_end(); }
+    };
+
+    size_t applied = 0;
+    DeferScope defer(world);
+    for (auto& buffer : buffers) {
+        size_t replayed = 0;
+        buffer->apply(world, &replayed);
+        applied += replayed;
+    }
+    return applied;
+}
+
+size_t EntityCommandQueue::pendingBuffers() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return submitted_.size();
+}
+
+} // namespace fabric
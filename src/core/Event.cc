@@ -112,10 +112,12 @@ std::string EventDispatcher::addEventListener(const std::string& eventType, cons
 
     // Insert in priority-sorted order (lower priority first).
     // upper_bound preserves insertion order for equal priorities.
-    auto& vec = listeners[eventType];
-    auto pos = std::upper_bound(vec.begin(), vec.end(), entry,
+    auto& current = listeners[eventType];
+    auto vec = current ? std::make_shared<HandlerList>(*current) : std::make_shared<HandlerList>();
+    auto pos = std::upper_bound(vec->begin(), vec->end(), entry,
                                 [](const HandlerEntry& a, const HandlerEntry& b) { return a.priority < b.priority; });
-    vec.insert(pos, entry);
+    vec->insert(pos, entry);
+    current = std::move(vec);
 
     FABRIC_LOG_DEBUG("Added event listener for type '{}' with ID '{}' (priority {})", eventType, entry.id, priority);
 
@@ -130,12 +132,14 @@ bool EventDispatcher::removeEventListener(const std::string& eventType, const st
         return false;
     }
 
-    auto& handlers = it->second;
+    const auto& handlers = *it->second;
     auto handlerIt = std::find_if(handlers.begin(), handlers.end(),
                                   [&handlerId](const HandlerEntry& entry) { return entry.id == handlerId; });
 
     if (handlerIt != handlers.end()) {
-        handlers.erase(handlerIt);
+        auto vec = std::make_shared<HandlerList>(handlers);
+        vec->erase(vec->begin() + (handlerIt - handlers.begin()));
+        it->second = std::move(vec);
         FABRIC_LOG_DEBUG("Removed event listener for type '{}' with ID '{}'", eventType, handlerId);
         return true;
     }
@@ -144,7 +148,8 @@ bool EventDispatcher::removeEventListener(const std::string& eventType, const st
 }
 
 bool EventDispatcher::dispatchEvent(Event& event) {
-    std::vector<HandlerEntry> handlersToInvoke;
+    dispatched.fetch_add(1, std::memory_order_relaxed);
+    std::shared_ptr<const HandlerList> handlersToInvoke;
 
     {
         std::lock_guard<std::mutex> lock(listenersMutex);
@@ -159,7 +164,7 @@ bool EventDispatcher::dispatchEvent(Event& event) {
 
     bool handled = false;
 
-    for (const auto& entry : handlersToInvoke) {
+    for (const auto& entry : *handlersToInvoke) {
         try {
             entry.handler(event);
             if (event.isCancelled() || event.isHandled()) {
@@ -176,4 +181,8 @@ bool EventDispatcher::dispatchEvent(Event& event) {
     return handled;
 }
 
+uint64_t EventDispatcher::dispatchedCount() const {
+    return dispatched.load(std::memory_order_relaxed);
+}
+
 } // namespace fabric
@@ -5,14 +5,23 @@
 #include "fabric/core/ECS.hh"
 #include "fabric/core/Event.hh"
 #include "fabric/core/InputManager.hh"
+#include "fabric/core/InputRecorder.hh"
 #include "fabric/core/Log.hh"
+#include "fabric/core/MetricsServer.hh"
 #include "fabric/core/ResourceHub.hh"
 #include "fabric/core/SceneView.hh"
 #include "fabric/core/Spatial.hh"
+#include "fabric/core/Startup.hh"
 #include "fabric/core/Temporal.hh"
+#include "fabric/core/TextureLoader.hh"
 #include "fabric/parser/ArgumentParser.hh"
 #include "fabric/ui/BgfxRenderInterface.hh"
 #include "fabric/ui/BgfxSystemInterface.hh"
+#include "fabric/utils/AllocationTracker.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/FlightRecorder.hh"
+#include "fabric/utils/FrameArena.hh"
+#include "fabric/utils/MemoryHeaps.hh"
 #include "fabric/utils/Profiler.hh"
 
 #include <RmlUi/Core.h>
@@ -23,9 +32,13 @@
 #include <SDL3/SDL_main.h>
 #include <SDL3/SDL_properties.h>
 
+#include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <cmath>
 #include <iostream>
+#include <optional>
+#include <thread>
 
 namespace {
 
@@ -56,12 +69,20 @@ bgfx::PlatformData getPlatformData(SDL_Window* window) {
 } // namespace
 
 int main(int argc, char* argv[]) {
+    // Timeline origin; phases are added once the command line is handled
+    fabric::Startup startup;
     fabric::log::init();
     FABRIC_LOG_INFO("Starting {} {}", fabric::APP_NAME, fabric::APP_VERSION);
 
     fabric::ArgumentParser argParser;
     argParser.addArgument("--version", "Display version information");
     argParser.addArgument("--help", "Display help information");
+    argParser.addArgument("--metrics-port", "Serve Prometheus metrics on this port");
+    argParser.addArgument("--metrics-address", "Bind address for the metrics endpoint (default 127.0.0.1)");
+    argParser.addArgument("--flight-to-trace", "Convert a .fflight hitch record to Chrome trace JSON and exit");
+    argParser.addArgument("--record-input", "Record input to a .finput file for FabricSoak --replay");
+    argParser.addArgument("--system-stats", "Time every ECS system and log the totals on exit");
+    argParser.addArgument("--large-pages", "Back voxel chunk storage with large OS pages (mimalloc builds)");
     argParser.parse(argc, argv);
 
     if (argParser.hasArgument("--version")) {
@@ -75,89 +96,175 @@ int main(int argc, char* argv[]) {
         std::cout << "Options:" << std::endl;
         std::cout << "  --version    Display version information" << std::endl;
         std::cout << "  --help       Display this help message" << std::endl;
+        std::cout << "  --metrics-port <port>      Serve Prometheus metrics at /metrics" << std::endl;
+        std::cout << "  --metrics-address <addr>   Metrics bind address (default 127.0.0.1)" << std::endl;
+        std::cout << "  --flight-to-trace <file>   Convert a hitch record to <file>.json" << std::endl;
+        std::cout << "  --record-input <file>      Record input for replay with FabricSoak" << std::endl;
+        std::cout << "  --system-stats             Time every ECS system and log the totals on exit" << std::endl;
+        std::cout << "  --large-pages              Back chunk storage with large pages (mimalloc builds)" << std::endl;
         fabric::log::shutdown();
         return 0;
     }
 
-    try {
-        if (!SDL_Init(SDL_INIT_VIDEO)) {
-            FABRIC_LOG_CRITICAL("SDL init failed: {}", SDL_GetError());
-            fabric::log::shutdown();
-            return 1;
+    if (argParser.hasArgument("--flight-to-trace")) {
+        auto token = argParser.getArgument("--flight-to-trace");
+        bool converted = false;
+        if (token && std::holds_alternative<std::string>(token->value)) {
+            const auto& input = std::get<std::string>(token->value);
+            converted = fabric::FlightRecorder::convertToChromeTrace(input, input + ".json");
+            if (converted)
+                std::cout << "Wrote " << input << ".json" << std::endl;
         }
+        fabric::log::shutdown();
+        return converted ? 0 : 1;
+    }
+
+    try {
+        // Heaps belong to the thread that creates them, and startup phases run
+        // on workers, so create them here before anything can touch one
+        fabric::MemoryHeapConfig heapConfig;
+        heapConfig.chunkLargePages = argParser.hasArgument("--large-pages");
+        fabric::MemoryHeaps::configure(heapConfig);
 
         constexpr int kWindowWidth = 1280;
         constexpr int kWindowHeight = 720;
 
-        SDL_Window* window = SDL_CreateWindow(fabric::APP_NAME, kWindowWidth, kWindowHeight,
-                                              SDL_WINDOW_HIGH_PIXEL_DENSITY | SDL_WINDOW_RESIZABLE);
-
-        if (!window) {
-            FABRIC_LOG_CRITICAL("Window creation failed: {}", SDL_GetError());
-            SDL_Quit();
-            fabric::log::shutdown();
-            return 1;
-        }
-
-        // Signal single-threaded rendering before bgfx::init.
-        // On macOS Metal must stay on the main thread.
-        bgfx::renderFrame();
+        // Window, graphics and UI keep the main thread; phases with no thread
+        // affinity overlap with them on startup workers.
+        SDL_Window* window = nullptr;
+        bool bgfxReady = false;
+        int pw = kWindowWidth;
+        int ph = kWindowHeight;
+
+        startup.addPhase(
+            "sdl", {},
+            [&] {
+                if (!SDL_Init(SDL_INIT_VIDEO))
+                    fabric::throwError(std::string("SDL init failed: ") + SDL_GetError());
+
+                window = SDL_CreateWindow(fabric::APP_NAME, kWindowWidth, kWindowHeight,
+                                          SDL_WINDOW_HIGH_PIXEL_DENSITY | SDL_WINDOW_RESIZABLE);
+                if (!window)
+                    fabric::throwError(std::string("Window creation failed: ") + SDL_GetError());
+
+                SDL_GetWindowSizeInPixels(window, &pw, &ph);
+            },
+            fabric::StartupThread::Main);
+
+        startup.addPhase(
+            "bgfx", {"sdl"},
+            [&] {
+                // Signal single-threaded rendering before bgfx::init.
+                // On macOS Metal must stay on the main thread.
+                bgfx::renderFrame();
+
+                bgfx::Init bgfxInit;
+                bgfxInit.type = bgfx::RendererType::Count;
+                bgfxInit.platformData = getPlatformData(window);
+                bgfxInit.resolution.width = static_cast<uint32_t>(pw);
+                bgfxInit.resolution.height = static_cast<uint32_t>(ph);
+                bgfxInit.resolution.reset = BGFX_RESET_VSYNC;
+
+                if (!bgfx::init(bgfxInit))
+                    fabric::throwError("bgfx init failed");
+                bgfxReady = true;
+
+                bgfx::setViewClear(0, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, 0x303030ff, 1.0f, 0);
+                bgfx::setViewRect(0, 0, 0, static_cast<uint16_t>(pw), static_cast<uint16_t>(ph));
+
+                FABRIC_LOG_INFO("bgfx renderer: {}", bgfx::getRendererName(bgfx::getRendererType()));
+            },
+            fabric::StartupThread::Main);
+
+        // RmlUi backend interfaces. The texture loader starts its decode
+        // workers on the first request, not here.
+        fabric::BgfxSystemInterface rmlSystem;
+        fabric::TextureLoader textureLoader;
+        fabric::BgfxRenderInterface rmlRenderer;
+        Rml::Context* rmlContext = nullptr;
+
+        startup.addPhase(
+            "rmlui", {"bgfx"},
+            [&] {
+                textureLoader.init();
+                rmlRenderer.init();
+                rmlRenderer.setTextureLoader(&textureLoader);
+
+                Rml::SetSystemInterface(&rmlSystem);
+                Rml::SetRenderInterface(&rmlRenderer);
+                Rml::Initialise();
+
+                rmlContext = Rml::CreateContext("main", Rml::Vector2i(pw, ph));
+
+                FABRIC_LOG_INFO("RmlUi context created ({}x{})", pw, ph);
+            },
+            fabric::StartupThread::Main);
+
+        startup.addPhase("async", {}, [] { fabric::async::init(); });
+
+        std::optional<fabric::World> ecsWorld;
+        startup.addPhase("ecs", {}, [&] {
+            ecsWorld.emplace();
+            ecsWorld->registerCoreComponents();
+            ecsWorld->registerEnginePipeline();
+            if (argParser.hasArgument("--system-stats"))
+                ecsWorld->enableSystemStats();
+        });
 
-        int pw, ph;
-        SDL_GetWindowSizeInPixels(window, &pw, &ph);
+        // Subsystems unregister their metrics on destruction, so the registry
+        // is declared ahead of all of them and outlives every registration
+        fabric::MetricsRegistry metrics;
 
-        bgfx::Init bgfxInit;
-        bgfxInit.type = bgfx::RendererType::Count;
-        bgfxInit.platformData = getPlatformData(window);
-        bgfxInit.resolution.width = static_cast<uint32_t>(pw);
-        bgfxInit.resolution.height = static_cast<uint32_t>(ph);
-        bgfxInit.resolution.reset = BGFX_RESET_VSYNC;
+        std::optional<fabric::ResourceHub> resourceHub;
+        startup.addPhase("resources", {}, [&] {
+            resourceHub.emplace();
+            resourceHub->disableWorkerThreadsForTesting(); // no async loads yet
+        });
 
-        if (!bgfx::init(bgfxInit)) {
-            FABRIC_LOG_CRITICAL("bgfx init failed");
-            SDL_DestroyWindow(window);
+        try {
+            startup.run();
+        } catch (const std::exception& e) {
+            FABRIC_LOG_CRITICAL("Startup failed: {}", e.what());
+            if (bgfxReady)
+                bgfx::shutdown();
+            if (window)
+                SDL_DestroyWindow(window);
             SDL_Quit();
+            fabric::async::shutdown();
             fabric::log::shutdown();
             return 1;
         }
 
-        bgfx::setViewClear(0, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, 0x303030ff, 1.0f, 0);
-        bgfx::setViewRect(0, 0, 0, static_cast<uint16_t>(pw), static_cast<uint16_t>(ph));
-
-        FABRIC_LOG_INFO("bgfx renderer: {}", bgfx::getRendererName(bgfx::getRendererType()));
-
-        // RmlUi backend interfaces
-        fabric::BgfxSystemInterface rmlSystem;
-        fabric::BgfxRenderInterface rmlRenderer;
-        rmlRenderer.init();
-
-        Rml::SetSystemInterface(&rmlSystem);
-        Rml::SetRenderInterface(&rmlRenderer);
-        Rml::Initialise();
-
-        Rml::Context* rmlContext = Rml::CreateContext("main", Rml::Vector2i(pw, ph));
-
-        FABRIC_LOG_INFO("RmlUi context created ({}x{})", pw, ph);
-
-        fabric::async::init();
+        // Flecs workers for multi_threaded() systems; the main thread counts as one
+        ecsWorld->setThreads(static_cast<int32_t>(std::max(1u, std::thread::hardware_concurrency() / 2)));
 
         // Interactive subsystem setup
         fabric::EventDispatcher dispatcher;
         fabric::InputManager inputManager(dispatcher);
 
         // WASD + space/shift movement bindings
-        inputManager.bindKey("move_forward", SDLK_W);
-        inputManager.bindKey("move_backward", SDLK_S);
-        inputManager.bindKey("move_left", SDLK_A);
-        inputManager.bindKey("move_right", SDLK_D);
-        inputManager.bindKey("move_up", SDLK_SPACE);
-        inputManager.bindKey("move_down", SDLK_LSHIFT);
+        const fabric::ActionId moveForward = inputManager.bindKey("move_forward", SDLK_W);
+        const fabric::ActionId moveBackward = inputManager.bindKey("move_backward", SDLK_S);
+        const fabric::ActionId moveLeft = inputManager.bindKey("move_left", SDLK_A);
+        const fabric::ActionId moveRight = inputManager.bindKey("move_right", SDLK_D);
+        const fabric::ActionId moveUp = inputManager.bindKey("move_up", SDLK_SPACE);
+        const fabric::ActionId moveDown = inputManager.bindKey("move_down", SDLK_LSHIFT);
 
         // Time control bindings
         inputManager.bindKey("time_pause", SDLK_P);
         inputManager.bindKey("time_faster", SDLK_EQUALS);
         inputManager.bindKey("time_slower", SDLK_MINUS);
 
+#ifdef FABRIC_BUILTIN_PROFILER_ENABLED
+        FABRIC_SET_THREAD_NAME("main");
+        fabric::profiler::setHitchThreshold(50.0);
+        inputManager.bindKey("profiler_capture", SDLK_F12);
+        dispatcher.addEventListener("profiler_capture", [](fabric::Event&) {
+            if (fabric::profiler::exportChromeTrace(std::string("fabric_trace.json")))
+                FABRIC_LOG_INFO("Profiler trace written to fabric_trace.json");
+        });
+#endif
+
         fabric::Timeline timeline;
 
         dispatcher.addEventListener("time_pause", [&timeline](fabric::Event&) {
@@ -195,18 +302,66 @@ int main(int argc, char* argv[]) {
         fabric::Transform<float> cameraTransform;
         cameraTransform.setPosition(fabric::Vector3<float, fabric::Space::World>(0.0f, 0.0f, -5.0f));
         camera.updateView(cameraTransform);
+        auto previousCameraPosition = cameraTransform.getPosition(); // At the start of the latest fixed step
+
+        fabric::SceneView sceneView(0, camera, ecsWorld->get());
+
+        // Metrics, scraped through the async context polled in the fixed step
+        resourceHub->registerMetrics(metrics);
+        fabric::MemoryHeaps::registerMetrics(metrics);
+        metrics.gaugeCallback("fabric_texture_uploads_pending", "Textures decoded or decoding, not yet uploaded",
+                              [&textureLoader] { return static_cast<double>(textureLoader.pendingCount()); });
+        auto& frameTime = metrics.histogram("fabric_frame_seconds", "Wall time per rendered frame", 1e-9);
+        auto& tickTime = metrics.histogram("fabric_fixed_tick_seconds", "Wall time per fixed simulation step", 1e-9);
+        metrics.gaugeCallback("fabric_startup_seconds", "Time from launch to the first rendered frame (0 until then)",
+                              [&startup] { return std::chrono::duration<double>(startup.timeToFirstFrame()).count(); });
+
+        fabric::MetricsServer metricsServer(metrics);
+        if (argParser.hasArgument("--metrics-port") || argParser.hasArgument("--metrics-address")) {
+            auto stringArg = [&argParser](const std::string& name, const std::string& fallback) {
+                auto token = argParser.getArgument(name);
+                if (token && std::holds_alternative<std::string>(token->value))
+                    return std::get<std::string>(token->value);
+                return fallback;
+            };
+            auto portText = stringArg("--metrics-port", std::to_string(fabric::MetricsServer::kDefaultPort));
+            int port = 0;
+            auto [end, ec] = std::from_chars(portText.data(), portText.data() + portText.size(), port);
+            if (ec != std::errc() || end != portText.data() + portText.size() || port < 1 || port > 65535) {
+                FABRIC_LOG_ERROR("Invalid --metrics-port '{}' (expected 1-65535); metrics endpoint disabled",
+                                 portText);
+            } else {
+                metricsServer.start(stringArg("--metrics-address", "127.0.0.1"), static_cast<uint16_t>(port));
+            }
+        }
 
-        // ECS world setup
-        fabric::World ecsWorld;
-        ecsWorld.registerCoreComponents();
-        fabric::SceneView sceneView(0, camera, ecsWorld.get());
+        // Hitch flight recorder: last 10 s of frames, dumped around any frame over 50 ms
+        fabric::FlightRecorder flightRecorder;
+        auto inputZone = flightRecorder.addChannel("input", fabric::FlightChannelKind::Zone);
+        auto simulationZone = flightRecorder.addChannel("simulation", fabric::FlightChannelKind::Zone);
+        auto renderZone = flightRecorder.addChannel("render", fabric::FlightChannelKind::Zone);
+        flightRecorder.addSampledChannel("events", fabric::FlightChannelKind::Counter,
+                                         [&dispatcher] { return dispatcher.dispatchedCount(); });
+        flightRecorder.addSampledChannel("texture_uploads_pending", fabric::FlightChannelKind::Gauge,
+                                         [&textureLoader] { return textureLoader.pendingCount(); });
+        if (fabric::AllocationTracker::available()) {
+            flightRecorder.addSampledChannel("allocations", fabric::FlightChannelKind::Counter,
+                                             [] { return fabric::AllocationTracker::global().allocations; });
+        }
 
-        // Resource management
-        fabric::ResourceHub resourceHub;
-        resourceHub.disableWorkerThreadsForTesting(); // no async loads yet
+        // Input capture for deterministic replay (FabricSoak --replay)
+        std::optional<fabric::InputRecorder> inputRecorder;
+        std::string inputRecordPath;
+        if (argParser.hasArgument("--record-input")) {
+            auto token = argParser.getArgument("--record-input");
+            if (token && std::holds_alternative<std::string>(token->value)) {
+                inputRecordPath = std::get<std::string>(token->value);
+                inputRecorder.emplace();
+            }
+        }
 
         // Aggregate context for subsystem references
-        fabric::AppContext appContext{ecsWorld, timeline, dispatcher, resourceHub};
+        fabric::AppContext appContext{*ecsWorld, timeline, dispatcher, *resourceHub};
         (void)appContext; // will be threaded through systems in future passes
 
         // Camera control state
@@ -214,30 +369,19 @@ int main(int argc, char* argv[]) {
         constexpr float kMouseSensitivity = 0.002f;
         float cameraYaw = 0.0f;
         float cameraPitch = 0.0f;
-
-        FABRIC_LOG_INFO("Interactive systems initialized");
-
-        // Fixed-timestep main loop
-        constexpr double kFixedDt = 1.0 / 60.0;
-        double accumulator = 0.0;
-        auto lastTime = std::chrono::high_resolution_clock::now();
+        fabric::Quaternion<float> cameraRotation;
         bool running = true;
 
-        FABRIC_LOG_INFO("Entering main loop");
-
-        while (running) {
-            FABRIC_ZONE_SCOPED_N("main_loop");
-
-            auto now = std::chrono::high_resolution_clock::now();
-            double frameTime = std::chrono::duration<double>(now - lastTime).count();
-            lastTime = now;
-
-            if (frameTime > 0.25)
-                frameTime = 0.25;
-            accumulator += frameTime;
+        // Engine systems, run by World::runFrame in phase order. These are
+        // tasks (no query), so they stay on the main thread.
+        auto& flecsWorld = ecsWorld->get();
 
+        flecsWorld.system("PollInput").kind<fabric::phase::Input>().run([&](flecs::iter&) {
+            fabric::FlightRecorder::ScopedZone inputScope(flightRecorder, inputZone);
             SDL_Event event;
             while (SDL_PollEvent(&event)) {
+                if (inputRecorder)
+                    inputRecorder->record(event);
                 inputManager.processEvent(event);
 
                 if (event.type == SDL_EVENT_QUIT)
@@ -269,46 +413,92 @@ int main(int argc, char* argv[]) {
                 fabric::Vector3<float, fabric::Space::World>(0.0f, 1.0f, 0.0f), cameraYaw);
             auto pitchQ = fabric::Quaternion<float>::fromAxisAngle(
                 fabric::Vector3<float, fabric::Space::World>(1.0f, 0.0f, 0.0f), cameraPitch);
-            auto rotation = yawQ * pitchQ;
-            cameraTransform.setRotation(rotation);
-
-            while (accumulator >= kFixedDt) {
-                fabric::async::poll();
-                timeline.update(kFixedDt);
-
-                // Derive direction vectors inside the fixed step so movement
-                // stays consistent if rotation is ever updated per tick.
-                auto fwd = rotation.rotateVector(fabric::Vector3<float, fabric::Space::World>(0.0f, 0.0f, 1.0f));
-                auto right = rotation.rotateVector(fabric::Vector3<float, fabric::Space::World>(1.0f, 0.0f, 0.0f));
-                auto up = fabric::Vector3<float, fabric::Space::World>(0.0f, 1.0f, 0.0f);
-
-                float step = kMoveSpeed * static_cast<float>(kFixedDt);
-                auto pos = cameraTransform.getPosition();
-
-                if (inputManager.isActionActive("move_forward"))
-                    pos = pos + fwd * step;
-                if (inputManager.isActionActive("move_backward"))
-                    pos = pos - fwd * step;
-                if (inputManager.isActionActive("move_right"))
-                    pos = pos + right * step;
-                if (inputManager.isActionActive("move_left"))
-                    pos = pos - right * step;
-                if (inputManager.isActionActive("move_up"))
-                    pos = pos + up * step;
-                if (inputManager.isActionActive("move_down"))
-                    pos = pos - up * step;
-
-                cameraTransform.setPosition(pos);
-                accumulator -= kFixedDt;
-            }
+            cameraRotation = yawQ * pitchQ;
+            cameraTransform.setRotation(cameraRotation);
+        });
 
-            camera.updateView(cameraTransform);
+        flecsWorld.system("CameraMovement").kind<fabric::phase::Simulation>().run([&](flecs::iter&) {
+            fabric::FlightRecorder::ScopedZone simulationScope(flightRecorder, simulationZone);
+            auto tickStart = std::chrono::steady_clock::now();
+            double fixedDt = ecsWorld->fixedDt();
+            fabric::async::poll();
+            timeline.update(fixedDt);
+
+            // Derive direction vectors inside the fixed step so movement
+            // stays consistent if rotation is ever updated per tick.
+            auto fwd = cameraRotation.rotateVector(fabric::Vector3<float, fabric::Space::World>(0.0f, 0.0f, 1.0f));
+            auto right = cameraRotation.rotateVector(fabric::Vector3<float, fabric::Space::World>(1.0f, 0.0f, 0.0f));
+            auto up = fabric::Vector3<float, fabric::Space::World>(0.0f, 1.0f, 0.0f);
+
+            float step = kMoveSpeed * static_cast<float>(fixedDt);
+            auto pos = cameraTransform.getPosition();
+            previousCameraPosition = pos;
+
+            if (inputManager.isActionActive(moveForward))
+                pos = pos + fwd * step;
+            if (inputManager.isActionActive(moveBackward))
+                pos = pos - fwd * step;
+            if (inputManager.isActionActive(moveRight))
+                pos = pos + right * step;
+            if (inputManager.isActionActive(moveLeft))
+                pos = pos - right * step;
+            if (inputManager.isActionActive(moveUp))
+                pos = pos + up * step;
+            if (inputManager.isActionActive(moveDown))
+                pos = pos - up * step;
+
+            cameraTransform.setPosition(pos);
+            tickTime.recordDuration(std::chrono::steady_clock::now() - tickStart);
+        });
+
+        flecsWorld.system("SceneCull").kind<fabric::phase::Culling>().run([&](flecs::iter&) {
+            // Render the camera between its last two fixed steps, as the
+            // interpolation systems do for entities with PreviousTransform
+            fabric::Transform<float> renderCamera = cameraTransform;
+            renderCamera.setPosition(fabric::Vector3<float, fabric::Space::World>::lerp(
+                previousCameraPosition, cameraTransform.getPosition(), static_cast<float>(ecsWorld->fixedStepAlpha())));
+            camera.updateView(renderCamera);
+            sceneView.cull();
+        });
+
+        flecsWorld.system("SceneExtract").kind<fabric::phase::RenderExtraction>().run([&](flecs::iter&) {
+            sceneView.extract();
+        });
+
+        FABRIC_LOG_INFO("Interactive systems initialized");
+
+        auto lastTime = std::chrono::high_resolution_clock::now();
+
+        FABRIC_LOG_INFO("Entering main loop");
+
+        // Frame memory is rewound by the advance() at the top of every frame
+        fabric::FrameArenas::setEnabled(true);
+        while (running) {
+            FABRIC_ZONE_SCOPED_N("main_loop");
+            flightRecorder.beginFrame();
+            fabric::FrameArenas::advance();
+            [[maybe_unused]] uint64_t frameAllocationsStart = fabric::AllocationTracker::global().allocations;
+
+            auto now = std::chrono::high_resolution_clock::now();
+            frameTime.recordDuration(now - lastTime);
+            double frameSeconds = std::chrono::duration<double>(now - lastTime).count();
+            lastTime = now;
+
+            if (frameSeconds > 0.25)
+                frameSeconds = 0.25;
+            if (inputRecorder)
+                inputRecorder->beginFrame(frameSeconds);
+
+            // Input, fixed steps, transforms, bounds, culling, extraction
+            ecsWorld->runFrame(frameSeconds);
 
             inputManager.beginFrame();
 
             {
                 FABRIC_ZONE_SCOPED_N("render_submit");
-                sceneView.render();
+                fabric::FlightRecorder::ScopedZone renderScope(flightRecorder, renderZone);
+                textureLoader.processUploads();
+                sceneView.submit();
 
                 // RmlUi overlay on view 255 (after 3D scene, before frame flip)
                 int curW, curH;
@@ -316,17 +506,36 @@ int main(int argc, char* argv[]) {
                 rmlRenderer.beginFrame(static_cast<uint16_t>(curW), static_cast<uint16_t>(curH));
                 rmlContext->Update();
                 rmlContext->Render();
+                rmlRenderer.endFrame();
 
                 bgfx::frame();
             }
+            startup.markFirstFrame();
 
+            FABRIC_PLOT("allocations_per_frame",
+                        static_cast<int64_t>(fabric::AllocationTracker::global().allocations - frameAllocationsStart));
+            // Heaps belong to this thread; the metrics thread reads the sampled footprint
+            fabric::MemoryHeaps::sampleCommitted();
+            flightRecorder.endFrame();
             FABRIC_FRAME_MARK;
         }
 
         FABRIC_LOG_INFO("Shutting down");
 
+        if (argParser.hasArgument("--system-stats")) {
+            for (const auto& timing : ecsWorld->systemTimings())
+                FABRIC_LOG_INFO("System {}: {:.3f} ms", timing.name, timing.seconds * 1000.0);
+        }
+
+        if (inputRecorder && inputRecorder->save(inputRecordPath))
+            FABRIC_LOG_INFO("Recorded {} frames of input to {}", inputRecorder->frameCount(), inputRecordPath);
+
+        // A listening acceptor would keep async::shutdown() from draining
+        metricsServer.stop();
+
         Rml::Shutdown();
         rmlRenderer.shutdown();
+        textureLoader.shutdown();
 
         bgfx::shutdown();
         SDL_DestroyWindow(window);
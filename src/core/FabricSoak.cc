@@ -0,0 +1,435 @@
+// FabricSoak: deterministic headless soak run.
+//
+// Replays a recorded input session (or a built-in scripted flight) through
+// the fixed-timestep loop with bgfx's Noop renderer: terrain streams in and
+// out around the player, mouse clicks dig and place voxels, dirty chunks
+// re-mesh, and the scene view submits every frame. Reports frame-time
+// percentiles, heap allocations per frame (AllocationHooks.cc), peak RSS and
+// per-subsystem heap usage (MemoryHeaps).
+
+#include "fabric/core/Camera.hh"
+#include "fabric/core/CameraController.hh"
+#include "fabric/core/ChunkMeshManager.hh"
+#include "fabric/core/ChunkStreaming.hh"
+#include "fabric/core/ECS.hh"
+#include "fabric/core/Event.hh"
+#include "fabric/core/FlightController.hh"
+#include "fabric/core/InputManager.hh"
+#include "fabric/core/InputRecorder.hh"
+#include "fabric/core/InputRouter.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/core/SceneView.hh"
+#include "fabric/core/Simulation.hh"
+#include "fabric/core/VoxelInteraction.hh"
+#include "fabric/parser/ArgumentParser.hh"
+#include "fabric/utils/AllocationTracker.hh"
+#include "fabric/utils/FrameArena.hh"
+#include "fabric/utils/MemoryHeaps.hh"
+#include "fabric/utils/Metrics.hh"
+
+#include <bgfx/bgfx.h>
+#include <nlohmann/json.hpp>
+#include <SDL3/SDL.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+using fabric::InputSample;
+using fabric::InputSampleType;
+using fabric::Vec3f;
+
+constexpr double kFixedDt = 1.0 / 60.0;
+constexpr float kFlySpeed = 12.0f;
+constexpr float kEditReach = 24.0f;
+constexpr int kWindowWidth = 1280;
+constexpr int kWindowHeight = 720;
+
+// Scripted course, one frame per fixed tick: hold W, sweep the view left and
+// right, climb and descend, and alternate dig/place clicks.
+fabric::InputRecording scriptedFlight(size_t frameCount) {
+    fabric::InputRecording recording;
+    recording.frames.resize(frameCount);
+    const auto frameNs = static_cast<uint64_t>(kFixedDt * 1e9);
+
+    for (size_t f = 0; f < frameCount; ++f) {
+        auto& frame = recording.frames[f];
+        frame.dtNs = frameNs;
+        auto key = [&frame](InputSampleType type, SDL_Keycode code) {
+            frame.samples.push_back(InputSample{.type = type, .key = static_cast<uint32_t>(code)});
+        };
+        auto click = [&frame](uint8_t button) {
+            frame.samples.push_back(InputSample{.type = InputSampleType::MouseButtonDown, .button = button});
+            frame.samples.push_back(InputSample{.type = InputSampleType::MouseButtonUp, .button = button});
+        };
+
+        if (f == 0)
+            key(InputSampleType::KeyDown, SDLK_W);
+
+        float t = static_cast<float>(f);
+        frame.samples.push_back(InputSample{.type = InputSampleType::MouseMotion,
+                                            .dx = 6.0f * std::sin(t * 0.004f),
+                                            .dy = 1.5f * std::sin(t * 0.011f)});
+
+        if (f % 600 == 300)
+            key(InputSampleType::KeyDown, SDLK_SPACE);
+        if (f % 600 == 390)
+            key(InputSampleType::KeyUp, SDLK_SPACE);
+        if (f % 600 == 480)
+            key(InputSampleType::KeyDown, SDLK_LSHIFT);
+        if (f % 600 == 570)
+            key(InputSampleType::KeyUp, SDLK_LSHIFT);
+
+        if (f % 20 == 10)
+            click((f / 20) % 3 == 2 ? SDL_BUTTON_RIGHT : SDL_BUTTON_LEFT);
+
+        if (f + 1 == frameCount) {
+            key(InputSampleType::KeyUp, SDLK_W);
+            frame.samples.push_back(InputSample{.type = InputSampleType::Quit});
+        }
+    }
+    return recording;
+}
+
+// Rolling hills in chunk row y = 0; other rows stay air
+void generateChunk(fabric::SimulationHarness& world, int cx, int cy, int cz) {
+    if (cy != 0)
+        return;
+    auto& density = world.density();
+    auto& essence = world.essence();
+    const int x0 = cx * fabric::kChunkSize;
+    const int z0 = cz * fabric::kChunkSize;
+    for (int z = z0; z < z0 + fabric::kChunkSize; ++z) {
+        for (int x = x0; x < x0 + fabric::kChunkSize; ++x) {
+            float h = 12.0f + 6.0f * std::sin(static_cast<float>(x) * 0.07f) * std::cos(static_cast<float>(z) * 0.05f);
+            int height = static_cast<int>(h);
+            for (int y = 0; y < height; ++y) {
+                density.write(x, y, z, 1.0f);
+                bool topsoil = y + 3 >= height;
+                essence.write(x, y, z,
+                              topsoil ? fabric::Vector4<float, fabric::Space::World>(0.2f, 0.6f, 0.2f, 1.0f)
+                                      : fabric::Vector4<float, fabric::Space::World>(0.5f, 0.5f, 0.5f, 1.0f));
+            }
+        }
+    }
+}
+
+uint64_t peakResidentBytes() {
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+std::string stringArgument(const fabric::ArgumentParser& args, const std::string& name, const std::string& fallback) {
+    auto token = args.getArgument(name);
+    if (token && std::holds_alternative<std::string>(token->value))
+        return std::get<std::string>(token->value);
+    return fallback;
+}
+
+double toMs(uint64_t ns) {
+    return static_cast<double>(ns) * 1e-6;
+}
+
+double toMiB(uint64_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    fabric::log::init();
+
+    fabric::ArgumentParser argParser;
+    argParser.addArgument("--help", "Display help information");
+    argParser.addArgument("--replay", "Input recording (.finput) to replay");
+    argParser.addArgument("--frames", "Length of the built-in scripted flight (default 3600)");
+    argParser.addArgument("--warmup", "Frames excluded from the statistics (default 120)");
+    argParser.addArgument("--write-script", "Save the scripted flight as a recording and exit");
+    argParser.addArgument("--report", "Write the results as JSON");
+    argParser.parse(argc, argv);
+
+    if (argParser.hasArgument("--help")) {
+        std::cout << "Usage: FabricSoak [options]" << std::endl;
+        std::cout << "  --replay <file>         Replay a recording made with Fabric --record-input" << std::endl;
+        std::cout << "  --frames <n>            Scripted flight length when not replaying (default 3600)"
+                  << std::endl;
+        std::cout << "  --warmup <n>            Frames excluded from statistics (default 120)" << std::endl;
+        std::cout << "  --write-script <file>   Save the scripted flight and exit" << std::endl;
+        std::cout << "  --report <file>         Write results as JSON" << std::endl;
+        fabric::log::shutdown();
+        return 0;
+    }
+
+    fabric::InputRecording recording;
+    std::string source = "scripted";
+    if (argParser.hasArgument("--replay")) {
+        source = stringArgument(argParser, "--replay", "");
+        auto loaded = fabric::InputRecording::load(source);
+        if (!loaded) {
+            fabric::log::shutdown();
+            return 1;
+        }
+        recording = std::move(*loaded);
+    } else {
+        recording = scriptedFlight(static_cast<size_t>(std::stoul(stringArgument(argParser, "--frames", "3600"))));
+    }
+
+    if (argParser.hasArgument("--write-script")) {
+        bool saved = recording.save(stringArgument(argParser, "--write-script", "soak.finput"));
+        fabric::log::shutdown();
+        return saved ? 0 : 1;
+    }
+    const auto warmup = static_cast<size_t>(std::stoul(stringArgument(argParser, "--warmup", "120")));
+
+    // Heaps belong to the thread that creates them; create them here, as
+    // Fabric does, before the simulation starts any workers
+    fabric::MemoryHeaps::configure({});
+
+    // Same single-threaded bgfx setup as Fabric, minus the window
+    bgfx::renderFrame();
+    bgfx::Init bgfxInit;
+    bgfxInit.type = bgfx::RendererType::Noop;
+    bgfxInit.resolution.width = kWindowWidth;
+    bgfxInit.resolution.height = kWindowHeight;
+    bgfxInit.resolution.reset = BGFX_RESET_NONE;
+    if (!bgfx::init(bgfxInit)) {
+        FABRIC_LOG_CRITICAL("bgfx init failed");
+        fabric::log::shutdown();
+        return 1;
+    }
+    bgfx::setViewRect(0, 0, 0, kWindowWidth, kWindowHeight);
+
+    int exitCode = 0;
+    {
+        fabric::EventDispatcher dispatcher;
+        fabric::InputManager inputManager(dispatcher);
+        fabric::InputRouter inputRouter(inputManager);
+        const fabric::ActionId moveForward = inputManager.bindKey("move_forward", SDLK_W);
+        const fabric::ActionId moveBackward = inputManager.bindKey("move_backward", SDLK_S);
+        const fabric::ActionId moveLeft = inputManager.bindKey("move_left", SDLK_A);
+        const fabric::ActionId moveRight = inputManager.bindKey("move_right", SDLK_D);
+        const fabric::ActionId moveUp = inputManager.bindKey("move_up", SDLK_SPACE);
+        const fabric::ActionId moveDown = inputManager.bindKey("move_down", SDLK_LSHIFT);
+
+        fabric::SimulationHarness world;
+        fabric::VoxelInteraction interaction(world.density(), world.essence(), dispatcher);
+        fabric::ChunkMeshManager meshManager(dispatcher, world.density().grid(), world.essence().grid());
+
+        fabric::StreamingConfig streamingConfig;
+        streamingConfig.baseRadius = 3;
+        streamingConfig.maxRadius = 5;
+        streamingConfig.speedScale = 0.1f;
+        streamingConfig.maxLoadsPerTick = 8;
+        streamingConfig.maxUnloadsPerTick = 8;
+        fabric::ChunkStreamingManager streaming(streamingConfig);
+
+        fabric::Camera camera;
+        camera.setPerspective(60.0f, static_cast<float>(kWindowWidth) / static_cast<float>(kWindowHeight), 0.1f,
+                              1000.0f, bgfx::getCaps()->homogeneousDepth);
+        fabric::CameraController cameraController(camera);
+        cameraController.setPitch(25.0f); // Look down at the terrain ahead
+
+        fabric::FlightController flight(0.6f, 1.8f, 0.6f);
+        Vec3f position(16.0f, 24.0f, 16.0f);
+
+        fabric::World ecsWorld;
+        ecsWorld.registerCoreComponents();
+        fabric::SceneView sceneView(0, camera, ecsWorld.get());
+
+        fabric::InputReplayer replayer(std::move(recording));
+        std::vector<uint8_t> pendingClicks;
+        pendingClicks.reserve(8);
+        bool running = true;
+        auto sink = [&](const SDL_Event& event) {
+            inputRouter.routeEvent(event, nullptr);
+            if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN)
+                pendingClicks.push_back(event.button.button);
+            if (event.type == SDL_EVENT_QUIT)
+                running = false;
+        };
+
+        fabric::Histogram frameTime;
+        fabric::Histogram frameAllocations;
+        uint64_t framesRun = 0;
+        uint64_t ticks = 0;
+        uint64_t chunksLoaded = 0;
+        uint64_t chunksUnloaded = 0;
+        uint64_t edits = 0;
+        uint64_t remeshes = 0;
+        double accumulator = 0.0;
+
+        auto wallStart = std::chrono::steady_clock::now();
+        // Frame memory is rewound by the advance() at the top of every frame
+        fabric::FrameArenas::setEnabled(true);
+        while (running && !replayer.finished()) {
+            auto frameStart = std::chrono::steady_clock::now();
+            fabric::FrameArenas::advance();
+            uint64_t allocationsBefore = fabric::AllocationTracker::global().allocations;
+
+            double frameSeconds = replayer.nextFrame(sink);
+            if (frameSeconds > 0.25)
+                frameSeconds = 0.25;
+            accumulator += frameSeconds;
+
+            cameraController.processMouseInput(inputManager.mouseDeltaX(), inputManager.mouseDeltaY());
+
+            while (accumulator >= kFixedDt) {
+                world.tick(kFixedDt);
+
+                Vec3f fwd = cameraController.forward();
+                Vec3f right = cameraController.right();
+                Vec3f up(0.0f, 1.0f, 0.0f);
+                Vec3f velocity(0.0f, 0.0f, 0.0f);
+                if (inputManager.isActionActive(moveForward))
+                    velocity = velocity + fwd;
+                if (inputManager.isActionActive(moveBackward))
+                    velocity = velocity - fwd;
+                if (inputManager.isActionActive(moveRight))
+                    velocity = velocity + right;
+                if (inputManager.isActionActive(moveLeft))
+                    velocity = velocity - right;
+                if (inputManager.isActionActive(moveUp))
+                    velocity = velocity + up;
+                if (inputManager.isActionActive(moveDown))
+                    velocity = velocity - up;
+
+                auto displacement = velocity * (kFlySpeed * static_cast<float>(kFixedDt));
+                position = flight.move(position, displacement, world.density().grid()).resolvedPosition;
+
+                auto update = streaming.update(position.x, position.y, position.z, kFlySpeed);
+                for (const auto& c : update.toLoad) {
+                    generateChunk(world, c.cx, c.cy, c.cz);
+                    if (world.density().grid().hasChunk(c.cx, c.cy, c.cz))
+                        meshManager.markDirty(c.cx, c.cy, c.cz);
+                }
+                for (const auto& c : update.toUnload) {
+                    world.density().grid().removeChunk(c.cx, c.cy, c.cz);
+                    world.essence().grid().removeChunk(c.cx, c.cy, c.cz);
+                    meshManager.removeChunk(c.cx, c.cy, c.cz);
+                }
+                chunksLoaded += update.toLoad.size();
+                chunksUnloaded += update.toUnload.size();
+
+                auto eye = cameraController.position();
+                for (uint8_t button : pendingClicks) {
+                    auto result =
+                        button == SDL_BUTTON_RIGHT
+                            ? interaction.createMatterAt(world.density().grid(), eye.x, eye.y, eye.z, fwd.x, fwd.y,
+                                                         fwd.z, 1.0f, {0.6f, 0.4f, 0.2f, 1.0f}, kEditReach)
+                            : interaction.destroyMatterAt(world.density().grid(), eye.x, eye.y, eye.z, fwd.x, fwd.y,
+                                                          fwd.z, kEditReach);
+                    edits += result.success ? 1 : 0;
+                }
+                pendingClicks.clear();
+
+                remeshes += static_cast<uint64_t>(meshManager.update());
+                accumulator -= kFixedDt;
+                ++ticks;
+            }
+
+            cameraController.update(position, static_cast<float>(frameSeconds), &world.density().grid());
+            inputManager.beginFrame();
+
+            sceneView.render();
+            bgfx::frame();
+
+            if (framesRun++ >= warmup) {
+                frameTime.recordDuration(std::chrono::steady_clock::now() - frameStart);
+                frameAllocations.record(fabric::AllocationTracker::global().allocations - allocationsBefore);
+            }
+        }
+        double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+        uint64_t sampled = frameTime.count();
+        double meanAllocations =
+            sampled ? static_cast<double>(frameAllocations.sum()) / static_cast<double>(sampled) : 0.0;
+        uint64_t peakRss = peakResidentBytes();
+
+        std::printf("FabricSoak: %s, %llu frames, %llu ticks, %llu measured (%zu warmup)\n", source.c_str(),
+                    static_cast<unsigned long long>(framesRun), static_cast<unsigned long long>(ticks),
+                    static_cast<unsigned long long>(sampled), warmup);
+        std::printf("  frame ms      p50 %.3f  p90 %.3f  p99 %.3f  max %.3f\n", toMs(frameTime.percentile(0.5)),
+                    toMs(frameTime.percentile(0.9)), toMs(frameTime.percentile(0.99)), toMs(frameTime.max()));
+        std::printf("  allocs/frame  mean %.1f  p99 %llu  max %llu\n", meanAllocations,
+                    static_cast<unsigned long long>(frameAllocations.percentile(0.99)),
+                    static_cast<unsigned long long>(frameAllocations.max()));
+        std::printf("  peak RSS      %.1f MiB\n", toMiB(peakRss));
+        std::printf("  world         %llu loaded, %llu unloaded, %llu remeshed, %llu edits, %zu meshes\n",
+                    static_cast<unsigned long long>(chunksLoaded), static_cast<unsigned long long>(chunksUnloaded),
+                    static_cast<unsigned long long>(remeshes), static_cast<unsigned long long>(edits),
+                    meshManager.meshCount());
+        nlohmann::json heaps = nlohmann::json::object();
+        for (size_t i = 0; i < fabric::kMemoryHeapCount; ++i) {
+            auto heap = static_cast<fabric::MemoryHeap>(i);
+            auto stats = fabric::MemoryHeaps::stats(heap);
+            std::printf("  heap %-13s used %.1f MiB  peak %.1f MiB  committed %.1f MiB\n",
+                        fabric::MemoryHeaps::name(heap), toMiB(stats.usedBytes), toMiB(stats.peakUsedBytes),
+                        toMiB(stats.committedBytes));
+            heaps[fabric::MemoryHeaps::name(heap)] = {{"used_bytes", stats.usedBytes},
+                                                      {"peak_bytes", stats.peakUsedBytes},
+                                                      {"committed_bytes", stats.committedBytes}};
+        }
+        // Identical for identical input; a change means the simulation is no longer deterministic
+        std::printf("  end position  %.4f %.4f %.4f\n", position.x, position.y, position.z);
+        std::fflush(stdout);
+
+        if (argParser.hasArgument("--report")) {
+            auto reportPath = stringArgument(argParser, "--report", "soak.json");
+            nlohmann::json report = {
+                {"source", source},
+                {"frames", framesRun},
+                {"measured_frames", sampled},
+                {"ticks", ticks},
+                {"wall_seconds", wallSeconds},
+                {"frame_ms",
+                 {{"p50", toMs(frameTime.percentile(0.5))},
+                  {"p90", toMs(frameTime.percentile(0.9))},
+                  {"p99", toMs(frameTime.percentile(0.99))},
+                  {"max", toMs(frameTime.max())}}},
+                {"allocations_per_frame",
+                 {{"mean", meanAllocations},
+                  {"p99", frameAllocations.percentile(0.99)},
+                  {"max", frameAllocations.max()}}},
+                {"peak_rss_bytes", peakRss},
+                {"heaps", heaps},
+                {"chunks_loaded", chunksLoaded},
+                {"chunks_unloaded", chunksUnloaded},
+                {"remeshes", remeshes},
+                {"edits", edits},
+                {"end_position", {position.x, position.y, position.z}},
+            };
+            std::ofstream out(reportPath, std::ios::trunc);
+            if (out) {
+                out << report.dump(2) << std::endl;
+            } else {
+                FABRIC_LOG_ERROR("FabricSoak: cannot write {}", reportPath);
+                exitCode = 1;
+            }
+        }
+    }
+
+    bgfx::shutdown();
+    fabric::log::shutdown();
+    return exitCode;
+}
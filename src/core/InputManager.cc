@@ -1,19 +1,120 @@
 #include "fabric/core/InputManager.hh"
+#include "fabric/codec/Codec.hh"
 #include "fabric/core/Log.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <bit>
 
 namespace fabric {
 
+namespace {
+
+void writeBits(codec::ByteWriter& out, const ActionSet& bits, size_t count) {
+    for (size_t base = 0; base < count; base += 8) {
+        uint8_t byte = 0;
+        for (size_t i = 0; i < 8 && base + i < count; ++i) {
+            if (bits.test(base + i))
+                byte |= static_cast<uint8_t>(1u << i);
+        }
+        out.writeU8(byte);
+    }
+}
+
+ActionSet readBits(codec::ByteReader& in, size_t count) {
+    ActionSet bits;
+    for (size_t base = 0; base < count; base += 8) {
+        uint8_t byte = in.readU8();
+        for (size_t i = 0; i < 8 && base + i < count; ++i) {
+            if (byte & (1u << i))
+                bits.set(base + i);
+        }
+    }
+    return bits;
+}
+
+} // namespace
+
+void InputStateFrame::encode(codec::ByteWriter& out) const {
+    out.writeVarInt(actionCount);
+    writeBits(out, active, actionCount);
+    writeBits(out, pressed, actionCount);
+    writeBits(out, released, actionCount);
+    out.writeU32LE(std::bit_cast<uint32_t>(mouseDeltaX));
+    out.writeU32LE(std::bit_cast<uint32_t>(mouseDeltaY));
+    out.writeU8(mouseButtons);
+}
+
+InputStateFrame InputStateFrame::decode(codec::ByteReader& in) {
+    uint64_t count = in.readVarInt();
+    if (count > kMaxInputActions)
+        throwError("InputStateFrame: action count " + std::to_string(count) + " exceeds limit");
+
+    InputStateFrame frame;
+    frame.actionCount = static_cast<uint16_t>(count);
+    frame.active = readBits(in, count);
+    frame.pressed = readBits(in, count);
+    frame.released = readBits(in, count);
+    frame.mouseDeltaX = std::bit_cast<float>(in.readU32LE());
+    frame.mouseDeltaY = std::bit_cast<float>(in.readU32LE());
+    frame.mouseButtons = in.readU8();
+    return frame;
+}
+
+std::vector<uint8_t> InputStateFrame::serialize() const {
+    codec::ByteWriter out(16 + 3 * ((actionCount + 7) / 8));
+    encode(out);
+    return out.data();
+}
+
+InputStateFrame InputStateFrame::deserialize(std::span<const uint8_t> data) {
+    codec::ByteReader in(data);
+    return decode(in);
+}
+
 InputManager::InputManager() = default;
 
 InputManager::InputManager(EventDispatcher& dispatcher) : dispatcher_(&dispatcher) {}
 
-void InputManager::bindKey(const std::string& action, SDL_Keycode key) {
-    keyBindings_[key] = action;
+ActionId InputManager::actionId(const std::string& action) {
+    auto it = actionIds_.find(action);
+    if (it != actionIds_.end())
+        return it->second;
+
+    if (actions_.size() >= kMaxInputActions)
+        throwError("InputManager: more than " + std::to_string(kMaxInputActions) + " actions");
+
+    auto id = static_cast<ActionId>(actions_.size());
+    actions_.push_back({action, action + ":released"});
+    actionIds_.emplace(action, id);
+    return id;
+}
+
+std::optional<ActionId> InputManager::findAction(const std::string& action) const {
+    auto it = actionIds_.find(action);
+    if (it == actionIds_.end())
+        return std::nullopt;
+    return it->second;
+}
+
+const std::string& InputManager::actionName(ActionId id) const {
+    if (id >= actions_.size())
+        throwError("InputManager: unknown action id " + std::to_string(id));
+    return actions_[id].name;
+}
+
+ActionId InputManager::bindKey(const std::string& action, SDL_Keycode key) {
+    ActionId id = actionId(action);
+    keyBindings_[key] = id;
+    return id;
 }
 
 void InputManager::unbindKey(const std::string& action) {
+    auto id = findAction(action);
+    if (!id)
+        return;
+
     for (auto it = keyBindings_.begin(); it != keyBindings_.end();) {
-        if (it->second == action) {
+        if (it->second == *id) {
             it = keyBindings_.erase(it);
         } else {
             ++it;
@@ -31,11 +132,12 @@ bool InputManager::processEvent(const SDL_Event& event) {
             if (it == keyBindings_.end())
                 return false;
 
-            const auto& action = it->second;
-            activeActions_.insert(action);
+            ActionId id = it->second;
+            active_.set(id);
+            pressed_.set(id);
 
             if (dispatcher_) {
-                Event e(action, "InputManager");
+                Event e(actions_[id].name, "InputManager");
                 dispatcher_->dispatchEvent(e);
             }
             return true;
@@ -46,11 +148,12 @@ bool InputManager::processEvent(const SDL_Event& event) {
             if (it == keyBindings_.end())
                 return false;
 
-            const auto& action = it->second;
-            activeActions_.erase(action);
+            ActionId id = it->second;
+            active_.reset(id);
+            released_.set(id);
 
             if (dispatcher_) {
-                Event e(action + ":released", "InputManager");
+                Event e(actions_[id].releasedName, "InputManager");
                 dispatcher_->dispatchEvent(e);
             }
             return true;
@@ -109,10 +212,43 @@ bool InputManager::mouseButton(int button) const {
 void InputManager::beginFrame() {
     mouseDeltaX_ = 0;
     mouseDeltaY_ = 0;
+    previous_ = active_;
+    pressed_.reset();
+    released_.reset();
 }
 
 bool InputManager::isActionActive(const std::string& action) const {
-    return activeActions_.count(action) > 0;
+    auto id = findAction(action);
+    return id && active_.test(*id);
+}
+
+InputStateFrame InputManager::captureFrame() const {
+    InputStateFrame frame;
+    frame.actionCount = static_cast<uint16_t>(actions_.size());
+    frame.active = active_;
+    frame.pressed = pressed_;
+    frame.released = released_;
+    frame.mouseDeltaX = mouseDeltaX_;
+    frame.mouseDeltaY = mouseDeltaY_;
+    for (size_t i = 0; i < mouseButtons_.size(); ++i) {
+        if (mouseButtons_[i])
+            frame.mouseButtons |= static_cast<uint8_t>(1u << i);
+    }
+    return frame;
+}
+
+void InputManager::applyFrame(const InputStateFrame& frame) {
+    if (frame.actionCount > actions_.size())
+        FABRIC_LOG_WARN("InputManager: frame has {} actions, only {} are bound", frame.actionCount, actions_.size());
+
+    active_ = frame.active;
+    pressed_ = frame.pressed;
+    released_ = frame.released;
+    mouseDeltaX_ = frame.mouseDeltaX;
+    mouseDeltaY_ = frame.mouseDeltaY;
+    for (size_t i = 0; i < mouseButtons_.size(); ++i) {
+        mouseButtons_[i] = (frame.mouseButtons >> i) & 1u;
+    }
 }
 
 } // namespace fabric
@@ -0,0 +1,260 @@
+#include "fabric/core/InputRecorder.hh"
+#include "fabric/codec/Codec.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+namespace fabric {
+
+namespace {
+
+constexpr char kMagic[4] = {'F', 'I', 'N', 'P'};
+
+void writeFloat(codec::ByteWriter& out, float value) {
+    out.writeU32LE(std::bit_cast<uint32_t>(value));
+}
+
+float readFloat(codec::ByteReader& in) {
+    return std::bit_cast<float>(in.readU32LE());
+}
+
+} // namespace
+
+std::optional<InputSample> InputSample::fromEvent(const SDL_Event& event) {
+    InputSample sample;
+    switch (event.type) {
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP:
+            if (event.key.repeat)
+                return std::nullopt;
+            sample.type = event.type == SDL_EVENT_KEY_DOWN ? InputSampleType::KeyDown : InputSampleType::KeyUp;
+            sample.key = static_cast<uint32_t>(event.key.key);
+            sample.mod = static_cast<uint16_t>(event.key.mod);
+            return sample;
+
+        case SDL_EVENT_MOUSE_MOTION:
+            sample.type = InputSampleType::MouseMotion;
+            sample.x = event.motion.x;
+            sample.y = event.motion.y;
+            sample.dx = event.motion.xrel;
+            sample.dy = event.motion.yrel;
+            return sample;
+
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+            sample.type = event.type == SDL_EVENT_MOUSE_BUTTON_DOWN ? InputSampleType::MouseButtonDown
+                                                                    : InputSampleType::MouseButtonUp;
+            sample.button = event.button.button;
+            sample.x = event.button.x;
+            sample.y = event.button.y;
+            return sample;
+
+        case SDL_EVENT_QUIT:
+            sample.type = InputSampleType::Quit;
+            return sample;
+
+        default:
+            return std::nullopt;
+    }
+}
+
+SDL_Event InputSample::toEvent() const {
+    SDL_Event event = {};
+    switch (type) {
+        case InputSampleType::KeyDown:
+        case InputSampleType::KeyUp:
+            event.type = type == InputSampleType::KeyDown ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+            event.key.key = static_cast<SDL_Keycode>(key);
+            event.key.mod = static_cast<SDL_Keymod>(mod);
+            event.key.down = type == InputSampleType::KeyDown;
+            event.key.repeat = false;
+            break;
+
+        case InputSampleType::MouseMotion:
+            event.type = SDL_EVENT_MOUSE_MOTION;
+            event.motion.x = x;
+            event.motion.y = y;
+            event.motion.xrel = dx;
+            event.motion.yrel = dy;
+            break;
+
+        case InputSampleType::MouseButtonDown:
+        case InputSampleType::MouseButtonUp:
+            event.type = type == InputSampleType::MouseButtonDown ? SDL_EVENT_MOUSE_BUTTON_DOWN
+                                                                  : SDL_EVENT_MOUSE_BUTTON_UP;
+            event.button.button = button;
+            event.button.down = type == InputSampleType::MouseButtonDown;
+            event.button.x = x;
+            event.button.y = y;
+            break;
+
+        case InputSampleType::Quit:
+            event.type = SDL_EVENT_QUIT;
+            break;
+    }
+    return event;
+}
+
+std::vector<uint8_t> InputRecording::serialize() const {
+    codec::ByteWriter out(16 + frames.size() * 4 + sampleCount() * 8);
+    out.writeBytes(std::span(reinterpret_cast<const uint8_t*>(kMagic), sizeof(kMagic)));
+    out.writeU32LE(kFileVersion);
+    out.writeVarInt(frames.size());
+
+    for (const auto& frame : frames) {
+        out.writeVarInt(frame.dtNs);
+        out.writeVarInt(frame.samples.size());
+        for (const auto& sample : frame.samples) {
+            out.writeU8(static_cast<uint8_t>(sample.type));
+            switch (sample.type) {
+                case InputSampleType::KeyDown:
+                case InputSampleType::KeyUp:
+                    out.writeU32LE(sample.key);
+                    out.writeU16LE(sample.mod);
+                    break;
+                case InputSampleType::MouseMotion:
+                    writeFloat(out, sample.x);
+                    writeFloat(out, sample.y);
+                    writeFloat(out, sample.dx);
+                    writeFloat(out, sample.dy);
+                    break;
+                case InputSampleType::MouseButtonDown:
+                case InputSampleType::MouseButtonUp:
+                    out.writeU8(sample.button);
+                    writeFloat(out, sample.x);
+                    writeFloat(out, sample.y);
+                    break;
+                case InputSampleType::Quit:
+                    break;
+            }
+        }
+    }
+    return out.data();
+}
+
+InputRecording InputRecording::deserialize(std::span<const uint8_t> data) {
+    codec::ByteReader in(data);
+    bool hasMagic = in.remaining() >= sizeof(kMagic) &&
+                    std::memcmp(in.readBytes(sizeof(kMagic)).data(), kMagic, sizeof(kMagic)) == 0;
+    if (!hasMagic)
+        throwError("InputRecording: not an input recording");
+    uint32_t version = in.readU32LE();
+    if (version != kFileVersion)
+        throwError("InputRecording: unsupported version " + std::to_string(version));
+
+    InputRecording recording;
+    uint64_t frameCount = in.readVarInt();
+    // Every frame takes at least two bytes, so a corrupt count can't force a huge reserve
+    if (frameCount > in.remaining() / 2)
+        throwError("InputRecording: frame count exceeds data");
+    recording.frames.resize(frameCount);
+
+    for (auto& frame : recording.frames) {
+        frame.dtNs = in.readVarInt();
+        uint64_t sampleCount = in.readVarInt();
+        if (sampleCount > in.remaining())
+            throwError("InputRecording: sample count exceeds data");
+        frame.samples.resize(sampleCount);
+
+        for (auto& sample : frame.samples) {
+            uint8_t type = in.readU8();
+            if (type > static_cast<uint8_t>(InputSampleType::Quit))
+                throwError("InputRecording: unknown sample type " + std::to_string(type));
+            sample.type = static_cast<InputSampleType>(type);
+            switch (sample.type) {
+                case InputSampleType::KeyDown:
+                case InputSampleType::KeyUp:
+                    sample.key = in.readU32LE();
+                    sample.mod = in.readU16LE();
+                    break;
+                case InputSampleType::MouseMotion:
+                    sample.x = readFloat(in);
+                    sample.y = readFloat(in);
+                    sample.dx = readFloat(in);
+                    sample.dy = readFloat(in);
+                    break;
+                case InputSampleType::MouseButtonDown:
+                case InputSampleType::MouseButtonUp:
+                    sample.button = in.readU8();
+                    sample.x = readFloat(in);
+                    sample.y = readFloat(in);
+                    break;
+                case InputSampleType::Quit:
+                    break;
+            }
+        }
+    }
+    return recording;
+}
+
+bool InputRecording::save(const std::string& path) const {
+    auto bytes = serialize();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+        FABRIC_LOG_ERROR("InputRecording: cannot write {}", path);
+        return false;
+    }
+    return true;
+}
+
+std::optional<InputRecording> InputRecording::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        FABRIC_LOG_ERROR("InputRecording: cannot open {}", path);
+        return std::nullopt;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    try {
+        return deserialize(bytes);
+    } catch (const FabricException& e) {
+        FABRIC_LOG_ERROR("{}: {}", path, e.what());
+        return std::nullopt;
+    }
+}
+
+double InputRecording::durationSeconds() const {
+    uint64_t total = 0;
+    for (const auto& frame : frames)
+        total += frame.dtNs;
+    return static_cast<double>(total) * 1e-9;
+}
+
+size_t InputRecording::sampleCount() const {
+    size_t total = 0;
+    for (const auto& frame : frames)
+        total += frame.samples.size();
+    return total;
+}
+
+void InputRecorder::beginFrame(double dtSeconds) {
+    auto& frame = recording_.frames.emplace_back();
+    frame.dtNs = static_cast<uint64_t>(dtSeconds * 1e9 + 0.5);
+}
+
+void InputRecorder::record(const SDL_Event& event) {
+    auto sample = InputSample::fromEvent(event);
+    if (!sample)
+        return;
+    // Events polled before the first beginFrame() belong to a zero-length frame
+    if (recording_.frames.empty())
+        recording_.frames.emplace_back();
+    recording_.frames.back().samples.push_back(*sample);
+}
+
+InputReplayer::InputReplayer(InputRecording recording) : recording_(std::move(recording)) {}
+
+double InputReplayer::nextFrame(const EventSink& sink) {
+    if (finished())
+        return 0.0;
+    const auto& frame = recording_.frames[next_++];
+    for (const auto& sample : frame.samples)
+        sink(sample.toEvent());
+    return static_cast<double>(frame.dtNs) * 1e-9;
+}
+
+} // namespace fabric
@@ -0,0 +1,162 @@
+#include "fabric/core/MetricsServer.hh"
+#include "fabric/core/Async.hh"
+#include "fabric/core/Log.hh"
+
+#include <asio/buffer.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/read_until.hpp>
+#include <asio/write.hpp>
+
+#include <atomic>
+
+namespace fabric {
+
+// Shared with the accept and connection coroutines so they can finish
+// safely after the server object is gone
+struct MetricsServer::State {
+    explicit State(asio::io_context& context, const MetricsRegistry& registry)
+        : acceptor(context), registry(&registry) {}
+
+    asio::ip::tcp::acceptor acceptor;
+    const MetricsRegistry* registry;
+    std::atomic<uint64_t> requests{0};
+};
+
+namespace {
+
+std::string httpResponse(std::string_view status, std::string_view contentType, const std::string& body) {
+    std::string response;
+    response.reserve(body.size() + 160);
+    response += "HTTP/1.1 ";
+    response += status;
+    response += "\r\nContent-Type: ";
+    response += contentType;
+    response += "\r\nContent-Length: ";
+    response += std::to_string(body.size());
+    response += "\r\nConnection: close\r\n\r\n";
+    response += body;
+    return response;
+}
+
+asio::awaitable<void> serveConnection(std::shared_ptr<MetricsServer::State> state, asio::ip::tcp::socket socket) {
+    std::string request;
+    auto [readError, length] = co_await asio::async_read_until(
+        socket, asio::dynamic_buffer(request, MetricsServer::kMaxRequestBytes), "\r\n\r\n", async::use_nothrow);
+    if (readError)
+        co_return;
+
+    std::string response;
+    if (state->registry) {
+        response = MetricsServer::buildResponse(std::string_view(request).substr(0, length), *state->registry);
+        state->requests.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        response = httpResponse("503 Service Unavailable", "text/plain", "stopped\n");
+    }
+
+    co_await asio::async_write(socket, asio::buffer(response), async::use_nothrow);
+
+    asio::error_code ignored;
+    socket.shutdown(asio::ip::tcp::socket::shutdown_both, ignored);
+}
+
+asio::awaitable<void> acceptLoop(std::shared_ptr<MetricsServer::State> state) {
+    while (state->acceptor.is_open()) {
+        auto [ec, socket] = co_await state->acceptor.async_accept(async::use_nothrow);
+        if (ec) {
+            if (ec == asio::error::operation_aborted)
+                co_return;
+            continue;
+        }
+        asio::co_spawn(state->acceptor.get_executor(), serveConnection(state, std::move(socket)), asio::detached);
+    }
+}
+
+} // namespace
+
+MetricsServer::MetricsServer(MetricsRegistry& registry) : MetricsServer(registry, async::context()) {}
+
+MetricsServer::MetricsServer(MetricsRegistry& registry, asio::io_context& context)
+    : registry_(registry), context_(context) {}
+
+MetricsServer::~MetricsServer() {
+    stop();
+}
+
+bool MetricsServer::start(const std::string& address, uint16_t port) {
+    stop();
+
+    asio::error_code ec;
+    auto ip = asio::ip::make_address(address, ec);
+    if (ec) {
+        FABRIC_LOG_ERROR("MetricsServer: invalid bind address '{}': {}", address, ec.message());
+        return false;
+    }
+
+    auto state = std::make_shared<State>(context_, registry_);
+    asio::ip::tcp::endpoint endpoint(ip, port);
+    state->acceptor.open(endpoint.protocol(), ec);
+    if (!ec)
+        state->acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true), ec);
+    if (!ec)
+        state->acceptor.bind(endpoint, ec);
+    if (!ec)
+        state->acceptor.listen(asio::socket_base::max_listen_connections, ec);
+    if (ec) {
+        FABRIC_LOG_ERROR("MetricsServer: cannot listen on {}:{}: {}", address, port, ec.message());
+        return false;
+    }
+
+    state_ = state;
+    asio::co_spawn(context_, acceptLoop(state_), asio::detached);
+    FABRIC_LOG_INFO("MetricsServer: serving http://{}:{}/metrics", address, this->port());
+    return true;
+}
+
+void MetricsServer::stop() {
+    if (!state_)
+        return;
+    state_->registry = nullptr;
+    asio::error_code ignored;
+    state_->acceptor.close(ignored);
+    state_.reset();
+}
+
+bool MetricsServer::running() const {
+    return state_ && state_->acceptor.is_open();
+}
+
+uint16_t MetricsServer::port() const {
+    if (!running())
+        return 0;
+    asio::error_code ec;
+    auto endpoint = state_->acceptor.local_endpoint(ec);
+    return ec ? 0 : endpoint.port();
+}
+
+uint64_t MetricsServer::requestCount() const {
+    return state_ ? state_->requests.load(std::memory_order_relaxed) : 0;
+}
+
+std::string MetricsServer::buildResponse(std::string_view request, const MetricsRegistry& registry) {
+    auto lineEnd = request.find("\r\n");
+    std::string_view line = request.substr(0, lineEnd);
+
+    auto methodEnd = line.find(' ');
+    auto pathEnd = methodEnd == std::string_view::npos ? std::string_view::npos : line.find(' ', methodEnd + 1);
+    if (pathEnd == std::string_view::npos)
+        return httpResponse("400 Bad Request", "text/plain", "bad request\n");
+
+    std::string_view method = line.substr(0, methodEnd);
+    std::string_view path = line.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+    if (auto query = path.find('?'); query != std::string_view::npos)
+        path = path.substr(0, query);
+
+    if (path != "/metrics")
+        return httpResponse("404 Not Found", "text/plain", "not found\n");
+    if (method != "GET")
+        return httpResponse("405 Method Not Allowed", "text/plain", "method not allowed\n");
+
+    return httpResponse("200 OK", "text/plain; version=0.0.4; charset=utf-8", registry.renderPrometheus());
+}
+
+} // namespace fabric
@@ -0,0 +1,68 @@
+// MimallocHeaps.cc
+// Installs a MemoryHeaps backend that gives each engine heap its own
+// mi_heap_t. Linked into executables that link mimalloc-static; FabricLib
+// itself never references mimalloc, so tests keep the system allocator.
+#include "fabric/core/Log.hh"
+#include "fabric/utils/MemoryHeaps.hh"
+
+#include <mimalloc.h>
+
+namespace {
+
+class MimallocHeapResource : public fabric::HeapResource {
+  public:
+    explicit MimallocHeapResource(mi_arena_id_t arena, bool inArena) : arena_(arena), inArena_(inArena) {
+        heap_ = create();
+    }
+
+    const char* backendName() const override { return inArena_ ? "mimalloc-large" : "mimalloc"; }
+
+  protected:
+    void* allocateBlock(size_t bytes, size_t alignment) override {
+        return mi_heap_malloc_aligned(heap_, bytes, alignment);
+    }
+
+    void freeBlock(void* p, size_t, size_t) override { mi_free(p); }
+
+    void releaseAll() override {
+        mi_heap_destroy(heap_);
+        heap_ = create();
+    }
+
+    uint64_t measureCommitted() const override {
+        uint64_t committed = 0;
+        mi_heap_visit_blocks(
+            heap_, false,
+            [](const mi_heap_t*, const mi_heap_area_t* area, void*, size_t, void* arg) {
+                *static_cast<uint64_t*>(arg) += area->committed;
+                return true;
+            },
+            &committed);
+        return committed;
+    }
+
+  private:
+    mi_heap_t* create() const { return inArena_ ? mi_heap_new_in_arena(arena_) : mi_heap_new(); }
+
+    mi_heap_t* heap_ = nullptr;
+    mi_arena_id_t arena_;
+    bool inArena_;
+};
+
+std::unique_ptr<fabric::HeapResource> createMimallocHeap(fabric::MemoryHeap heap,
+                                                         const fabric::MemoryHeapConfig& config) {
+    mi_arena_id_t arena{};
+    bool inArena = false;
+    if (heap == fabric::MemoryHeap::ChunkStorage && config.chunkLargePages) {
+        // Exclusive arena so only chunk storage lands on the large pages
+        inArena = mi_reserve_os_memory_ex(config.chunkReserveBytes, false, true, true, &arena) == 0;
+        if (!inArena)
+            FABRIC_LOG_WARN("Could not reserve {} bytes of large-page memory; chunk storage uses regular pages",
+                            config.chunkReserveBytes);
+    }
+    return std::make_unique<MimallocHeapResource>(arena, inArena);
+}
+
+[[maybe_unused]] const bool backendInstalled = (fabric::MemoryHeaps::installBackend(&createMimallocHeap), true);
+
+} // namespace
@@ -1,6 +1,8 @@
 #include "fabric/core/Plugin.hh"
 #include "fabric/core/Log.hh"
 #include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/ImmutableDAG.hh"
+#include "fabric/utils/TaskGraph.hh"
 #include <algorithm>
 #include <vector>
 
@@ -115,9 +117,80 @@ std::unordered_map<std::string, std::shared_ptr<Plugin>> PluginManager::getPlugi
     return loadedPlugins; // Return a copy for thread safety
 }
 
-bool PluginManager::initializeAll() {
+PluginManager::PluginList PluginManager::dependencyOrder(PluginList plugins, std::vector<std::vector<size_t>>* dependents,
+                                                       std::vector<size_t>* dependencyCounts,
+                                                       std::vector<bool>* missing) {
+    // Sort by name so independent plugins keep a stable order across runs
+    std::sort(plugins.begin(), plugins.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::unordered_map<std::string, size_t> indexByName;
+    ImmutableDAG<size_t> graph;
+    for (size_t i = 0; i < plugins.size(); ++i) {
+        indexByName.emplace(plugins[i].first, i);
+        graph.addNode(i);
+    }
+
+    std::vector<bool> missingByIndex(plugins.size(), false);
+    for (size_t i = 0; i < plugins.size(); ++i) {
+        const auto& [name, plugin] = plugins[i];
+        if (!plugin) {
+            continue;
+        }
+        for (const auto& dependency : plugin->getDependencies()) {
+            auto it = indexByName.find(dependency);
+            if (it == indexByName.end()) {
+                FABRIC_LOG_ERROR("Plugin '{}' depends on '{}', which is not loaded", name, dependency);
+                missingByIndex[i] = true;
+                continue;
+            }
+            if (it->second == i) {
+                throwError("Plugin '" + name + "' depends on itself");
+            }
+            if (!graph.isReachable(it->second, i)) {
+                graph.addEdge(it->second, i); // Throws on a cycle
+            }
+        }
+    }
+
+    auto order = graph.topologicalSort();
+    std::vector<size_t> position(order.size());
+    for (size_t k = 0; k < order.size(); ++k) {
+        position[order[k]] = k;
+    }
+
+    PluginList sorted;
+    sorted.reserve(order.size());
+    if (dependents) {
+        dependents->assign(order.size(), {});
+    }
+    if (dependencyCounts) {
+        dependencyCounts->assign(order.size(), 0);
+    }
+    if (missing) {
+        missing->assign(order.size(), false);
+    }
+
+    for (size_t k = 0; k < order.size(); ++k) {
+        NodeId node = order[k];
+        sorted.push_back(std::move(plugins[node]));
+        if (dependents) {
+            for (NodeId child : graph.getChildren(node)) {
+                (*dependents)[k].push_back(position[child]);
+            }
+        }
+        if (dependencyCounts) {
+            (*dependencyCounts)[k] = graph.getParents(node).size();
+        }
+        if (missing) {
+            (*missing)[k] = missingByIndex[node];
+        }
+    }
+    return sorted;
+}
+
+bool PluginManager::initializeAll(Utils::ThreadPoolExecutor* workers) {
     // Create a copy of the plugins to avoid holding the lock during initialization
-    std::vector<std::pair<std::string, std::shared_ptr<Plugin>>> plugins;
+    PluginList plugins;
 
     {
         std::lock_guard<std::mutex> lock(pluginMutex);
@@ -127,38 +200,83 @@ bool PluginManager::initializeAll() {
         }
     }
 
-    bool success = true;
+    TaskGraph graph;
+    try {
+        plugins = dependencyOrder(std::move(plugins), &graph.dependents, &graph.dependencyCounts, &graph.blocked);
+    } catch (const std::exception& e) {
+        FABRIC_LOG_ERROR("Cannot order plugins for initialization: {}", e.what());
+        return false;
+    }
+
+    const size_t count = plugins.size();
+    std::vector<PluginInitTiming> timings(count);
+    for (size_t i = 0; i < count; ++i) {
+        timings[i].name = plugins[i].first;
+    }
+
+    auto initStart = std::chrono::steady_clock::now();
+
+    // Each task writes only its own timing slot
+    graph.run = [&](size_t i) {
+        const auto& [name, plugin] = plugins[i];
+        auto& timing = timings[i];
+        auto begin = std::chrono::steady_clock::now();
+        timing.start = begin - initStart;
 
-    for (const auto& [name, plugin] : plugins) {
         if (!plugin) {
             FABRIC_LOG_ERROR("Null plugin reference for '{}'", name);
-            success = false;
-            continue;
+        } else {
+            try {
+                timing.success = plugin->initialize();
+                if (!timing.success) {
+                    FABRIC_LOG_ERROR("Failed to initialize plugin '{}'", name);
+                }
+            } catch (const std::exception& e) {
+                FABRIC_LOG_ERROR("Exception initializing plugin '{}': {}", name, e.what());
+            } catch (...) {
+                FABRIC_LOG_ERROR("Unknown exception initializing plugin '{}'", name);
+            }
         }
 
-        try {
-            if (!plugin->initialize()) {
-                FABRIC_LOG_ERROR("Failed to initialize plugin '{}'", name);
-                success = false;
-            } else {
-                FABRIC_LOG_INFO("Initialized plugin '{}'", name);
-            }
-        } catch (const std::exception& e) {
-            FABRIC_LOG_ERROR("Exception initializing plugin '{}': {}", name, e.what());
-            success = false;
-        } catch (...) {
-            FABRIC_LOG_ERROR("Unknown exception initializing plugin '{}'", name);
-            success = false;
+        timing.duration = std::chrono::steady_clock::now() - begin;
+        if (timing.success) {
+            FABRIC_LOG_INFO("Initialized plugin '{}' in {:.2f} ms", name,
+                            std::chrono::duration<double, std::milli>(timing.duration).count());
         }
+        return timing.success;
+    };
+    graph.skip = [&](size_t i) {
+        FABRIC_LOG_ERROR("Skipping plugin '{}': a dependency is missing or failed", plugins[i].first);
+        timings[i].skipped = true;
+    };
+
+    auto completionOrder = runTaskGraph(graph, workers);
+
+    bool success = true;
+    std::vector<PluginInitTiming> ordered;
+    ordered.reserve(count);
+    for (size_t i : completionOrder) {
+        success = success && timings[i].success;
+        ordered.push_back(std::move(timings[i]));
     }
 
+    FABRIC_LOG_INFO("Initialized {} plugins in {:.2f} ms", count,
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - initStart).count());
+
+    {
+        std::lock_guard<std::mutex> lock(pluginMutex);
+        initTimings = std::move(ordered);
+    }
     return success;
 }
 
+std::vector<PluginInitTiming> PluginManager::getInitTimings() const {
+    std::lock_guard<std::mutex> lock(pluginMutex);
+    return initTimings;
+}
+
 void PluginManager::shutdownAll() {
-    // Copy all plugins to a vector for shutdown
-    // This allows us to control shutdown order and handle dependencies
-    std::vector<std::pair<std::string, std::shared_ptr<Plugin>>> plugins;
+    PluginList plugins;
 
     {
         std::lock_guard<std::mutex> lock(pluginMutex);
@@ -171,10 +289,14 @@ void PluginManager::shutdownAll() {
         loadedPlugins.clear();
     }
 
-    // NOTE: This reversal does not guarantee dependency-correct shutdown order.
-    // Plugins are stored in an unordered_map, so iteration order (and therefore
-    // reversal order) is implementation-defined and unrelated to load sequence.
-    // Proper dependency-ordered shutdown requires an explicit dependency graph.
+    try {
+        plugins = dependencyOrder(std::move(plugins), nullptr, nullptr, nullptr);
+    } catch (const std::exception& e) {
+        // The list was sorted by name before the cycle was found
+        FABRIC_LOG_WARN("Shutting down plugins without dependency order: {}", e.what());
+    }
+
+    // Dependents first, then the plugins they rely on
     std::reverse(plugins.begin(), plugins.end());
 
     for (const auto& [name, plugin] : plugins) {
@@ -1,5 +1,4 @@
 #include "fabric/core/Rendering.hh"
-#include "fabric/core/ECS.hh"
 #include "fabric/utils/Profiler.hh"
 #include <cmath>
 
@@ -115,7 +114,11 @@ void RenderList::clear() {
     drawCalls_.clear();
 }
 
-const std::vector<DrawCall>& RenderList::drawCalls() const {
+void RenderList::reserve(size_t count) {
+    drawCalls_.reserve(count);
+}
+
+const std::pmr::vector<DrawCall>& RenderList::drawCalls() const {
     return drawCalls_;
 }
 
@@ -142,60 +145,188 @@ Transform<float> TransformInterpolator::interpolate(const Transform<float>& prev
     return result;
 }
 
+// TransformBatch
+
+void TransformBatch::resize(size_t count) {
+    count_ = count;
+    data_.resize(2 * kLaneCount * count);
+}
+
+void TransformBatch::setPrevious(size_t i, const PreviousTransform& prev) {
+    previous(kPx)[i] = prev.position.x;
+    previous(kPy)[i] = prev.position.y;
+    previous(kPz)[i] = prev.position.z;
+    previous(kRx)[i] = prev.rotation.x;
+    previous(kRy)[i] = prev.rotation.y;
+    previous(kRz)[i] = prev.rotation.z;
+    previous(kRw)[i] = prev.rotation.w;
+    previous(kSx)[i] = prev.scale.x;
+    previous(kSy)[i] = prev.scale.y;
+    previous(kSz)[i] = prev.scale.z;
+}
+
+void TransformBatch::setCurrent(size_t i, const Position& pos, const Rotation& rot, const Scale& scl) {
+    current(kPx)[i] = pos.x;
+    current(kPy)[i] = pos.y;
+    current(kPz)[i] = pos.z;
+    current(kRx)[i] = rot.x;
+    current(kRy)[i] = rot.y;
+    current(kRz)[i] = rot.z;
+    current(kRw)[i] = rot.w;
+    current(kSx)[i] = scl.x;
+    current(kSy)[i] = scl.y;
+    current(kSz)[i] = scl.z;
+}
+
+void TransformBatch::interpolate(float alpha, std::span<RenderTransform> out) {
+    FABRIC_ZONE_SCOPED_N("TransformBatch::interpolate");
+    const size_t n = count_;
+
+    // Lerp every position and scale lane; results overwrite the previous lanes
+    for (Lane lane : {kPx, kPy, kPz, kSx, kSy, kSz}) {
+        float* a = previous(lane);
+        const float* b = current(lane);
+        for (size_t i = 0; i < n; ++i)
+            a[i] += alpha * (b[i] - a[i]);
+    }
+
+    // Nlerp along the shorter arc: flip the target when the dot is negative
+    float* ax = previous(kRx);
+    float* ay = previous(kRy);
+    float* az = previous(kRz);
+    float* aw = previous(kRw);
+    const float* bx = current(kRx);
+    const float* by = current(kRy);
+    const float* bz = current(kRz);
+    const float* bw = current(kRw);
+    for (size_t i = 0; i < n; ++i) {
+        float dot = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i] + aw[i] * bw[i];
+        float t = dot < 0.0f ? -alpha : alpha;
+        float s = 1.0f - alpha;
+        float x = s * ax[i] + t * bx[i];
+        float y = s * ay[i] + t * by[i];
+        float z = s * az[i] + t * bz[i];
+        float w = s * aw[i] + t * bw[i];
+        float lenSq = x * x + y * y + z * z + w * w;
+        float inv = lenSq > 0.0f ? 1.0f / std::sqrt(lenSq) : 0.0f;
+        ax[i] = x * inv;
+        ay[i] = y * inv;
+        az[i] = z * inv;
+        aw[i] = w * inv;
+    }
+
+    // T * R * S, as Matrix4x4::translation/rotation/scaling compose it
+    const float* px = previous(kPx);
+    const float* py = previous(kPy);
+    const float* pz = previous(kPz);
+    const float* sx = previous(kSx);
+    const float* sy = previous(kSy);
+    const float* sz = previous(kSz);
+    for (size_t i = 0; i < n; ++i) {
+        float xx = ax[i] * ax[i], yy = ay[i] * ay[i], zz = az[i] * az[i];
+        float xy = ax[i] * ay[i], xz = ax[i] * az[i], yz = ay[i] * az[i];
+        float xw = ax[i] * aw[i], yw = ay[i] * aw[i], zw = az[i] * aw[i];
+
+        auto& m = out[i].matrix;
+        m[0] = (1.0f - 2.0f * (yy + zz)) * sx[i];
+        m[1] = 2.0f * (xy + zw) * sx[i];
+        m[2] = 2.0f * (xz - yw) * sx[i];
+        m[3] = 0.0f;
+        m[4] = 2.0f * (xy - zw) * sy[i];
+        m[5] = (1.0f - 2.0f * (xx + zz)) * sy[i];
+        m[6] = 2.0f * (yz + xw) * sy[i];
+        m[7] = 0.0f;
+        m[8] = 2.0f * (xz + yw) * sz[i];
+        m[9] = 2.0f * (yz - xw) * sz[i];
+        m[10] = (1.0f - 2.0f * (xx + yy)) * sz[i];
+        m[11] = 0.0f;
+        m[12] = px[i];
+        m[13] = py[i];
+        m[14] = pz[i];
+        m[15] = 1.0f;
+    }
+}
+
 // FrustumCuller
 
-std::vector<flecs::entity> FrustumCuller::cull(const float* viewProjection, flecs::world& world) {
-    FABRIC_ZONE_SCOPED_N("FrustumCuller::cull");
+// Singleton holding the phase-less culling system, so its cached query over
+// SceneEntity tables is built once per world
+struct FrustumCullSystem {
+    flecs::entity_t id;
+};
+
+namespace {
 
+// Passed to the culling system through the iterator's param
+struct CullPass {
     Frustum frustum;
-    frustum.extractFromVP(viewProjection);
+    void* out;
+    void (*append)(void* out, flecs::entity e);
+};
+
+flecs::entity_t frustumCullSystem(flecs::world& world) {
+    if (const auto* system = world.try_get<FrustumCullSystem>())
+        return system->id;
+
+    // Field 0 is WorldBounds, field 3 BoundingBox; both optional so entities
+    // without bounds still match and are always visible
+    auto id = world.system<const WorldBounds>("FrustumCull")
+                  .term_at(0)
+                  .optional()
+                  .with<SceneEntity>()
+                  .with<Position>()
+                  .with<BoundingBox>()
+                  .optional()
+                  .kind(0)
+                  .run([](flecs::iter& it) {
+                      auto& pass = *static_cast<CullPass*>(it.param());
+                      while (it.next()) {
+                          if (!it.is_set(0) || !it.is_set(3)) {
+                              for (auto i : it)
+                                  pass.append(pass.out, it.entity(i));
+                              continue;
+                          }
+                          auto bounds = it.field<const WorldBounds>(0);
+                          for (auto i : it) {
+                              const auto& b = bounds[i];
+                              AABB box(Vec3f(b.minX, b.minY, b.minZ), Vec3f(b.maxX, b.maxY, b.maxZ));
+                              if (pass.frustum.testAABB(box) != CullResult::Outside)
+                                  pass.append(pass.out, it.entity(i));
+                          }
+                      }
+                  })
+                  .id();
+
+    world.set<FrustumCullSystem>({id});
+    return id;
+}
 
-    std::vector<flecs::entity> visible;
+template <typename Out> void cullInto(const float* viewProjection, flecs::world& world, Out& visible) {
+    FABRIC_ZONE_SCOPED_N("FrustumCuller::cull");
 
-    // Flat iteration: test each SceneEntity independently
-    world.each([&](flecs::entity e, const Position&) {
-        if (!e.has<SceneEntity>())
-            return;
-
-        const auto* bb = e.try_get<BoundingBox>();
-        if (bb) {
-            AABB localAABB(Vec3f(bb->minX, bb->minY, bb->minZ), Vec3f(bb->maxX, bb->maxY, bb->maxZ));
-
-            // Transform AABB to world space using LocalToWorld if available
-            const auto* ltw = e.try_get<LocalToWorld>();
-            if (ltw) {
-                Matrix4x4<float> m(ltw->matrix);
-                // Transform all 8 corners and re-fit the AABB
-                AABB worldAABB;
-                bool first = true;
-                for (int cx = 0; cx < 2; ++cx) {
-                    for (int cy = 0; cy < 2; ++cy) {
-                        for (int cz = 0; cz < 2; ++cz) {
-                            Vec3f corner(cx == 0 ? localAABB.min.x : localAABB.max.x,
-                                         cy == 0 ? localAABB.min.y : localAABB.max.y,
-                                         cz == 0 ? localAABB.min.z : localAABB.max.z);
-                            auto worldCorner = m.transformPoint<Space::World, Space::World>(corner);
-                            if (first) {
-                                worldAABB = AABB(worldCorner, worldCorner);
-                                first = false;
-                            } else {
-                                worldAABB.expand(worldCorner);
-                            }
-                        }
-                    }
-                }
-                if (frustum.testAABB(worldAABB) == CullResult::Outside)
-                    return;
-            } else {
-                if (frustum.testAABB(localAABB) == CullResult::Outside)
-                    return;
-            }
-        }
+    CullPass pass;
+    pass.frustum.extractFromVP(viewProjection);
+    pass.out = &visible;
+    pass.append = [](void* out, flecs::entity e) { static_cast<Out*>(out)->push_back(e); };
 
-        visible.push_back(e);
-    });
+    visible.clear();
+    ecs_run(world.c_ptr(), frustumCullSystem(world), 0.0f, &pass);
+}
+
+} // namespace
 
+std::vector<flecs::entity> FrustumCuller::cull(const float* viewProjection, flecs::world& world) {
+    std::vector<flecs::entity> visible;
+    cullInto(viewProjection, world, visible);
     return visible;
 }
 
+void FrustumCuller::cull(const float* viewProjection, flecs::world& world, std::vector<flecs::entity>& out) {
+    cullInto(viewProjection, world, out);
+}
+
+void FrustumCuller::cull(const float* viewProjection, flecs::world& world, std::pmr::vector<flecs::entity>& out) {
+    cullInto(viewProjection, world, out);
+}
+
 } // namespace fabric
@@ -23,7 +23,21 @@ void ResourceHub::enforceBudget() {
 }
 
 // Destructor implementation
+namespace {
+
+constexpr const char* kMemoryMetric = "fabric_resource_memory_bytes";
+constexpr const char* kBudgetMetric = "fabric_resource_memory_budget_bytes";
+constexpr const char* kQueueMetric = "fabric_resource_load_queue_depth";
+
+} // namespace
+
 ResourceHub::~ResourceHub() {
+    if (metrics_) {
+        metrics_->remove(kMemoryMetric);
+        metrics_->remove(kBudgetMetric);
+        metrics_->remove(kQueueMetric);
+    }
+
     try {
         // Use timeout protection for shutdown operations
         auto shutdownTimeoutMs = 1000; // 1 second timeout
@@ -402,6 +416,18 @@ size_t ResourceHub::getMemoryUsage() const {
     return total;
 }
 
+void ResourceHub::registerMetrics(MetricsRegistry& registry) {
+    metrics_ = &registry;
+    registry.gaugeCallback(kMemoryMetric, "Memory used by loaded resources",
+                           [this] { return static_cast<double>(getMemoryUsage()); });
+    registry.gaugeCallback(kBudgetMetric, "Resource memory budget",
+                           [this] { return static_cast<double>(getMemoryBudget()); });
+    registry.gaugeCallback(kQueueMetric, "Pending asynchronous resource loads", [this] {
+        std::unique_lock<std::timed_mutex> lock(queueMutex_, std::chrono::milliseconds(10));
+        return lock.owns_lock() ? static_cast<double>(loadQueue_.size()) : 0.0;
+    });
+}
+
 size_t ResourceHub::getMemoryBudget() const {
     return memoryBudget_;
 }
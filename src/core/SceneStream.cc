@@ -0,0 +1,248 @@
+#include "fabric/core/SceneStream.hh"
+
+#include "fabric/core/ECS.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/MappedFile.hh"
+#include "fabric/utils/Profiler.hh"
+
+#include <utility>
+
+namespace fabric {
+
+// --- DOM path ---
+
+void to_json(nlohmann::json& j, const SceneRecord& r) {
+    j = nlohmann::json{{"name", r.name},
+                       {"parent", r.parent},
+                       {"position", r.position},
+                       {"rotation", r.rotation},
+                       {"scale", r.scale}};
+}
+
+void from_json(const nlohmann::json& j, SceneRecord& r) {
+    r = SceneRecord{};
+    if (auto it = j.find("name"); it != j.end())
+        it->get_to(r.name);
+    if (auto it = j.find("parent"); it != j.end())
+        it->get_to(r.parent);
+    if (auto it = j.find("position"); it != j.end())
+        it->get_to(r.position);
+    if (auto it = j.find("rotation"); it != j.end())
+        it->get_to(r.rotation);
+    if (auto it = j.find("scale"); it != j.end())
+        it->get_to(r.scale);
+}
+
+void to_json(nlohmann::json& j, const Scene& s) {
+    j = nlohmann::json{{"entities", s.entities}};
+}
+
+void from_json(const nlohmann::json& j, Scene& s) {
+    s.entities.clear();
+    if (auto it = j.find("entities"); it != j.end())
+        it->get_to(s.entities);
+}
+
+// --- SAX path ---
+
+SceneStreamReader::SceneStreamReader(Sink sink) : sink_(std::move(sink)) {
+    stack_.reserve(8);
+}
+
+SceneStreamReader::Context SceneStreamReader::childContext(bool isObject) {
+    if (stack_.empty())
+        return isObject ? Context::Root : Context::Entities;
+
+    switch (stack_.back()) {
+        case Context::Root:
+            return !isObject && entitiesKey_ ? Context::Entities : Context::Skip;
+        case Context::Entities:
+            return isObject ? Context::Record : Context::Skip;
+        case Context::Record:
+            if (!isObject)
+                return Context::Skip;
+            if (field_ == Field::Position) {
+                components_ = {&record_.position.x, &record_.position.y, &record_.position.z, nullptr};
+                return Context::Vector;
+            }
+            if (field_ == Field::Rotation) {
+                components_ = {&record_.rotation.x, &record_.rotation.y, &record_.rotation.z, &record_.rotation.w};
+                return Context::Vector;
+            }
+            if (field_ == Field::Scale) {
+                components_ = {&record_.scale.x, &record_.scale.y, &record_.scale.z, nullptr};
+                return Context::Vector;
+            }
+            return Context::Skip;
+        case Context::Vector:
+        case Context::Skip:
+            break;
+    }
+    return Context::Skip;
+}
+
+void SceneStreamReader::push(bool isObject) {
+    Context next = childContext(isObject);
+    if (next == Context::Record)
+        record_ = SceneRecord{};
+    component_ = -1;
+    stack_.push_back(next);
+}
+
+void SceneStreamReader::pop() {
+    Context done = stack_.back();
+    stack_.pop_back();
+    if (done == Context::Record) {
+        sink_(record_);
+        ++count_;
+    }
+    // A closed container is the value of whatever key preceded it
+    if (!stack_.empty() && stack_.back() == Context::Record)
+        field_ = Field::None;
+    if (!stack_.empty() && stack_.back() == Context::Root)
+        entitiesKey_ = false;
+}
+
+void SceneStreamReader::number(double val) {
+    if (stack_.empty())
+        return;
+    if (stack_.back() == Context::Record && field_ == Field::Parent) {
+        record_.parent = static_cast<int64_t>(val);
+    } else if (stack_.back() == Context::Vector && component_ >= 0) {
+        if (float* target = components_[component_])
+            *target = static_cast<float>(val);
+    }
+}
+
+bool SceneStreamReader::null() {
+    return true;
+}
+
+bool SceneStreamReader::boolean(bool) {
+    return true;
+}
+
+bool SceneStreamReader::number_integer(number_integer_t val) {
+    if (!stack_.empty() && stack_.back() == Context::Record && field_ == Field::Parent)
+        record_.parent = val;
+    else
+        number(static_cast<double>(val));
+    return true;
+}
+
+bool SceneStreamReader::number_unsigned(number_unsigned_t val) {
+    if (!stack_.empty() && stack_.back() == Context::Record && field_ == Field::Parent)
+        record_.parent = static_cast<int64_t>(val);
+    else
+        number(static_cast<double>(val));
+    return true;
+}
+
+bool SceneStreamReader::number_float(number_float_t val, const string_t&) {
+    number(val);
+    return true;
+}
+
+bool SceneStreamReader::string(string_t& val) {
+    if (!stack_.empty() && stack_.back() == Context::Record && field_ == Field::Name)
+        record_.name = std::move(val);
+    return true;
+}
+
+bool SceneStreamReader::binary(binary_t&) {
+    return true;
+}
+
+bool SceneStreamReader::start_object(std::size_t) {
+    push(true);
+    return true;
+}
+
+bool SceneStreamReader::key(string_t& val) {
+    switch (stack_.back()) {
+        case Context::Root:
+            entitiesKey_ = val == "entities";
+            break;
+        case Context::Record:
+            if (val == "name")
+                field_ = Field::Name;
+            else if (val == "parent")
+                field_ = Field::Parent;
+            else if (val == "position")
+                field_ = Field::Position;
+            else if (val == "rotation")
+                field_ = Field::Rotation;
+            else if (val == "scale")
+                field_ = Field::Scale;
+            else
+                field_ = Field::None;
+            break;
+        case Context::Vector:
+            component_ = -1;
+            if (val == "x")
+                component_ = 0;
+            else if (val == "y")
+                component_ = 1;
+            else if (val == "z")
+                component_ = 2;
+            else if (val == "w")
+                component_ = 3;
+            break;
+        case Context::Entities:
+        case Context::Skip:
+            break;
+    }
+    return true;
+}
+
+bool SceneStreamReader::end_object() {
+    pop();
+    return true;
+}
+
+bool SceneStreamReader::start_array(std::size_t) {
+    push(false);
+    return true;
+}
+
+bool SceneStreamReader::end_array() {
+    pop();
+    return true;
+}
+
+bool SceneStreamReader::parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) {
+    error_ = ex.what();
+    return false;
+}
+
+size_t streamScene(std::span<const uint8_t> bytes, JsonFormat format, const SceneStreamReader::Sink& sink) {
+    FABRIC_ZONE_SCOPED_N("SceneStream::stream");
+    SceneStreamReader reader(sink);
+    if (!parseJsonSax(bytes, format, reader)) {
+        throwError("Malformed scene: " + (reader.error().empty() ? std::string("parse stopped") : reader.error()));
+    }
+    return reader.recordCount();
+}
+
+size_t loadScene(World& world, std::span<const uint8_t> bytes, JsonFormat format) {
+    FABRIC_ZONE_SCOPED_N("SceneStream::load");
+    std::vector<flecs::entity> created;
+    streamScene(bytes, format, [&](const SceneRecord& r) {
+        const char* name = r.name.empty() ? nullptr : r.name.c_str();
+        bool hasParent = r.parent >= 0 && static_cast<size_t>(r.parent) < created.size();
+        auto e = hasParent ? world.createChildEntity(created[static_cast<size_t>(r.parent)], name)
+                           : world.createSceneEntity(name);
+        e.set<Position>({r.position.x, r.position.y, r.position.z});
+        e.set<Rotation>({r.rotation.x, r.rotation.y, r.rotation.z, r.rotation.w});
+        e.set<Scale>({r.scale.x, r.scale.y, r.scale.z});
+        created.push_back(e);
+    });
+    return created.size();
+}
+
+size_t loadSceneFile(World& world, const std::string& path, JsonFormat format) {
+    auto file = MappedFile::open(path);
+    return loadScene(world, file.bytes(), format);
+}
+
+} // namespace fabric
@@ -1,6 +1,7 @@
 #include "fabric/core/SceneView.hh"
 #include "fabric/core/ECS.hh"
 #include "fabric/core/Spatial.hh"
+#include "fabric/utils/FrameArena.hh"
 #include "fabric/utils/Profiler.hh"
 #include <bgfx/bgfx.h>
 
@@ -15,23 +16,46 @@ void SceneView::setClearColor(uint32_t rgba) {
 
 void SceneView::render() {
     FABRIC_ZONE_SCOPED_N("SceneView::render");
+    cull();
+    extract();
+    submit();
+}
+
+void SceneView::cull() {
+    FABRIC_ZONE_SCOPED_N("SceneView::cull");
 
     // 1. Get VP matrix from camera
     float vp[16];
     camera_.getViewProjection(vp);
 
-    // 2. Cull scene entities against frustum
-    visibleEntities_ = FrustumCuller::cull(vp, world_);
+    // 2. Cull scene entities against frustum into this frame's arena. The
+    // previous frame's lists are dropped without freeing; sizing from them
+    // avoids regrowing the vectors inside the arena.
+    size_t expected = frame_ ? frame_->visibleEntities.size() : 0;
+    auto& frame = frame_.emplace(FrameArenas::resource());
+    frame.visibleEntities.reserve(expected);
+    FrustumCuller::cull(vp, world_, frame.visibleEntities);
+}
+
+void SceneView::extract() {
+    FABRIC_ZONE_SCOPED_N("SceneView::extract");
+    if (!frame_)
+        return;
 
     // 3. Build render list from visible entities
-    renderList_.clear();
-    for (auto entity : visibleEntities_) {
+    auto& frame = *frame_;
+    frame.renderList.reserve(frame.visibleEntities.size());
+    for (auto entity : frame.visibleEntities) {
         DrawCall dc;
         dc.viewId = viewId_;
 
-        // Read pre-computed world transform from CASCADE system
-        const auto* ltw = entity.try_get<LocalToWorld>();
-        if (ltw) {
+        // Interpolated render-rate matrix first, then the fixed-step one
+        // from the CASCADE system
+        const auto* render = entity.try_get<RenderTransform>();
+        const auto* ltw = render ? nullptr : entity.try_get<LocalToWorld>();
+        if (render) {
+            dc.transform = render->matrix;
+        } else if (ltw) {
             dc.transform = ltw->matrix;
         } else {
             // Fallback: compose from components if LocalToWorld is missing
@@ -48,9 +72,11 @@ void SceneView::render() {
             auto matrix = t.getMatrix();
             dc.transform = matrix.elements;
         }
-        renderList_.addDrawCall(dc);
+        frame.renderList.addDrawCall(dc);
     }
+}
 
+void SceneView::submit() {
     // 4. Set bgfx view transform and clear
     bgfx::setViewTransform(viewId_, camera_.viewMatrix(), camera_.projectionMatrix());
     bgfx::setViewClear(viewId_, BGFX_CLEAR_COLOR | BGFX_CLEAR_DEPTH, clearColor_, 1.0f, 0);
@@ -67,8 +93,10 @@ Camera& SceneView::camera() {
     return camera_;
 }
 
-const std::vector<flecs::entity>& SceneView::visibleEntities() const {
-    return visibleEntities_;
+std::span<const flecs::entity> SceneView::visibleEntities() const {
+    if (!frame_)
+        return {};
+    return frame_->visibleEntities;
 }
 
 } // namespace fabric
@@ -0,0 +1,161 @@
+#include "fabric/core/Startup.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/ImmutableDAG.hh"
+#include "fabric/utils/Profiler.hh"
+#include "fabric/utils/TaskGraph.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <unordered_map>
+
+namespace fabric {
+
+namespace {
+
+double toMs(std::chrono::nanoseconds d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+} // namespace
+
+Startup::Startup(size_t workerThreads) : workerThreads_(workerThreads), origin_(std::chrono::steady_clock::now()) {}
+
+void Startup::addPhase(std::string name, std::vector<std::string> after, Task task, StartupThread thread) {
+    if (name.empty()) {
+        throwError("Startup phase name cannot be empty");
+    }
+    if (!task) {
+        throwError("Startup phase '" + name + "' has no task");
+    }
+    for (const auto& phase : phases_) {
+        if (phase.name == name) {
+            throwError("Startup phase '" + name + "' is already defined");
+        }
+    }
+    phases_.push_back({std::move(name), std::move(after), std::move(task), thread});
+}
+
+void Startup::run() {
+    std::vector<Phase> phases = std::move(phases_);
+    phases_.clear();
+    const size_t count = phases.size();
+
+    std::unordered_map<std::string, size_t> indexByName;
+    ImmutableDAG<size_t> graph;
+    for (size_t i = 0; i < count; ++i) {
+        indexByName.emplace(phases[i].name, i);
+        graph.addNode(i);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        for (const auto& dependency : phases[i].after) {
+            auto it = indexByName.find(dependency);
+            if (it == indexByName.end()) {
+                throwError("Startup phase '" + phases[i].name + "' runs after unknown phase '" + dependency + "'");
+            }
+            if (it->second == i) {
+                throwError("Startup phase '" + phases[i].name + "' depends on itself");
+            }
+            if (!graph.isReachable(it->second, i)) {
+                graph.addEdge(it->second, i); // Throws on a cycle
+            }
+        }
+    }
+
+    TaskGraph tasks;
+    tasks.dependents.resize(count);
+    tasks.dependencyCounts.resize(count);
+    std::vector<StartupPhaseTiming> timings(count);
+    std::vector<std::exception_ptr> errors(count);
+    bool anyWorkerPhase = false;
+    for (size_t i = 0; i < count; ++i) {
+        tasks.dependents[i] = graph.getChildren(i);
+        tasks.dependencyCounts[i] = graph.getParents(i).size();
+        timings[i].name = phases[i].name;
+        timings[i].thread = phases[i].thread;
+        anyWorkerPhase = anyWorkerPhase || phases[i].thread == StartupThread::Worker;
+    }
+
+    std::unique_ptr<Utils::ThreadPoolExecutor> workers;
+    if (workerThreads_ > 0 && anyWorkerPhase) {
+        workers = std::make_unique<Utils::ThreadPoolExecutor>(workerThreads_);
+    }
+
+    // Each phase writes only its own slots
+    tasks.run = [&](size_t i) {
+        FABRIC_ZONE_SCOPED_N("startup_phase");
+        auto& timing = timings[i];
+        auto begin = std::chrono::steady_clock::now();
+        timing.start = begin - origin_;
+        try {
+            phases[i].task();
+            timing.success = true;
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+        timing.duration = std::chrono::steady_clock::now() - begin;
+        return timing.success;
+    };
+    tasks.skip = [&](size_t i) {
+        FABRIC_LOG_ERROR("Startup: skipping '{}', a dependency failed", phases[i].name);
+        timings[i].skipped = true;
+    };
+    tasks.onCallingThread = [&](size_t i) { return phases[i].thread == StartupThread::Main; };
+
+    auto completionOrder = runTaskGraph(tasks, workers.get());
+    workers.reset();
+
+    std::exception_ptr firstError;
+    {
+        std::lock_guard<std::mutex> lock(timelineMutex_);
+        for (size_t i : completionOrder) {
+            if (errors[i] && !firstError) {
+                firstError = errors[i];
+            }
+            timeline_.push_back(std::move(timings[i]));
+        }
+    }
+
+    FABRIC_LOG_INFO("Startup: {} phases done at {:.2f} ms", count, toMs(elapsed()));
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+void Startup::markFirstFrame() {
+    if (firstFrameNanos_.load(std::memory_order_relaxed) != 0) {
+        return;
+    }
+    firstFrameNanos_.store(elapsed().count(), std::memory_order_relaxed);
+    logTimeline();
+}
+
+std::vector<StartupPhaseTiming> Startup::timeline() const {
+    std::lock_guard<std::mutex> lock(timelineMutex_);
+    return timeline_;
+}
+
+std::chrono::nanoseconds Startup::elapsed() const {
+    return std::chrono::steady_clock::now() - origin_;
+}
+
+void Startup::logTimeline() const {
+    auto phases = timeline();
+    std::sort(phases.begin(), phases.end(), [](const auto& a, const auto& b) { return a.start < b.start; });
+
+    for (const auto& phase : phases) {
+        const char* thread = phase.thread == StartupThread::Main ? "main" : "worker";
+        if (phase.skipped) {
+            FABRIC_LOG_INFO("Startup: {:<16} {:>6} skipped", phase.name, thread);
+        } else {
+            FABRIC_LOG_INFO("Startup: {:<16} {:>6} {:>8.2f} ms +{:.2f} ms{}", phase.name, thread, toMs(phase.start),
+                            toMs(phase.duration), phase.success ? "" : " (failed)");
+        }
+    }
+    if (auto firstFrame = timeToFirstFrame(); firstFrame.count() != 0) {
+        FABRIC_LOG_INFO("Startup: first frame at {:.2f} ms", toMs(firstFrame));
+    }
+}
+
+} // namespace fabric
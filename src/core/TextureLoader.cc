@@ -0,0 +1,316 @@
+#include "fabric/core/TextureLoader.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/Profiler.hh"
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+namespace fabric {
+
+TextureLoader::TextureLoader(TextureLoaderConfig config) : config_(config), shared_(std::make_shared<Shared>()) {}
+
+TextureLoader::~TextureLoader() {
+    if (workers_)
+        workers_->shutdown();
+}
+
+void TextureLoader::init() {
+    FABRIC_ZONE_SCOPED;
+    uint32_t color = config_.placeholderColor;
+    placeholder_ = bgfx::createTexture2D(1, 1, false, 1, bgfx::TextureFormat::RGBA8, config_.samplerFlags,
+                                         bgfx::copy(&color, sizeof(color)));
+}
+
+void TextureLoader::shutdown() {
+    FABRIC_ZONE_SCOPED;
+
+    stopped_ = true;
+    if (workers_) {
+        workers_->shutdown();
+        workers_.reset();
+    }
+    {
+        std::lock_guard lock(shared_->mutex);
+        shared_->ready.clear();
+    }
+
+    for (auto& entry : entries_) {
+        if (entry.live && bgfx::isValid(entry.handle))
+            bgfx::destroy(entry.handle);
+    }
+    entries_.clear();
+    freeIds_.clear();
+    for (auto& cache : cache_)
+        cache.clear();
+    pending_ = 0;
+
+    if (bgfx::isValid(placeholder_))
+        bgfx::destroy(placeholder_);
+    placeholder_ = BGFX_INVALID_HANDLE;
+}
+
+TextureId TextureLoader::request(const std::string& path, bool generateMips) {
+    FABRIC_ZONE_SCOPED;
+
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(path, ec);
+
+    auto& cache = cache_[generateMips ? 1 : 0];
+    if (auto it = cache.find(path); it != cache.end() && !ec) {
+        auto& cached = entries_[it->second - 1];
+        if (cached.mtime == mtime) {
+            ++cached.refs;
+            ++cacheHits_;
+            return it->second;
+        }
+    }
+
+    TextureId id;
+    if (!freeIds_.empty()) {
+        id = freeIds_.back();
+        freeIds_.pop_back();
+    } else {
+        entries_.emplace_back();
+        id = static_cast<TextureId>(entries_.size());
+    }
+
+    auto& entry = entries_[id - 1];
+    entry.path = path;
+    entry.mtime = mtime;
+    entry.mips = generateMips;
+    entry.handle = BGFX_INVALID_HANDLE;
+    entry.refs = 1;
+    entry.live = true;
+
+    if (ec || !ensureWorkers()) {
+        if (ec)
+            FABRIC_LOG_WARN("TextureLoader: cannot stat {}: {}", path, ec.message());
+        entry.state = TextureLoadState::Failed;
+        return id;
+    }
+
+    entry.state = TextureLoadState::Pending;
+    cache[path] = id;
+    ++pending_;
+
+    workers_->submit([shared = shared_, path, generateMips, id, generation = entry.generation]() {
+        FABRIC_ZONE_SCOPED_N("TextureLoader::decode");
+        DecodeResult result{id, generation, decodeFile(path, generateMips, &*shared->pool)};
+        std::lock_guard lock(shared->mutex);
+        if (result.image)
+            ++(result.image->pooled() ? shared->pooledDecodes : shared->heapDecodes);
+        shared->ready.push_back(std::move(result));
+    });
+    return id;
+}
+
+bool TextureLoader::ensureWorkers() {
+    if (workers_)
+        return true;
+    if (stopped_)
+        return false;
+
+    FABRIC_ZONE_SCOPED;
+    shared_->pool.emplace(config_.slotSize, config_.slotCount, MemoryHeaps::resource(MemoryHeap::Resources));
+    workers_ = std::make_unique<Utils::ThreadPoolExecutor>(std::max<size_t>(1, config_.workerThreads));
+    return true;
+}
+
+void TextureLoader::release(TextureId id) {
+    if (id == kInvalidTextureId || id > entries_.size())
+        return;
+    auto& entry = entries_[id - 1];
+    if (!entry.live || entry.refs == 0)
+        return;
+    if (--entry.refs == 0)
+        destroyEntry(id);
+}
+
+void TextureLoader::destroyEntry(TextureId id) {
+    auto& entry = entries_[id - 1];
+    if (bgfx::isValid(entry.handle))
+        bgfx::destroy(entry.handle);
+    if (entry.state == TextureLoadState::Pending)
+        --pending_;
+
+    auto& cache = cache_[entry.mips ? 1 : 0];
+    if (auto it = cache.find(entry.path); it != cache.end() && it->second == id)
+        cache.erase(it);
+
+    // Bumping the generation drops any decode still in flight for this slot
+    uint32_t generation = entry.generation + 1;
+    entry = Entry{};
+    entry.generation = generation;
+    freeIds_.push_back(id);
+}
+
+size_t TextureLoader::processUploads() {
+    FABRIC_ZONE_SCOPED;
+
+    size_t uploaded = 0;
+    while (true) {
+        DecodeResult result;
+        {
+            std::lock_guard lock(shared_->mutex);
+            if (shared_->ready.empty())
+                break;
+            auto& front = shared_->ready.front();
+            size_t cost = front.image ? front.image->size : 0;
+            if (uploaded > 0 && uploaded + cost > config_.uploadBudgetBytes)
+                break;
+            result = std::move(front);
+            shared_->ready.pop_front();
+        }
+
+        if (result.id == kInvalidTextureId || result.id > entries_.size())
+            continue;
+        auto& entry = entries_[result.id - 1];
+        if (!entry.live || entry.generation != result.generation || entry.state != TextureLoadState::Pending)
+            continue;
+
+        --pending_;
+        if (!result.image) {
+            FABRIC_LOG_WARN("TextureLoader: failed to decode {}", entry.path);
+            entry.state = TextureLoadState::Failed;
+            continue;
+        }
+
+        upload(entry, *result.image);
+        uploaded += result.image->size;
+    }
+
+    FABRIC_PLOT("Texture upload bytes", static_cast<int64_t>(uploaded));
+    return uploaded;
+}
+
+void TextureLoader::upload(Entry& entry, const DecodedImage& image) {
+    FABRIC_ZONE_SCOPED;
+    entry.handle = bgfx::createTexture2D(static_cast<uint16_t>(image.width), static_cast<uint16_t>(image.height),
+                                         image.mipCount > 1, 1, bgfx::TextureFormat::RGBA8, config_.samplerFlags,
+                                         bgfx::copy(image.data(), static_cast<uint32_t>(image.size)));
+    entry.state = TextureLoadState::Ready;
+}
+
+const TextureLoader::Entry* TextureLoader::find(TextureId id) const {
+    if (id == kInvalidTextureId || id > entries_.size() || !entries_[id - 1].live)
+        return nullptr;
+    return &entries_[id - 1];
+}
+
+TextureLoadState TextureLoader::state(TextureId id) const {
+    const auto* entry = find(id);
+    return entry ? entry->state : TextureLoadState::Failed;
+}
+
+bgfx::TextureHandle TextureLoader::handle(TextureId id) const {
+    const auto* entry = find(id);
+    if (entry && entry->state == TextureLoadState::Ready)
+        return entry->handle;
+    return placeholder_;
+}
+
+size_t TextureLoader::pendingCount() const {
+    return pending_;
+}
+
+size_t TextureLoader::liveCount() const {
+    return entries_.size() - freeIds_.size();
+}
+
+uint64_t TextureLoader::pooledDecodes() const {
+    std::lock_guard lock(shared_->mutex);
+    return shared_->pooledDecodes;
+}
+
+uint64_t TextureLoader::heapDecodes() const {
+    std::lock_guard lock(shared_->mutex);
+    return shared_->heapDecodes;
+}
+
+uint8_t TextureLoader::mipCount(uint32_t width, uint32_t height) {
+    uint32_t largest = std::max(width, height);
+    uint8_t count = 1;
+    while (largest > 1) {
+        largest >>= 1;
+        ++count;
+    }
+    return count;
+}
+
+size_t TextureLoader::imageSize(uint32_t width, uint32_t height, bool mips) {
+    size_t total = 0;
+    uint8_t levels = mips ? mipCount(width, height) : 1;
+    for (uint8_t i = 0; i < levels; ++i) {
+        total += size_t{std::max(1u, width >> i)} * std::max(1u, height >> i) * 4;
+    }
+    return total;
+}
+
+void TextureLoader::buildMipChain(uint8_t* data, uint32_t width, uint32_t height) {
+    const uint8_t* src = data;
+    uint8_t* dst = data + size_t{width} * height * 4;
+    uint32_t sw = width;
+    uint32_t sh = height;
+
+    while (sw > 1 || sh > 1) {
+        uint32_t dw = std::max(1u, sw >> 1);
+        uint32_t dh = std::max(1u, sh >> 1);
+        for (uint32_t y = 0; y < dh; ++y) {
+            uint32_t y0 = std::min(y * 2, sh - 1);
+            uint32_t y1 = std::min(y * 2 + 1, sh - 1);
+            for (uint32_t x = 0; x < dw; ++x) {
+                uint32_t x0 = std::min(x * 2, sw - 1);
+                uint32_t x1 = std::min(x * 2 + 1, sw - 1);
+                const uint8_t* a = src + (size_t{y0} * sw + x0) * 4;
+                const uint8_t* b = src + (size_t{y0} * sw + x1) * 4;
+                const uint8_t* c = src + (size_t{y1} * sw + x0) * 4;
+                const uint8_t* d = src + (size_t{y1} * sw + x1) * 4;
+                uint8_t* out = dst + (size_t{y} * dw + x) * 4;
+                for (int ch = 0; ch < 4; ++ch) {
+                    out[ch] = static_cast<uint8_t>((a[ch] + b[ch] + c[ch] + d[ch] + 2) / 4);
+                }
+            }
+        }
+        src = dst;
+        dst += size_t{dw} * dh * 4;
+        sw = dw;
+        sh = dh;
+    }
+}
+
+std::optional<DecodedImage> TextureLoader::decodeFile(const std::string& path, bool generateMips, BufferPool* pool) {
+    int w = 0, h = 0, channels = 0;
+    unsigned char* pixels = stbi_load(path.c_str(), &w, &h, &channels, 4);
+    if (!pixels)
+        return std::nullopt;
+
+    DecodedImage image;
+    image.width = static_cast<uint32_t>(w);
+    image.height = static_cast<uint32_t>(h);
+    image.mipCount = generateMips ? mipCount(image.width, image.height) : 1;
+    image.size = imageSize(image.width, image.height, generateMips);
+
+    uint8_t* dst = nullptr;
+    if (pool && image.size <= pool->slotSize()) {
+        if (auto slot = pool->tryBorrow(image.size)) {
+            image.slot = std::move(*slot);
+            dst = image.slot.data();
+        }
+    }
+    if (!dst) {
+        image.heap.resize(image.size);
+        dst = image.heap.data();
+    }
+
+    std::memcpy(dst, pixels, size_t{image.width} * image.height * 4);
+    stbi_image_free(pixels);
+
+    if (generateMips)
+        buildMipChain(dst, image.width, image.height);
+    return image;
+}
+
+} // namespace fabric
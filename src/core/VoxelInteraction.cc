@@ -16,6 +16,8 @@ InteractionResult VoxelInteraction::createMatter(const VoxelHit& hit, float dens
 
     density_.write(x, y, z, density);
     essence_.write(x, y, z, essenceColor);
+    if (lighting_)
+        lighting_->voxelChanged(x, y, z);
 
     int cx = x >> kChunkShift;
     int cy = y >> kChunkShift;
@@ -31,6 +33,8 @@ InteractionResult VoxelInteraction::destroyMatter(const VoxelHit& hit) {
     int z = hit.z;
 
     density_.write(x, y, z, 0.0f);
+    if (lighting_)
+        lighting_->voxelChanged(x, y, z);
 
     int cx = x >> kChunkShift;
     int cy = y >> kChunkShift;
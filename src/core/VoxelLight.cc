@@ -0,0 +1,400 @@
+#include "fabric/core/VoxelLight.hh"
+
+#include "fabric/utils/Profiler.hh"
+#include "fabric/utils/TaskGraph.hh"
+
+#include <algorithm>
+#include <tuple>
+
+namespace fabric {
+
+namespace {
+
+// LightNode::flags
+constexpr uint8_t kBlockChannel = 1 << 0; // Block light; sky otherwise
+constexpr uint8_t kDownward = 1 << 1;     // Removal arrived from the cell above
+constexpr uint8_t kForce = 1 << 2;        // Removal clears the cell whatever its level
+constexpr uint8_t kRelight = 1 << 3;      // Re-spread the cell's current level and source
+
+// Faces in getNeighbors6 order: +x, -x, +y, -y, +z, -z
+constexpr int kFaceCount = 6;
+constexpr int kDownFace = 3;
+constexpr int kUpFace = 2;
+constexpr int kFaceOffset[kFaceCount][3] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+
+int axisCoord(int index, int axis) {
+    return (index >> (axis * kChunkShift)) & kChunkMask;
+}
+
+// Cell across face from index. True if it is in the same chunk; otherwise
+// next is its index in the neighbouring chunk.
+bool step(int index, int face, int& next) {
+    int axis = face >> 1;
+    int stride = 1 << (axis * kChunkShift);
+    int c = axisCoord(index, axis);
+    if ((face & 1) == 0) {
+        if (c == kChunkMask) {
+            next = index - kChunkMask * stride;
+            return false;
+        }
+        next = index + stride;
+    } else {
+        if (c == 0) {
+            next = index + kChunkMask * stride;
+            return false;
+        }
+        next = index - stride;
+    }
+    return true;
+}
+
+ChunkCoord across(const ChunkCoord& coord, int face) {
+    return {coord.cx + kFaceOffset[face][0], coord.cy + kFaceOffset[face][1], coord.cz + kFaceOffset[face][2]};
+}
+
+// fn(inner, outer) for each cell on a chunk face and the cell facing it in the neighbour
+template <typename Fn> void forEachFacePair(int face, Fn&& fn) {
+    int axis = face >> 1;
+    bool positive = (face & 1) == 0;
+    int inner = (positive ? kChunkMask : 0) << (axis * kChunkShift);
+    int outer = (positive ? 0 : kChunkMask) << (axis * kChunkShift);
+    int uShift = ((axis + 1) % 3) * kChunkShift;
+    int vShift = ((axis + 2) % 3) * kChunkShift;
+    for (int v = 0; v < kChunkSize; ++v) {
+        for (int u = 0; u < kChunkSize; ++u) {
+            int base = (u << uShift) | (v << vShift);
+            fn(base | inner, base | outer);
+        }
+    }
+}
+
+uint8_t levelOf(uint8_t packed, uint8_t channel) {
+    return (channel & kBlockChannel) ? blockLight(packed) : skyLight(packed);
+}
+
+uint16_t cellIndex(int index) {
+    return static_cast<uint16_t>(index);
+}
+
+} // namespace
+
+VoxelLighting::VoxelLighting(const ChunkedGrid<float>& density, float threshold, Utils::ThreadPoolExecutor* workers)
+    : density_(density), threshold_(threshold), workers_(workers) {}
+
+VoxelLighting::ChunkWork& VoxelLighting::workFor(const ChunkCoord& coord) {
+    return work_[coord];
+}
+
+void VoxelLighting::relightNeighbor(const ChunkCoord& coord, int index, int face) {
+    int next = 0;
+    ChunkCoord target = coord;
+    if (!step(index, face, next)) {
+        target = across(coord, face);
+        if (!light_.hasChunk(target.cx, target.cy, target.cz))
+            return;
+    }
+    auto& queue = workFor(target).addQueue;
+    queue.push_back({cellIndex(next), 0, kRelight});
+    queue.push_back({cellIndex(next), 0, kRelight | kBlockChannel});
+}
+
+void VoxelLighting::addChunk(int cx, int cy, int cz) {
+    ChunkCoord coord{cx, cy, cz};
+    light_.ensureChunk(cx, cy, cz);
+    auto& work = workFor(coord);
+
+    // Sky enters through the top face unless a tracked chunk covers it
+    if (!light_.hasChunk(cx, cy + 1, cz)) {
+        forEachFacePair(kUpFace, [&](int inner, int) { work.addQueue.push_back({cellIndex(inner), 0, kRelight}); });
+    }
+    if (const uint8_t* emitters = emitters_.chunkData(cx, cy, cz)) {
+        for (int i = 0; i < kChunkVolume; ++i) {
+            if (emitters[i] > 0)
+                work.addQueue.push_back({cellIndex(i), 0, kRelight | kBlockChannel});
+        }
+    }
+
+    for (int face = 0; face < kFaceCount; ++face) {
+        ChunkCoord n = across(coord, face);
+        const uint8_t* neighbor = light_.chunkData(n.cx, n.cy, n.cz);
+        if (!neighbor)
+            continue;
+        auto& neighborWork = workFor(n);
+        if (face == kDownFace) {
+            // The chunk below saw open sky through this one: take its sky
+            // columns back out and let this chunk's light replace them
+            forEachFacePair(face, [&](int, int outer) {
+                if (skyLight(neighbor[outer]) == kMaxLightLevel)
+                    neighborWork.removeQueue.push_back({cellIndex(outer), kMaxLightLevel, kForce});
+            });
+        }
+        // Neighbour cells bright enough to reach across the face spread into this chunk
+        forEachFacePair(face, [&](int, int outer) {
+            if (skyLight(neighbor[outer]) > 1)
+                neighborWork.addQueue.push_back({cellIndex(outer), 0, kRelight});
+            if (blockLight(neighbor[outer]) > 1)
+                neighborWork.addQueue.push_back({cellIndex(outer), 0, kRelight | kBlockChannel});
+        });
+    }
+}
+
+void VoxelLighting::removeChunk(int cx, int cy, int cz) {
+    ChunkCoord coord{cx, cy, cz};
+    const uint8_t* light = light_.chunkData(cx, cy, cz);
+    if (!light)
+        return;
+
+    // Light this chunk handed to its neighbours goes out as if its cells went dark
+    for (int face = 0; face < kFaceCount; ++face) {
+        ChunkCoord n = across(coord, face);
+        if (!light_.hasChunk(n.cx, n.cy, n.cz))
+            continue;
+        auto& queue = workFor(n).removeQueue;
+        uint8_t down = face == kDownFace ? kDownward : 0;
+        forEachFacePair(face, [&](int inner, int outer) {
+            if (uint8_t sky = skyLight(light[inner]))
+                queue.push_back({cellIndex(outer), sky, down});
+            if (uint8_t block = blockLight(light[inner]))
+                queue.push_back({cellIndex(outer), block, kBlockChannel});
+        });
+        if (face == kDownFace) {
+            // Open sky again
+            auto& addQueue = workFor(n).addQueue;
+            forEachFacePair(face, [&](int, int outer) { addQueue.push_back({cellIndex(outer), 0, kRelight}); });
+        }
+    }
+
+    light_.removeChunk(cx, cy, cz);
+    work_.erase(coord);
+}
+
+void VoxelLighting::voxelChanged(int x, int y, int z) {
+    int cx, cy, cz, lx, ly, lz;
+    ChunkedGrid<uint8_t>::worldToChunk(x, y, z, cx, cy, cz, lx, ly, lz);
+    if (!light_.hasChunk(cx, cy, cz))
+        return;
+    ChunkCoord coord{cx, cy, cz};
+    int index = lx + (ly << kChunkShift) + (lz << (2 * kChunkShift));
+    auto& work = workFor(coord);
+
+    if (density_.get(x, y, z) > threshold_) {
+        // Blocked: clear the cell and everything it lit, then relight from
+        // what is left (and from the cell itself if it emits)
+        work.removeQueue.push_back({cellIndex(index), 0, kForce});
+        work.removeQueue.push_back({cellIndex(index), 0, kForce | kBlockChannel});
+        return;
+    }
+
+    // Opened: the cell takes light from its neighbours and any source it is
+    work.addQueue.push_back({cellIndex(index), 0, kRelight});
+    work.addQueue.push_back({cellIndex(index), 0, kRelight | kBlockChannel});
+    for (int face = 0; face < kFaceCount; ++face)
+        relightNeighbor(coord, index, face);
+}
+
+void VoxelLighting::setEmitter(int x, int y, int z, uint8_t level) {
+    level = std::min(level, kMaxLightLevel);
+    uint8_t previous = emitters_.get(x, y, z);
+    if (level == previous)
+        return;
+    emitters_.set(x, y, z, level);
+
+    int cx, cy, cz, lx, ly, lz;
+    ChunkedGrid<uint8_t>::worldToChunk(x, y, z, cx, cy, cz, lx, ly, lz);
+    if (!light_.hasChunk(cx, cy, cz))
+        return;
+    int index = lx + (ly << kChunkShift) + (lz << (2 * kChunkShift));
+    auto& work = workFor({cx, cy, cz});
+    if (level > previous)
+        work.addQueue.push_back({cellIndex(index), 0, kRelight | kBlockChannel});
+    else
+        work.removeQueue.push_back({cellIndex(index), 0, kForce | kBlockChannel});
+}
+
+bool VoxelLighting::hasPendingWork() const {
+    return std::any_of(work_.begin(), work_.end(), [](const auto& entry) {
+        return !entry.second.removeQueue.empty() || !entry.second.addQueue.empty();
+    });
+}
+
+std::vector<ChunkCoord> VoxelLighting::propagate() {
+    FABRIC_ZONE_SCOPED_N("VoxelLighting::propagate");
+
+    // Every removal settles before any light spreads again, so relights
+    // never race a removal still in flight in another chunk
+    while (runRound(Round::Remove)) {
+    }
+    while (runRound(Round::Add)) {
+    }
+
+    std::vector<ChunkCoord> changed;
+    lastChangedCells_ = 0;
+    for (auto& [coord, work] : work_) {
+        if (!work.dirty)
+            continue;
+        lastChangedCells_ += work.changed;
+        changed.push_back(coord);
+        for (int face = 0; face < kFaceCount; ++face) {
+            ChunkCoord n = across(coord, face);
+            if ((work.changedFaces & (1 << face)) && light_.hasChunk(n.cx, n.cy, n.cz))
+                changed.push_back(n);
+        }
+        work.changed = 0;
+        work.changedFaces = 0;
+        work.dirty = false;
+    }
+
+    auto less = [](const ChunkCoord& a, const ChunkCoord& b) {
+        return std::tie(a.cx, a.cy, a.cz) < std::tie(b.cx, b.cy, b.cz);
+    };
+    std::sort(changed.begin(), changed.end(), less);
+    changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+    return changed;
+}
+
+bool VoxelLighting::runRound(Round round) {
+    tasks_.clear();
+    for (auto& [coord, work] : work_) {
+        const auto& queue = round == Round::Remove ? work.removeQueue : work.addQueue;
+        if (queue.empty())
+            continue;
+        tasks_.push_back({coord, &work, light_.ensureChunk(coord.cx, coord.cy, coord.cz),
+                          density_.chunkData(coord.cx, coord.cy, coord.cz),
+                          emitters_.chunkData(coord.cx, coord.cy, coord.cz),
+                          !light_.hasChunk(coord.cx, coord.cy + 1, coord.cz)});
+    }
+    if (tasks_.empty())
+        return false;
+
+    // Each task writes only its own chunk and outboxes
+    parallelFor(tasks_.size(), workers_, [this, round](size_t t) {
+        if (round == Round::Remove)
+            drainRemove(tasks_[t]);
+        else
+            drainAdd(tasks_[t]);
+    });
+
+    // Hand light crossing chunk faces to the neighbour for the next round;
+    // untracked neighbours have no light to receive it
+    for (auto& task : tasks_) {
+        for (int face = 0; face < kFaceCount; ++face) {
+            auto& outbox = task.work->outbox[face];
+            if (outbox.empty())
+                continue;
+            ChunkCoord n = across(task.coord, face);
+            if (light_.hasChunk(n.cx, n.cy, n.cz)) {
+                auto& target = workFor(n);
+                auto& queue = round == Round::Remove ? target.removeQueue : target.addQueue;
+                queue.insert(queue.end(), outbox.begin(), outbox.end());
+            }
+            outbox.clear();
+        }
+    }
+    return true;
+}
+
+void VoxelLighting::drainRemove(ChunkTask& task) const {
+    auto& queue = task.work->removeQueue;
+    auto& relight = task.work->addQueue;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        LightNode node = queue[head];
+        uint8_t channel = node.flags & kBlockChannel;
+        uint8_t current = levelOf(task.light[node.index], channel);
+        if (current == 0)
+            continue;
+
+        // A full-strength sky column is lit from above, not by its neighbours
+        bool skyColumn = !channel && (node.flags & kDownward) && node.level == kMaxLightLevel &&
+                         current == kMaxLightLevel;
+        if (!(node.flags & kForce) && !skyColumn && current >= node.level) {
+            // Lit by another path: spreads back into the cleared region later
+            relight.push_back({node.index, 0, static_cast<uint8_t>(kRelight | channel)});
+            continue;
+        }
+
+        write(task, node.index, channel, 0);
+        spread(task, queue, node.index, current, channel, Round::Remove);
+        if (sourceLevel(task, node.index, channel) > 0)
+            relight.push_back({node.index, 0, static_cast<uint8_t>(kRelight | channel)});
+    }
+    queue.clear();
+}
+
+void VoxelLighting::drainAdd(ChunkTask& task) const {
+    auto& queue = task.work->addQueue;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        LightNode node = queue[head];
+        uint8_t channel = node.flags & kBlockChannel;
+        uint8_t current = levelOf(task.light[node.index], channel);
+        uint8_t level = node.level;
+
+        if (node.flags & kRelight) {
+            level = std::max(current, sourceLevel(task, node.index, channel));
+            if (level == 0)
+                continue;
+            if (level > current)
+                write(task, node.index, channel, level);
+        } else {
+            if (level <= current || opaque(task, node.index))
+                continue;
+            write(task, node.index, channel, level);
+        }
+        spread(task, queue, node.index, level, channel, Round::Add);
+    }
+    queue.clear();
+}
+
+void VoxelLighting::spread(ChunkTask& task, std::vector<LightNode>& queue, int index, uint8_t level,
+                           uint8_t channel, Round round) const {
+    for (int face = 0; face < kFaceCount; ++face) {
+        uint8_t flags = channel;
+        uint8_t next = level;
+        if (round == Round::Remove) {
+            if (face == kDownFace)
+                flags |= kDownward;
+        } else if (channel || face != kDownFace || level != kMaxLightLevel) {
+            next = level - 1;
+            if (next == 0)
+                continue;
+        }
+
+        int neighbor = 0;
+        if (step(index, face, neighbor)) {
+            // Skip cells that would ignore the step anyway
+            if (round == Round::Add && levelOf(task.light[neighbor], channel) >= next)
+                continue;
+            queue.push_back({cellIndex(neighbor), next, flags});
+        } else {
+            task.work->outbox[face].push_back({cellIndex(neighbor), next, flags});
+        }
+    }
+}
+
+void VoxelLighting::write(ChunkTask& task, int index, uint8_t channel, uint8_t level) const {
+    uint8_t& packed = task.light[index];
+    packed = channel ? packLight(skyLight(packed), level) : packLight(level, blockLight(packed));
+
+    auto& work = *task.work;
+    ++work.changed;
+    work.dirty = true;
+    for (int axis = 0; axis < 3; ++axis) {
+        int c = axisCoord(index, axis);
+        if (c == kChunkMask)
+            work.changedFaces |= 1 << (axis * 2);
+        else if (c == 0)
+            work.changedFaces |= 1 << (axis * 2 + 1);
+    }
+}
+
+bool VoxelLighting::opaque(const ChunkTask& task, int index) const {
+    return task.density && task.density[index] > threshold_;
+}
+
+uint8_t VoxelLighting::sourceLevel(const ChunkTask& task, int index, uint8_t channel) const {
+    if (channel)
+        return task.emitters ? task.emitters[index] : 0;
+    bool top = axisCoord(index, 1) == kChunkMask;
+    return task.skyOpen && top && !opaque(task, index) ? kMaxLightLevel : 0;
+}
+
+} // namespace fabric
@@ -1,6 +1,9 @@
 #include "fabric/core/VoxelMesher.hh"
 
-#include <unordered_map>
+#include "fabric/core/VoxelLight.hh"
+
+#include <algorithm>
+#include <vector>
 
 namespace fabric {
 
@@ -45,6 +48,63 @@ uint32_t colorKey(float r, float g, float b, float a) {
            (static_cast<uint32_t>(toByte(b)) << 16) | (static_cast<uint32_t>(toByte(a)) << 24);
 }
 
+// Open-addressed colour key -> palette index map. Kept in thread-local
+// scratch so re-meshing reuses its slots; a generation stamp clears it in O(1).
+class PaletteLookup {
+  public:
+    void reset() {
+        size_ = 0;
+        if (++generation_ == 0) {
+            std::fill(slots_.begin(), slots_.end(), Slot{});
+            generation_ = 1;
+        }
+    }
+
+    // Index already assigned to key, or nullptr after reserving a slot for value
+    const uint16_t* findOrInsert(uint32_t key, uint16_t value) {
+        if ((size_ + 1) * 2 > slots_.size())
+            grow();
+        size_t mask = slots_.size() - 1;
+        for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+            auto& slot = slots_[i];
+            if (slot.stamp != generation_) {
+                slot = {key, generation_, value};
+                ++size_;
+                return nullptr;
+            }
+            if (slot.key == key)
+                return &slot.value;
+        }
+    }
+
+  private:
+    struct Slot {
+        uint32_t key = 0;
+        uint32_t stamp = 0;
+        uint16_t value = 0;
+    };
+
+    static size_t hash(uint32_t key) { return (key * 2654435761u) ^ (key >> 15); }
+
+    void grow() {
+        std::vector<Slot> old(std::max<size_t>(slots_.size() * 2, 64));
+        old.swap(slots_);
+        size_t mask = slots_.size() - 1;
+        for (const auto& slot : old) {
+            if (slot.stamp != generation_)
+                continue;
+            size_t i = hash(slot.key) & mask;
+            while (slots_[i].stamp == generation_)
+                i = (i + 1) & mask;
+            slots_[i] = slot;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    uint32_t generation_ = 0;
+};
+
 } // namespace
 
 bgfx::VertexLayout VoxelMesher::getVertexLayout() {
@@ -57,28 +117,49 @@ bgfx::VertexLayout VoxelMesher::getVertexLayout() {
 }
 
 ChunkMeshData VoxelMesher::meshChunkData(int cx, int cy, int cz, const ChunkedGrid<float>& density,
-                                         const ChunkedGrid<Vector4<float, Space::World>>& essence, float threshold) {
+                                         const ChunkedGrid<Vector4<float, Space::World>>& essence, float threshold,
+                                         const ChunkedGrid<uint8_t>* light) {
     ChunkMeshData data;
+    meshChunkData(cx, cy, cz, density, essence, data, threshold, light);
+    return data;
+}
+
+void VoxelMesher::meshChunkData(int cx, int cy, int cz, const ChunkedGrid<float>& density,
+                                const ChunkedGrid<Vector4<float, Space::World>>& essence, ChunkMeshData& data,
+                                float threshold, const ChunkedGrid<uint8_t>* light) {
+    data.vertices.clear();
+    data.indices.clear();
+    data.palette.clear();
     int base[3] = {cx * kChunkSize, cy * kChunkSize, cz * kChunkSize};
 
-    std::unordered_map<uint32_t, uint16_t> paletteMap;
+    thread_local PaletteLookup paletteMap;
+    paletteMap.reset();
     auto getOrAddPalette = [&](float r, float g, float b, float a) -> uint16_t {
-        uint32_t key = colorKey(r, g, b, a);
-        auto it = paletteMap.find(key);
-        if (it != paletteMap.end())
-            return it->second;
         auto idx = static_cast<uint16_t>(data.palette.size());
+        if (const uint16_t* existing = paletteMap.findOrInsert(colorKey(r, g, b, a), idx))
+            return *existing;
         data.palette.push_back({r, g, b, a});
-        paletteMap[key] = idx;
         return idx;
     };
 
+    // Packed light of a world cell. A chunk with no light tracked is open sky,
+    // for face light and corner smoothing alike, so borders don't darken.
+    auto lightOf = [light](int x, int y, int z) -> uint8_t {
+        int lcx, lcy, lcz, lx, ly, lz;
+        ChunkedGrid<uint8_t>::worldToChunk(x, y, z, lcx, lcy, lcz, lx, ly, lz);
+        const uint8_t* chunk = light->chunkData(lcx, lcy, lcz);
+        if (!chunk)
+            return packLight(kMaxLightLevel, 0);
+        return chunk[lx + (ly << kChunkShift) + (lz << (2 * kChunkShift))];
+    };
+
     for (int face = 0; face < 6; ++face) {
         const auto& ax = kFaceAxes[face];
 
         for (int slice = 0; slice < kChunkSize; ++slice) {
             bool mask[kChunkSize][kChunkSize] = {};
             uint16_t matIdx[kChunkSize][kChunkSize] = {};
+            uint8_t faceLight[kChunkSize][kChunkSize] = {};
 
             for (int v = 0; v < kChunkSize; ++v) {
                 for (int u = 0; u < kChunkSize; ++u) {
@@ -102,6 +183,8 @@ ChunkMeshData VoxelMesher::meshChunkData(int cx, int cy, int cz, const ChunkedGr
                         continue;
 
                     mask[u][v] = true;
+                    if (light)
+                        faceLight[u][v] = lightOf(nx, ny, nz);
                     auto e = essence.get(wx, wy, wz);
                     float r, g, b, a;
                     if (e.x == 0.0f && e.y == 0.0f && e.z == 0.0f && e.w == 0.0f) {
@@ -129,22 +212,35 @@ ChunkMeshData VoxelMesher::meshChunkData(int cx, int cy, int cz, const ChunkedGr
                 return density.get(world[0], world[1], world[2]) > threshold ? 1 : 0;
             };
 
+            // Light of an open cell beside the face
+            auto lightAt = [&](int cu, int cv) -> uint8_t {
+                int world[3];
+                world[ax.normalAxis] = normalWorld;
+                world[ax.uAxis] = base[ax.uAxis] + cu;
+                world[ax.vAxis] = base[ax.vAxis] + cv;
+                return lightOf(world[0], world[1], world[2]);
+            };
+
             for (int v = 0; v < kChunkSize; ++v) {
                 for (int u = 0; u < kChunkSize; ++u) {
                     if (!mask[u][v])
                         continue;
 
                     auto palIdx = matIdx[u][v];
+                    auto cellLight = faceLight[u][v];
+                    auto same = [&](int su, int sv) {
+                        return mask[su][sv] && matIdx[su][sv] == palIdx && faceLight[su][sv] == cellLight;
+                    };
 
                     int w = 1;
-                    while (u + w < kChunkSize && mask[u + w][v] && matIdx[u + w][v] == palIdx)
+                    while (u + w < kChunkSize && same(u + w, v))
                         ++w;
 
                     int h = 1;
                     while (v + h < kChunkSize) {
                         bool rowOk = true;
                         for (int du = 0; du < w; ++du) {
-                            if (!mask[u + du][v + h] || matIdx[u + du][v + h] != palIdx) {
+                            if (!same(u + du, v + h)) {
                                 rowOk = false;
                                 break;
                             }
@@ -182,13 +278,36 @@ ChunkMeshData VoxelMesher::meshChunkData(int cx, int cy, int cz, const ChunkedGr
 
                         aoVals[vi] = static_cast<uint8_t>((s1 && s2) ? 0 : 3 - (s1 + s2 + c));
 
+                        // Smooth light: mean of the open cells sharing this corner in front of the face
+                        uint8_t vertexLight = packLight(kMaxLightLevel, 0);
+                        if (light) {
+                            int sky = skyLight(cellLight);
+                            int block = blockLight(cellLight);
+                            int count = 1;
+                            auto accumulate = [&](int cu, int cv) {
+                                uint8_t packed = lightAt(cu, cv);
+                                sky += skyLight(packed);
+                                block += blockLight(packed);
+                                ++count;
+                            };
+                            if (!s1)
+                                accumulate(refU + su, refV);
+                            if (!s2)
+                                accumulate(refU, refV + sv);
+                            if (!c && !(s1 && s2))
+                                accumulate(refU + su, refV + sv);
+                            vertexLight = packLight(static_cast<uint8_t>((sky + count / 2) / count),
+                                                    static_cast<uint8_t>((block + count / 2) / count));
+                        }
+
                         uint8_t pos[3];
                         pos[ax.normalAxis] = static_cast<uint8_t>(nd);
                         pos[ax.uAxis] = static_cast<uint8_t>(useUMax ? u1 : u0);
                         pos[ax.vAxis] = static_cast<uint8_t>(useVMax ? v1 : v0);
 
                         data.vertices.push_back(
-                            VoxelVertex::pack(pos[0], pos[1], pos[2], static_cast<uint8_t>(face), aoVals[vi], palIdx));
+                            VoxelVertex::pack(pos[0], pos[1], pos[2], static_cast<uint8_t>(face), aoVals[vi], palIdx,
+                                              vertexLight));
                     }
 
                     // Flip quad diagonal when AO anisotropy suggests it
@@ -211,13 +330,12 @@ ChunkMeshData VoxelMesher::meshChunkData(int cx, int cy, int cz, const ChunkedGr
             }
         }
     }
-
-    return data;
 }
 
 ChunkMesh VoxelMesher::meshChunk(int cx, int cy, int cz, const ChunkedGrid<float>& density,
-                                 const ChunkedGrid<Vector4<float, Space::World>>& essence, float threshold) {
-    auto data = meshChunkData(cx, cy, cz, density, essence, threshold);
+                                 const ChunkedGrid<Vector4<float, Space::World>>& essence, float threshold,
+                                 const ChunkedGrid<uint8_t>* light) {
+    auto data = meshChunkData(cx, cy, cz, density, essence, threshold, light);
     if (data.vertices.empty())
         return ChunkMesh{};
 
@@ -232,7 +350,7 @@ ChunkMesh VoxelMesher::meshChunk(int cx, int cy, int cz, const ChunkedGrid<float
         BGFX_BUFFER_INDEX32);
 
     mesh.indexCount = static_cast<uint32_t>(data.indices.size());
-    mesh.palette = std::move(data.palette);
+    mesh.palette.assign(data.palette.begin(), data.palette.end());
     mesh.valid = true;
     return mesh;
 }
@@ -0,0 +1,532 @@
+#include "fabric/core/WorldSave.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/MappedFile.hh"
+#include "fabric/utils/Profiler.hh"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace fabric {
+
+namespace {
+
+static_assert(std::endian::native == std::endian::little, "WorldSave columns are stored in native little-endian form");
+
+constexpr char kMagic[4] = {'F', 'W', 'L', 'D'};
+constexpr size_t kSectionAlignment = 64;
+
+enum class SectionKind : uint32_t {
+    Schema = 1,
+    Table = 2,
+    Grid = 3
+};
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t reserved;
+    uint64_t tocOffset;
+    uint64_t fileSize;
+};
+
+struct SectionEntry {
+    uint32_t kind;
+    uint32_t reserved;
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct TableHeader {
+    uint32_t entityCount;
+    uint16_t componentCount;
+    uint16_t parentCount;
+};
+
+struct GridHeader {
+    uint32_t nameLength;
+    uint32_t cellSize;
+    uint32_t chunkCount;
+    uint32_t reserved;
+};
+
+size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+double toMs(std::chrono::nanoseconds d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+class FileWriter {
+  public:
+    explicit FileWriter(const std::string& path) : out_(path, std::ios::binary | std::ios::trunc) {
+        if (!out_)
+            throwError("cannot open " + path + " for writing");
+    }
+
+    void write(const void* data, size_t size) {
+        if (size == 0)
+            return;
+        if (!out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)))
+            throwError("write failed");
+        position_ += size;
+    }
+
+    template <typename T> void writeValue(const T& value) { write(&value, sizeof(T)); }
+
+    void pad(size_t alignment) {
+        static constexpr uint8_t kZeros[kSectionAlignment] = {};
+        write(kZeros, roundUp(position_, alignment) - position_);
+    }
+
+    void patch(uint64_t offset, const void* data, size_t size) {
+        out_.seekp(static_cast<std::streamoff>(offset));
+        if (!out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size)))
+            throwError("write failed");
+        out_.seekp(static_cast<std::streamoff>(position_));
+    }
+
+    void close() {
+        out_.close();
+        if (!out_)
+            throwError("close failed");
+    }
+
+    uint64_t position() const { return position_; }
+
+  private:
+    std::ofstream out_;
+    uint64_t position_ = 0;
+};
+
+// Bounds-checked cursor over one section of the mapped file. Sections start
+// 64-byte aligned, so alignment relative to the section holds in memory too.
+class SectionReader {
+  public:
+    SectionReader(const uint8_t* base, size_t size) : base_(base), size_(size) {}
+
+    template <typename T> const T* take(size_t count = 1) {
+        if (count > (size_ - position_) / sizeof(T))
+            throwError("truncated section");
+        auto* p = reinterpret_cast<const T*>(base_ + position_);
+        position_ += count * sizeof(T);
+        return p;
+    }
+
+    void align(size_t alignment) { position_ = std::min(roundUp(position_, alignment), size_); }
+
+  private:
+    const uint8_t* base_;
+    size_t size_;
+    size_t position_ = 0;
+};
+
+struct TablePlan {
+    uint32_t count = 0;
+    ecs_entity_t* entities = nullptr;
+    std::vector<ecs_id_t> ids;
+    std::vector<void*> columns; // Parallel to ids, null for tags and pairs
+    std::vector<ecs_entity_t> parents;
+    size_t dataColumns = 0;
+};
+
+struct GridPlan {
+    size_t grid = 0;
+    uint32_t chunkCount = 0;
+    const int32_t* coords = nullptr;
+    const uint8_t* cells = nullptr;
+};
+
+} // namespace
+
+WorldSave WorldSave::core() {
+    WorldSave save;
+    save.component<Position>("Position")
+        .component<Rotation>("Rotation")
+        .component<Scale>("Scale")
+        .component<BoundingBox>("BoundingBox")
+        .component<LocalToWorld>("LocalToWorld")
+        .component<SceneEntity>("SceneEntity")
+        .component<Renderable>("Renderable");
+    return save;
+}
+
+bool WorldSave::save(flecs::world& world, const std::string& path, WorldSaveStats* stats) const {
+    auto start = std::chrono::steady_clock::now();
+    WorldSaveStats result;
+    // Write beside the target and rename, so a failed save never clobbers a good file
+    std::string tempPath = path + ".tmp";
+    try {
+        write(world, tempPath, result);
+        std::filesystem::rename(tempPath, path);
+    } catch (const std::exception& e) {
+        std::error_code ec;
+        std::filesystem::remove(tempPath, ec);
+        FABRIC_LOG_ERROR("WorldSave: cannot save {}: {}", path, e.what());
+        return false;
+    }
+    result.elapsed = std::chrono::steady_clock::now() - start;
+
+    FABRIC_LOG_INFO("WorldSave: wrote {} entities in {} tables and {} chunks to {} ({:.1f} MB) in {:.2f} ms",
+                    result.entities, result.tables, result.chunks, path,
+                    static_cast<double>(result.bytes) / (1024.0 * 1024.0), toMs(result.elapsed));
+    if (stats)
+        *stats = result;
+    return true;
+}
+
+std::optional<WorldSaveStats> WorldSave::load(flecs::world& world, const std::string& path) const {
+    auto start = std::chrono::steady_clock::now();
+    WorldSaveStats result;
+    try {
+        read(world, path, result);
+    } catch (const std::exception& e) {
+        FABRIC_LOG_ERROR("WorldSave: cannot load {}: {}", path, e.what());
+        return std::nullopt;
+    }
+    result.elapsed = std::chrono::steady_clock::now() - start;
+
+    FABRIC_LOG_INFO("WorldSave: restored {} entities in {} tables and {} chunks from {} in {:.2f} ms",
+                    result.entities, result.tables, result.chunks, path, toMs(result.elapsed));
+    return result;
+}
+
+void WorldSave::write(flecs::world& world, const std::string& path, WorldSaveStats& stats) const {
+    FABRIC_ZONE_SCOPED_N("WorldSave::write");
+    ecs_world_t* ecs = world.c_ptr();
+
+    std::vector<ecs_entity_t> ids(components_.size());
+    std::unordered_map<ecs_id_t, uint32_t> slotById;
+    for (size_t i = 0; i < components_.size(); ++i) {
+        ids[i] = components_[i].resolve(world);
+        slotById.emplace(ids[i], static_cast<uint32_t>(i));
+    }
+
+    // Every archetype holding at least one saved component
+    std::vector<ecs_table_t*> tables;
+    std::unordered_set<const ecs_table_t*> savedTables;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ecs_query_desc_t desc{};
+        desc.terms[0].id = ids[i];
+        ecs_query_t* query = ecs_query_init(ecs, &desc);
+        if (!query)
+            throwError("cannot query component '" + components_[i].name + "'");
+        ecs_iter_t it = ecs_query_iter(ecs, query);
+        while (ecs_query_next(&it)) {
+            if (it.table && savedTables.insert(it.table).second)
+                tables.push_back(it.table);
+        }
+        ecs_query_fini(query);
+    }
+
+    FileWriter out(path);
+    FileHeader header{};
+    out.writeValue(header);
+    out.pad(kSectionAlignment);
+    std::vector<SectionEntry> toc;
+
+    auto beginSection = [&](SectionKind kind) {
+        out.pad(kSectionAlignment);
+        toc.push_back({static_cast<uint32_t>(kind), 0, out.position(), 0});
+    };
+    auto endSection = [&] { toc.back().size = out.position() - toc.back().offset; };
+
+    beginSection(SectionKind::Schema);
+    out.writeValue(static_cast<uint32_t>(components_.size()));
+    for (const auto& component : components_) {
+        out.writeValue(component.size);
+        out.writeValue(static_cast<uint32_t>(component.name.size()));
+        out.write(component.name.data(), component.name.size());
+        out.pad(4);
+    }
+    endSection();
+
+    std::vector<uint32_t> slots;
+    std::vector<uint64_t> parents;
+    for (ecs_table_t* table : tables) {
+        int32_t count = ecs_table_count(table);
+        if (count == 0)
+            continue;
+
+        slots.clear();
+        parents.clear();
+        const ecs_type_t* type = ecs_table_get_type(table);
+        for (int32_t t = 0; t < type->count; ++t) {
+            ecs_id_t id = type->array[t];
+            if (auto it = slotById.find(id); it != slotById.end()) {
+                slots.push_back(it->second);
+            } else if (ECS_IS_PAIR(id) && ECS_PAIR_FIRST(id) == EcsChildOf) {
+                // Keep the link only if the parent is saved too
+                ecs_entity_t parent = ecs_pair_second(ecs, id);
+                if (parent && savedTables.contains(ecs_get_table(ecs, parent)))
+                    parents.push_back(parent);
+            }
+        }
+        if (slots.size() + parents.size() > FLECS_ID_DESC_MAX)
+            throwError("table has more saved ids than ecs_bulk_init accepts");
+
+        beginSection(SectionKind::Table);
+        out.writeValue(TableHeader{static_cast<uint32_t>(count), static_cast<uint16_t>(slots.size()),
+                                   static_cast<uint16_t>(parents.size())});
+        out.write(slots.data(), slots.size() * sizeof(uint32_t));
+        out.pad(sizeof(uint64_t));
+        out.write(parents.data(), parents.size() * sizeof(uint64_t));
+        out.pad(kSectionAlignment);
+        out.write(ecs_table_entities(table), static_cast<size_t>(count) * sizeof(ecs_entity_t));
+
+        for (uint32_t slot : slots) {
+            uint32_t size = components_[slot].size;
+            if (size == 0)
+                continue;
+            int32_t column = ecs_table_get_column_index(ecs, table, ids[slot]);
+            if (column < 0)
+                throwError("component '" + components_[slot].name + "' has no column");
+            out.pad(kSectionAlignment);
+            out.write(ecs_table_get_column(table, column, 0), static_cast<size_t>(count) * size);
+            ++stats.columns;
+        }
+        endSection();
+
+        stats.entities += static_cast<size_t>(count);
+        ++stats.tables;
+    }
+
+    std::vector<int32_t> coords;
+    std::vector<const void*> chunks;
+    for (const auto& grid : grids_) {
+        coords.clear();
+        chunks.clear();
+        grid.forEachChunk([&](int cx, int cy, int cz, const void* cells) {
+            coords.insert(coords.end(), {cx, cy, cz});
+            chunks.push_back(cells);
+        });
+
+        beginSection(SectionKind::Grid);
+        out.writeValue(GridHeader{static_cast<uint32_t>(grid.name.size()), grid.cellSize,
+                                  static_cast<uint32_t>(chunks.size()), 0});
+        out.write(grid.name.data(), grid.name.size());
+        out.pad(sizeof(int32_t));
+        out.write(coords.data(), coords.size() * sizeof(int32_t));
+        out.pad(kSectionAlignment);
+        for (const void* cells : chunks)
+            out.write(cells, static_cast<size_t>(kChunkVolume) * grid.cellSize);
+        endSection();
+
+        stats.chunks += chunks.size();
+    }
+
+    out.pad(sizeof(uint64_t));
+    uint64_t tocOffset = out.position();
+    out.write(toc.data(), toc.size() * sizeof(SectionEntry));
+
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.sectionCount = static_cast<uint32_t>(toc.size());
+    header.tocOffset = tocOffset;
+    header.fileSize = out.position();
+    out.patch(0, &header, sizeof(header));
+    out.close();
+
+    stats.bytes = header.fileSize;
+}
+
+void WorldSave::read(flecs::world& world, const std::string& path, WorldSaveStats& stats) const {
+    FABRIC_ZONE_SCOPED_N("WorldSave::read");
+    ecs_world_t* ecs = world.c_ptr();
+
+    auto file = MappedFile::open(path);
+    const uint8_t* base = file.data();
+    const size_t size = file.size();
+
+    FileHeader header;
+    if (size < sizeof(header))
+        throwError("not a world save");
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+        throwError("not a world save");
+    if (header.version != kVersion)
+        throwError("unsupported version " + std::to_string(header.version));
+    if (header.fileSize != size || header.tocOffset > size ||
+        header.sectionCount > (size - header.tocOffset) / sizeof(SectionEntry))
+        throwError("truncated file");
+
+    auto* toc = reinterpret_cast<const SectionEntry*>(base + header.tocOffset);
+    auto section = [&](const SectionEntry& entry) {
+        if (entry.offset % kSectionAlignment != 0 || entry.offset > size || entry.size > size - entry.offset)
+            throwError("bad section bounds");
+        return SectionReader(base + entry.offset, entry.size);
+    };
+
+    // Parse and validate everything before the world changes
+    std::vector<ecs_entity_t> slotIds;
+    std::vector<uint32_t> slotSizes;
+    bool haveSchema = false;
+    std::vector<TablePlan> tables;
+    std::vector<GridPlan> grids;
+
+    for (uint32_t s = 0; s < header.sectionCount; ++s) {
+        const SectionEntry& entry = toc[s];
+        SectionReader in = section(entry);
+
+        switch (static_cast<SectionKind>(entry.kind)) {
+            case SectionKind::Schema: {
+                if (haveSchema)
+                    throwError("duplicate schema");
+                haveSchema = true;
+                uint32_t count = *in.take<uint32_t>();
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint32_t componentSize = *in.take<uint32_t>();
+                    uint32_t nameLength = *in.take<uint32_t>();
+                    std::string name(in.take<char>(nameLength), nameLength);
+                    in.align(4);
+
+                    auto it = std::find_if(components_.begin(), components_.end(),
+                                           [&](const auto& component) { return component.name == name; });
+                    if (it == components_.end()) {
+                        FABRIC_LOG_WARN("WorldSave: {} has component '{}' that is not in the schema, skipping", path,
+                                        name);
+                        slotIds.push_back(0);
+                    } else if (it->size != componentSize) {
+                        throwError("component '" + name + "' is " + std::to_string(componentSize) +
+                                   " bytes in the file but " + std::to_string(it->size) + " bytes here");
+                    } else {
+                        slotIds.push_back(it->resolve(world));
+                    }
+                    slotSizes.push_back(componentSize);
+                }
+                break;
+            }
+
+            case SectionKind::Table: {
+                if (!haveSchema)
+                    throwError("table before schema");
+                TableHeader table = *in.take<TableHeader>();
+                const uint32_t* slots = in.take<uint32_t>(table.componentCount);
+                in.align(sizeof(uint64_t));
+                const uint64_t* parents = in.take<uint64_t>(table.parentCount);
+                in.align(kSectionAlignment);
+
+                TablePlan plan;
+                plan.count = table.entityCount;
+                // The mapping is copy-on-write, so the non-const pointers Flecs wants are safe
+                plan.entities = const_cast<ecs_entity_t*>(in.take<ecs_entity_t>(table.entityCount));
+                for (uint16_t c = 0; c < table.componentCount; ++c) {
+                    uint32_t slot = slots[c];
+                    if (slot >= slotIds.size())
+                        throwError("table references unknown component");
+                    void* column = nullptr;
+                    if (slotSizes[slot] != 0) {
+                        in.align(kSectionAlignment);
+                        column = const_cast<uint8_t*>(in.take<uint8_t>(size_t{slotSizes[slot]} * table.entityCount));
+                    }
+                    if (slotIds[slot] == 0)
+                        continue;
+                    plan.ids.push_back(slotIds[slot]);
+                    plan.columns.push_back(column);
+                    plan.dataColumns += column ? 1 : 0;
+                }
+                for (uint16_t p = 0; p < table.parentCount; ++p) {
+                    plan.parents.push_back(parents[p]);
+                    plan.ids.push_back(ecs_pair(EcsChildOf, parents[p]));
+                    plan.columns.push_back(nullptr);
+                }
+                if (plan.ids.size() > FLECS_ID_DESC_MAX)
+                    throwError("table has more ids than ecs_bulk_init accepts");
+                if (plan.count > 0)
+                    tables.push_back(std::move(plan));
+                break;
+            }
+
+            case SectionKind::Grid: {
+                GridHeader grid = *in.take<GridHeader>();
+                std::string name(in.take<char>(grid.nameLength), grid.nameLength);
+                in.align(sizeof(int32_t));
+                const int32_t* coords = in.take<int32_t>(size_t{grid.chunkCount} * 3);
+                in.align(kSectionAlignment);
+                const uint8_t* cells = in.take<uint8_t>(size_t{grid.chunkCount} * kChunkVolume * grid.cellSize);
+
+                auto it = std::find_if(grids_.begin(), grids_.end(), [&](const auto& g) { return g.name == name; });
+                if (it == grids_.end()) {
+                    FABRIC_LOG_WARN("WorldSave: {} has grid '{}' that is not registered, skipping", path, name);
+                    break;
+                }
+                if (it->cellSize != grid.cellSize)
+                    throwError("grid '" + name + "' cell size does not match");
+                grids.push_back({static_cast<size_t>(it - grids_.begin()), grid.chunkCount, coords, cells});
+                break;
+            }
+
+            default:
+                FABRIC_LOG_WARN("WorldSave: {} has unknown section kind {}, skipping", path, entry.kind);
+                break;
+        }
+    }
+
+    // Parents must be saved entities or already alive in this world
+    std::unordered_set<ecs_entity_t> unresolvedParents;
+    for (const auto& plan : tables)
+        unresolvedParents.insert(plan.parents.begin(), plan.parents.end());
+
+    for (const auto& plan : tables) {
+        for (uint32_t i = 0; i < plan.count; ++i) {
+            ecs_entity_t e = plan.entities[i];
+            if (ecs_exists(ecs, e) && (ecs_get_alive(ecs, e) != e || ecs_get_table(ecs, e)))
+                throwError("entity " + std::to_string(e) + " is already in use");
+            if (!unresolvedParents.empty())
+                unresolvedParents.erase(e);
+        }
+    }
+    for (ecs_entity_t parent : unresolvedParents) {
+        if (!ecs_is_alive(ecs, parent))
+            throwError("parent " + std::to_string(parent) + " is not in the save");
+    }
+
+    // Claim every saved id first so ChildOf targets exist whatever the table order
+    for (const auto& plan : tables) {
+        for (uint32_t i = 0; i < plan.count; ++i)
+            ecs_make_alive(ecs, plan.entities[i]);
+    }
+
+    // One bulk insert per archetype; Flecs copies each column in one pass
+    for (auto& plan : tables) {
+        if (plan.ids.empty())
+            continue;
+        ecs_bulk_desc_t desc{};
+        desc.entities = plan.entities;
+        desc.count = static_cast<int32_t>(plan.count);
+        for (size_t i = 0; i < plan.ids.size(); ++i)
+            desc.ids[i] = plan.ids[i];
+        desc.data = plan.columns.data();
+        ecs_bulk_init(ecs, &desc);
+
+        stats.entities += plan.count;
+        stats.columns += plan.dataColumns;
+        ++stats.tables;
+    }
+
+    std::vector<bool> cleared(grids_.size(), false);
+    for (const auto& plan : grids) {
+        const auto& grid = grids_[plan.grid];
+        if (!cleared[plan.grid]) {
+            grid.clear();
+            cleared[plan.grid] = true;
+        }
+        const size_t chunkBytes = static_cast<size_t>(kChunkVolume) * grid.cellSize;
+        for (uint32_t c = 0; c < plan.chunkCount; ++c) {
+            void* cells = grid.ensureChunk(plan.coords[c * 3], plan.coords[c * 3 + 1], plan.coords[c * 3 + 2]);
+            std::memcpy(cells, plan.cells + c * chunkBytes, chunkBytes);
+        }
+        stats.chunks += plan.chunkCount;
+    }
+
+    stats.bytes = size;
+}
+
+} // namespace fabric
@@ -1,5 +1,6 @@
 #include "fabric/ui/BgfxRenderInterface.hh"
 #include "fabric/core/Log.hh"
+#include "fabric/core/TextureLoader.hh"
 #include "fabric/utils/Profiler.hh"
 
 #include "stb_image.h"
@@ -18,6 +19,9 @@
 
 #include <bx/math.h>
 
+#include <algorithm>
+#include <cstring>
+
 // Compiled shader bytecode generated at build time from .sc sources.
 // Each profile produces a separate header with a uint8_t array named
 // <shader_name>_<profile_ext> (e.g. vs_rmlui_mtl, fs_rmlui_glsl).
@@ -82,16 +86,32 @@ void BgfxRenderInterface::init() {
 void BgfxRenderInterface::shutdown() {
     FABRIC_ZONE_SCOPED;
 
-    for (auto& [handle, geom] : geometries_) {
-        bgfx::destroy(geom.vbh);
-        bgfx::destroy(geom.ibh);
+    batcher_.clear();
+
+    for (auto& geom : geometries_) {
+        if (!geom)
+            continue;
+        if (bgfx::isValid(geom->vbh))
+            bgfx::destroy(geom->vbh);
+        if (bgfx::isValid(geom->ibh))
+            bgfx::destroy(geom->ibh);
     }
     geometries_.clear();
+    freeGeomSlots_.clear();
 
-    for (auto& [handle, tex] : textures_) {
-        bgfx::destroy(tex);
+    for (auto& entry : textures_) {
+        if (entry.live)
+            releaseTextureEntry(entry);
     }
     textures_.clear();
+    freeTexSlots_.clear();
+    pendingAsync_.clear();
+
+    for (auto page : atlasPages_) {
+        bgfx::destroy(page);
+    }
+    atlasPages_.clear();
+    atlas_.clear();
 
     if (bgfx::isValid(whiteTexture_))
         bgfx::destroy(whiteTexture_);
@@ -110,6 +130,11 @@ void BgfxRenderInterface::shutdown() {
 void BgfxRenderInterface::beginFrame(uint16_t width, uint16_t height) {
     FABRIC_ZONE_SCOPED;
 
+    // Batches left over from a frame without endFrame() go out with this one
+    flushBatches();
+    submitCount_ = 0;
+    resolveAsyncTextures();
+
     float ortho[16];
     const bgfx::Caps* caps = bgfx::getCaps();
     bx::mtxOrtho(ortho, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 0.0f, 1000.0f, 0.0f,
@@ -122,77 +147,190 @@ void BgfxRenderInterface::beginFrame(uint16_t width, uint16_t height) {
     bgfx::touch(viewId_);
 }
 
+void BgfxRenderInterface::endFrame() {
+    FABRIC_ZONE_SCOPED;
+    flushBatches();
+    FABRIC_PLOT("UI submits", static_cast<int64_t>(submitCount_));
+}
+
 // -- Geometry --
 
 Rml::CompiledGeometryHandle BgfxRenderInterface::CompileGeometry(Rml::Span<const Rml::Vertex> vertices,
                                                                  Rml::Span<const int> indices) {
     FABRIC_ZONE_SCOPED;
 
-    CompiledGeom geom;
-    geom.vbh = bgfx::createVertexBuffer(
-        bgfx::copy(vertices.data(), static_cast<uint32_t>(vertices.size() * sizeof(Rml::Vertex))), layout_);
-    geom.ibh = bgfx::createIndexBuffer(bgfx::copy(indices.data(), static_cast<uint32_t>(indices.size() * sizeof(int))),
-                                       BGFX_BUFFER_INDEX32);
-    geom.indexCount = static_cast<uint32_t>(indices.size());
+    auto geom = std::make_unique<CompiledGeom>();
+    geom->vertices.assign(vertices.begin(), vertices.end());
+    geom->indexCount = static_cast<uint32_t>(indices.size());
+
+    if (vertices.size() <= UiBatcher::kMaxVertices) {
+        geom->indices16.reserve(indices.size());
+        for (int idx : indices) {
+            geom->indices16.push_back(static_cast<uint16_t>(idx));
+        }
+    } else {
+        geom->indices32.assign(indices.begin(), indices.end());
+    }
+
+    if (vertices.size() > kMaxBatchedGeometryVertices) {
+        geom->vbh = bgfx::createVertexBuffer(
+            bgfx::copy(vertices.data(), static_cast<uint32_t>(vertices.size() * sizeof(Rml::Vertex))), layout_);
+        if (!geom->indices16.empty()) {
+            geom->ibh = bgfx::createIndexBuffer(bgfx::copy(geom->indices16.data(),
+                                                           static_cast<uint32_t>(geom->indices16.size() * 2)));
+        } else {
+            geom->ibh = bgfx::createIndexBuffer(
+                bgfx::copy(geom->indices32.data(), static_cast<uint32_t>(geom->indices32.size() * 4)),
+                BGFX_BUFFER_INDEX32);
+        }
+    }
 
-    auto handle = nextGeomHandle_++;
-    geometries_[handle] = geom;
-    return static_cast<Rml::CompiledGeometryHandle>(handle);
+    uintptr_t slot;
+    if (!freeGeomSlots_.empty()) {
+        slot = freeGeomSlots_.back();
+        freeGeomSlots_.pop_back();
+        geometries_[slot] = std::move(geom);
+    } else {
+        slot = geometries_.size();
+        geometries_.push_back(std::move(geom));
+    }
+    return static_cast<Rml::CompiledGeometryHandle>(slot + 1);
 }
 
 void BgfxRenderInterface::RenderGeometry(Rml::CompiledGeometryHandle geometry, Rml::Vector2f translation,
                                          Rml::TextureHandle texture) {
     FABRIC_ZONE_SCOPED;
 
-    auto it = geometries_.find(static_cast<uintptr_t>(geometry));
-    if (it == geometries_.end())
+    const CompiledGeom* geom = findGeometry(geometry);
+    if (!geom)
         return;
 
-    const auto& geom = it->second;
+    const TextureEntry* tex = findTexture(texture);
 
+    // CSS transforms and large meshes keep their own submit; everything else
+    // is pre-translated on the CPU and merged into the shared stream.
+    bool batchable = !hasTransform_ && !bgfx::isValid(geom->vbh) && !geom->indices16.empty();
+    if (!batchable) {
+        flushBatches();
+        drawImmediate(*geom, translation, tex);
+        return;
+    }
+
+    if (!batcher_.canFit(geom->vertices.size(), geom->indices16.size()))
+        flushBatches();
+
+    batcher_.append(geom->vertices, geom->indices16, translation.x, translation.y, tex ? tex->uv : UiUvRect{},
+                    tex ? tex->handle : whiteTexture_, currentScissor());
+}
+
+void BgfxRenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle geometry) {
+    auto slot = static_cast<uintptr_t>(geometry) - 1;
+    CompiledGeom* geom = findGeometry(geometry);
+    if (!geom)
+        return;
+
+    if (bgfx::isValid(geom->vbh))
+        bgfx::destroy(geom->vbh);
+    if (bgfx::isValid(geom->ibh))
+        bgfx::destroy(geom->ibh);
+    geometries_[slot].reset();
+    freeGeomSlots_.push_back(slot);
+}
+
+BgfxRenderInterface::CompiledGeom* BgfxRenderInterface::findGeometry(Rml::CompiledGeometryHandle geometry) const {
+    auto handle = static_cast<uintptr_t>(geometry);
+    if (handle == 0 || handle > geometries_.size())
+        return nullptr;
+    return geometries_[handle - 1].get();
+}
+
+void BgfxRenderInterface::flushBatches() {
+    if (batcher_.empty())
+        return;
+
+    FABRIC_ZONE_SCOPED;
+
+    const auto& verts = batcher_.vertices();
+    const auto& idx = batcher_.indices();
+    auto numVerts = static_cast<uint32_t>(verts.size());
+    auto numIndices = static_cast<uint32_t>(idx.size());
+
+    bgfx::TransientVertexBuffer tvb;
+    bgfx::TransientIndexBuffer tib;
+    if (!bgfx::allocTransientBuffers(&tvb, layout_, numVerts, &tib, numIndices)) {
+        FABRIC_LOG_WARN("UI batch dropped: transient buffers exhausted ({} vertices, {} indices)", numVerts,
+                        numIndices);
+        batcher_.clear();
+        return;
+    }
+
+    std::memcpy(tvb.data, verts.data(), numVerts * sizeof(Rml::Vertex));
+    std::memcpy(tib.data, idx.data(), numIndices * sizeof(uint16_t));
+
+    for (const auto& batch : batcher_.batches()) {
+        bgfx::setVertexBuffer(0, &tvb);
+        bgfx::setIndexBuffer(&tib, batch.firstIndex, batch.indexCount);
+        bgfx::setTexture(0, texUniform_, batch.texture);
+        setScissorState(batch.scissor);
+        bgfx::setState(kRenderState);
+        bgfx::submit(viewId_, program_);
+        ++submitCount_;
+    }
+
+    batcher_.clear();
+}
+
+void BgfxRenderInterface::drawImmediate(const CompiledGeom& geom, Rml::Vector2f translation, const TextureEntry* tex) {
     // Build model matrix: combine stored transform with per-call translation
     float model[16];
     if (hasTransform_) {
-        // Start with the stored CSS transform, then apply translation
         float translate[16];
         bx::mtxTranslate(translate, translation.x, translation.y, 0.0f);
         bx::mtxMul(model, transform_, translate);
     } else {
         bx::mtxTranslate(model, translation.x, translation.y, 0.0f);
     }
-    bgfx::setTransform(model);
-
-    bgfx::setVertexBuffer(0, geom.vbh);
-    bgfx::setIndexBuffer(geom.ibh);
 
-    // Bind texture: use white placeholder if no texture provided
-    bgfx::TextureHandle tex = whiteTexture_;
-    if (texture) {
-        auto texIt = textures_.find(static_cast<uintptr_t>(texture));
-        if (texIt != textures_.end()) {
-            tex = texIt->second;
+    bool remapUv = tex && tex->region.has_value();
+    if (bgfx::isValid(geom.vbh) && !remapUv) {
+        bgfx::setVertexBuffer(0, geom.vbh);
+        bgfx::setIndexBuffer(geom.ibh);
+    } else {
+        // Atlas UVs are baked per draw, so stream through transient buffers
+        bool index32 = geom.indices16.empty();
+        auto numVerts = static_cast<uint32_t>(geom.vertices.size());
+        bgfx::TransientVertexBuffer tvb;
+        bgfx::TransientIndexBuffer tib;
+        if (bgfx::getAvailTransientVertexBuffer(numVerts, layout_) < numVerts ||
+            bgfx::getAvailTransientIndexBuffer(geom.indexCount, index32) < geom.indexCount) {
+            FABRIC_LOG_WARN("UI draw dropped: transient buffers exhausted");
+            return;
         }
-    }
-    bgfx::setTexture(0, texUniform_, tex);
+        bgfx::allocTransientVertexBuffer(&tvb, numVerts, layout_);
+        bgfx::allocTransientIndexBuffer(&tib, geom.indexCount, index32);
+
+        auto* dst = reinterpret_cast<Rml::Vertex*>(tvb.data); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        UiUvRect uv = tex ? tex->uv : UiUvRect{};
+        for (uint32_t i = 0; i < numVerts; ++i) {
+            dst[i] = geom.vertices[i];
+            dst[i].tex_coord.x = uv.u0 + geom.vertices[i].tex_coord.x * (uv.u1 - uv.u0);
+            dst[i].tex_coord.y = uv.v0 + geom.vertices[i].tex_coord.y * (uv.v1 - uv.v0);
+        }
+        if (index32)
+            std::memcpy(tib.data, geom.indices32.data(), geom.indexCount * sizeof(uint32_t));
+        else
+            std::memcpy(tib.data, geom.indices16.data(), geom.indexCount * sizeof(uint16_t));
 
-    // Per-draw-call scissor
-    if (scissorEnabled_) {
-        bgfx::setScissor(static_cast<uint16_t>(scissorRect_.Left()), static_cast<uint16_t>(scissorRect_.Top()),
-                         static_cast<uint16_t>(scissorRect_.Width()), static_cast<uint16_t>(scissorRect_.Height()));
+        bgfx::setVertexBuffer(0, &tvb);
+        bgfx::setIndexBuffer(&tib);
     }
 
+    bgfx::setTransform(model);
+    bgfx::setTexture(0, texUniform_, tex ? tex->handle : whiteTexture_);
+    setScissorState(currentScissor());
     bgfx::setState(kRenderState);
     bgfx::submit(viewId_, program_);
-}
-
-void BgfxRenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle geometry) {
-    auto it = geometries_.find(static_cast<uintptr_t>(geometry));
-    if (it == geometries_.end())
-        return;
-
-    bgfx::destroy(it->second.vbh);
-    bgfx::destroy(it->second.ibh);
-    geometries_.erase(it);
+    ++submitCount_;
 }
 
 // -- Textures --
@@ -201,6 +339,24 @@ Rml::TextureHandle BgfxRenderInterface::LoadTexture(Rml::Vector2i& dimensions, c
     FABRIC_ZONE_SCOPED;
 
     int w = 0, h = 0, channels = 0;
+    if (textureLoader_) {
+        // Only the header is read here; RmlUi needs the size for layout now
+        if (!stbi_info(source.c_str(), &w, &h, &channels)) {
+            FABRIC_LOG_WARN("LoadTexture failed: {}", source);
+            return Rml::TextureHandle(0);
+        }
+        dimensions.x = w;
+        dimensions.y = h;
+
+        TextureEntry entry;
+        entry.live = true;
+        entry.asyncId = textureLoader_->request(source);
+        entry.handle = textureLoader_->handle(entry.asyncId);
+        auto handle = addTexture(entry);
+        pendingAsync_.push_back(static_cast<uintptr_t>(handle));
+        return handle;
+    }
+
     unsigned char* data = stbi_load(source.c_str(), &w, &h, &channels, 4);
     if (!data) {
         FABRIC_LOG_WARN("LoadTexture failed: {}", source);
@@ -210,37 +366,121 @@ Rml::TextureHandle BgfxRenderInterface::LoadTexture(Rml::Vector2i& dimensions, c
     dimensions.x = w;
     dimensions.y = h;
 
-    uint32_t size = static_cast<uint32_t>(w * h * 4);
-    bgfx::TextureHandle tex =
-        bgfx::createTexture2D(static_cast<uint16_t>(w), static_cast<uint16_t>(h), false, 1, bgfx::TextureFormat::RGBA8,
-                              BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP, bgfx::copy(data, size));
-
+    auto handle = createTexture(data, w, h);
     stbi_image_free(data);
-
-    auto handle = nextTexHandle_++;
-    textures_[handle] = tex;
-    return static_cast<Rml::TextureHandle>(handle);
+    return handle;
 }
 
 Rml::TextureHandle BgfxRenderInterface::GenerateTexture(Rml::Span<const Rml::byte> source, Rml::Vector2i dimensions) {
     FABRIC_ZONE_SCOPED;
+    return createTexture(source.data(), dimensions.x, dimensions.y);
+}
+
+void BgfxRenderInterface::ReleaseTexture(Rml::TextureHandle texture) {
+    auto handle = static_cast<uintptr_t>(texture);
+    if (handle == 0 || handle > textures_.size() || !textures_[handle - 1].live)
+        return;
 
-    bgfx::TextureHandle tex = bgfx::createTexture2D(
-        static_cast<uint16_t>(dimensions.x), static_cast<uint16_t>(dimensions.y), false, 1, bgfx::TextureFormat::RGBA8,
-        BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP, bgfx::copy(source.data(), static_cast<uint32_t>(source.size())));
+    // A pending batch may still sample this texture
+    flushBatches();
+    releaseTextureEntry(textures_[handle - 1]);
+    freeTexSlots_.push_back(handle - 1);
+}
 
-    auto handle = nextTexHandle_++;
-    textures_[handle] = tex;
-    return static_cast<Rml::TextureHandle>(handle);
+const BgfxRenderInterface::TextureEntry* BgfxRenderInterface::findTexture(Rml::TextureHandle texture) const {
+    auto handle = static_cast<uintptr_t>(texture);
+    if (handle == 0 || handle > textures_.size() || !textures_[handle - 1].live)
+        return nullptr;
+    return &textures_[handle - 1];
 }
 
-void BgfxRenderInterface::ReleaseTexture(Rml::TextureHandle texture) {
-    auto it = textures_.find(static_cast<uintptr_t>(texture));
-    if (it == textures_.end())
+Rml::TextureHandle BgfxRenderInterface::createTexture(const uint8_t* rgba, int width, int height) {
+    TextureEntry entry;
+    entry.live = true;
+
+    bool small = width <= kMaxAtlasTextureSize && height <= kMaxAtlasTextureSize;
+    if (!small || !uploadToAtlas(entry, rgba, width, height)) {
+        auto size = static_cast<uint32_t>(width * height * 4);
+        entry.handle = bgfx::createTexture2D(static_cast<uint16_t>(width), static_cast<uint16_t>(height), false, 1,
+                                             bgfx::TextureFormat::RGBA8, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP,
+                                             bgfx::copy(rgba, size));
+    }
+    return addTexture(entry);
+}
+
+Rml::TextureHandle BgfxRenderInterface::addTexture(const TextureEntry& entry) {
+    uintptr_t slot;
+    if (!freeTexSlots_.empty()) {
+        slot = freeTexSlots_.back();
+        freeTexSlots_.pop_back();
+        textures_[slot] = entry;
+    } else {
+        slot = textures_.size();
+        textures_.push_back(entry);
+    }
+    return static_cast<Rml::TextureHandle>(slot + 1);
+}
+
+bool BgfxRenderInterface::uploadToAtlas(TextureEntry& entry, const uint8_t* rgba, int width, int height) {
+    // One texel border on each side, filled by edge extrusion, keeps bilinear
+    // filtering from bleeding neighbouring atlas entries into this one.
+    int paddedW = width + 2;
+    int paddedH = height + 2;
+    auto region = atlas_.allocate(static_cast<uint16_t>(paddedW), static_cast<uint16_t>(paddedH));
+    if (!region)
+        return false;
+
+    while (atlasPages_.size() <= region->page) {
+        atlasPages_.push_back(bgfx::createTexture2D(kAtlasPageSize, kAtlasPageSize, false, 1,
+                                                    bgfx::TextureFormat::RGBA8,
+                                                    BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP, nullptr));
+    }
+
+    const bgfx::Memory* mem = bgfx::alloc(static_cast<uint32_t>(paddedW * paddedH * 4));
+    for (int y = 0; y < paddedH; ++y) {
+        int srcY = std::clamp(y - 1, 0, height - 1);
+        for (int x = 0; x < paddedW; ++x) {
+            int srcX = std::clamp(x - 1, 0, width - 1);
+            std::memcpy(mem->data + (y * paddedW + x) * 4, rgba + (srcY * width + srcX) * 4, 4);
+        }
+    }
+    bgfx::updateTexture2D(atlasPages_[region->page], 0, 0, region->x, region->y, static_cast<uint16_t>(paddedW),
+                          static_cast<uint16_t>(paddedH), mem);
+
+    float inv = 1.0f / static_cast<float>(kAtlasPageSize);
+    entry.handle = atlasPages_[region->page];
+    entry.uv = UiUvRect{static_cast<float>(region->x + 1) * inv, static_cast<float>(region->y + 1) * inv,
+                        static_cast<float>(region->x + 1 + width) * inv,
+                        static_cast<float>(region->y + 1 + height) * inv};
+    entry.region = region;
+    return true;
+}
+
+void BgfxRenderInterface::releaseTextureEntry(TextureEntry& entry) {
+    if (entry.asyncId != 0) {
+        if (textureLoader_)
+            textureLoader_->release(entry.asyncId);
+    } else if (entry.region) {
+        atlas_.release(*entry.region);
+    } else if (bgfx::isValid(entry.handle)) {
+        bgfx::destroy(entry.handle);
+    }
+    entry = TextureEntry{};
+}
+
+void BgfxRenderInterface::resolveAsyncTextures() {
+    if (!textureLoader_ || pendingAsync_.empty())
         return;
 
-    bgfx::destroy(it->second);
-    textures_.erase(it);
+    std::erase_if(pendingAsync_, [this](uintptr_t handle) {
+        auto& entry = textures_[handle - 1];
+        if (!entry.live || entry.asyncId == 0)
+            return true;
+        if (textureLoader_->state(entry.asyncId) == TextureLoadState::Pending)
+            return false;
+        entry.handle = textureLoader_->handle(entry.asyncId);
+        return true;
+    });
 }
 
 // -- Scissor --
@@ -253,6 +493,19 @@ void BgfxRenderInterface::SetScissorRegion(Rml::Rectanglei region) {
     scissorRect_ = region;
 }
 
+UiScissor BgfxRenderInterface::currentScissor() const {
+    if (!scissorEnabled_)
+        return UiScissor{};
+    return UiScissor{true, static_cast<uint16_t>(scissorRect_.Left()), static_cast<uint16_t>(scissorRect_.Top()),
+                     static_cast<uint16_t>(scissorRect_.Width()), static_cast<uint16_t>(scissorRect_.Height())};
+}
+
+void BgfxRenderInterface::setScissorState(const UiScissor& scissor) {
+    if (scissor.enabled) {
+        bgfx::setScissor(scissor.x, scissor.y, scissor.width, scissor.height);
+    }
+}
+
 // -- Transform --
 
 void BgfxRenderInterface::SetTransform(const Rml::Matrix4f* transform) {
@@ -0,0 +1,86 @@
+#include "fabric/ui/TextureAtlas.hh"
+
+namespace fabric {
+
+TextureAtlas::TextureAtlas(uint16_t pageSize, uint16_t maxPages) : pageSize_(pageSize), maxPages_(maxPages) {}
+
+std::optional<AtlasRegion> TextureAtlas::allocate(uint16_t width, uint16_t height) {
+    if (width == 0 || height == 0 || width > pageSize_ || height > pageSize_)
+        return std::nullopt;
+
+    for (size_t i = 0; i < pages_.size(); ++i) {
+        if (auto region = allocateInPage(static_cast<uint16_t>(i), width, height))
+            return region;
+    }
+
+    if (pages_.size() >= maxPages_)
+        return std::nullopt;
+
+    pages_.emplace_back();
+    return allocateInPage(static_cast<uint16_t>(pages_.size() - 1), width, height);
+}
+
+std::optional<AtlasRegion> TextureAtlas::allocateInPage(uint16_t pageIdx, uint16_t width, uint16_t height) {
+    auto& page = pages_[pageIdx];
+
+    // Best fit: the shortest existing shelf that is tall enough and has room
+    Shelf* best = nullptr;
+    for (auto& shelf : page.shelves) {
+        if (shelf.height < height || shelf.cursorX + width > pageSize_)
+            continue;
+        if (!best || shelf.height < best->height)
+            best = &shelf;
+    }
+
+    // Avoid parking small glyphs on tall shelves when a new shelf is cheaper
+    bool wasteful = best && best->height > height * 2;
+    if ((!best || wasteful) && page.nextShelfY + height <= pageSize_) {
+        page.shelves.push_back(Shelf{page.nextShelfY, height, 0});
+        page.nextShelfY = static_cast<uint16_t>(page.nextShelfY + height);
+        best = &page.shelves.back();
+    }
+
+    if (!best)
+        return std::nullopt;
+
+    AtlasRegion region{pageIdx, best->cursorX, best->y, width, height};
+    best->cursorX = static_cast<uint16_t>(best->cursorX + width);
+    ++page.live;
+    return region;
+}
+
+void TextureAtlas::release(const AtlasRegion& region) {
+    if (region.page >= pages_.size())
+        return;
+    auto& page = pages_[region.page];
+    if (page.live == 0)
+        return;
+    if (--page.live == 0) {
+        page.shelves.clear();
+        page.nextShelfY = 0;
+    }
+}
+
+void TextureAtlas::clear() {
+    pages_.clear();
+}
+
+uint16_t TextureAtlas::pageSize() const {
+    return pageSize_;
+}
+
+uint16_t TextureAtlas::maxPages() const {
+    return maxPages_;
+}
+
+size_t TextureAtlas::pageCount() const {
+    return pages_.size();
+}
+
+uint32_t TextureAtlas::liveRegions(uint16_t page) const {
+    if (page >= pages_.size())
+        return 0;
+    return pages_[page].live;
+}
+
+} // namespace fabric
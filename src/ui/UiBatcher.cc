@@ -0,0 +1,64 @@
+#include "fabric/ui/UiBatcher.hh"
+
+namespace fabric {
+
+bool UiBatcher::canFit(size_t vertexCount, size_t indexCount) const {
+    return vertices_.size() + vertexCount <= kMaxVertices && indices_.size() + indexCount <= kMaxIndices;
+}
+
+void UiBatcher::append(std::span<const Rml::Vertex> vertices, std::span<const uint16_t> indices, float translateX,
+                       float translateY, const UiUvRect& uv, bgfx::TextureHandle texture, const UiScissor& scissor) {
+    auto base = static_cast<uint16_t>(vertices_.size());
+    auto firstIndex = static_cast<uint32_t>(indices_.size());
+
+    float du = uv.u1 - uv.u0;
+    float dv = uv.v1 - uv.v0;
+    for (const auto& v : vertices) {
+        Rml::Vertex out = v;
+        out.position.x += translateX;
+        out.position.y += translateY;
+        out.tex_coord.x = uv.u0 + v.tex_coord.x * du;
+        out.tex_coord.y = uv.v0 + v.tex_coord.y * dv;
+        vertices_.push_back(out);
+    }
+
+    for (uint16_t idx : indices) {
+        indices_.push_back(static_cast<uint16_t>(base + idx));
+    }
+
+    auto count = static_cast<uint32_t>(indices.size());
+    if (!batches_.empty()) {
+        auto& last = batches_.back();
+        if (last.texture.idx == texture.idx && last.scissor == scissor &&
+            last.firstIndex + last.indexCount == firstIndex) {
+            last.indexCount += count;
+            return;
+        }
+    }
+
+    batches_.push_back(UiDrawBatch{texture, scissor, firstIndex, count});
+}
+
+void UiBatcher::clear() {
+    vertices_.clear();
+    indices_.clear();
+    batches_.clear();
+}
+
+bool UiBatcher::empty() const {
+    return batches_.empty();
+}
+
+const std::vector<Rml::Vertex>& UiBatcher::vertices() const {
+    return vertices_;
+}
+
+const std::vector<uint16_t>& UiBatcher::indices() const {
+    return indices_;
+}
+
+const std::vector<UiDrawBatch>& UiBatcher::batches() const {
+    return batches_;
+}
+
+} // namespace fabric
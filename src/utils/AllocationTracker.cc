@@ -0,0 +1,47 @@
+#include "fabric/utils/AllocationTracker.hh"
+#include "fabric/utils/Metrics.hh"
+
+#include <atomic>
+
+namespace fabric {
+
+namespace {
+
+// All constant-initialized: the hooks run before any dynamic initializer
+std::atomic<bool> hooksLinked{false};
+Counter allocationCount;
+Counter freeCount;
+Counter allocatedBytes;
+thread_local AllocationStats threadStats;
+
+} // namespace
+
+bool AllocationTracker::available() noexcept {
+    return hooksLinked.load(std::memory_order_relaxed);
+}
+
+AllocationStats AllocationTracker::global() noexcept {
+    return {allocationCount.value(), freeCount.value(), allocatedBytes.value()};
+}
+
+AllocationStats AllocationTracker::thread() noexcept {
+    return threadStats;
+}
+
+void AllocationTracker::noteAllocation(size_t bytes) noexcept {
+    ++threadStats.allocations;
+    threadStats.bytes += bytes;
+    allocationCount.add();
+    allocatedBytes.add(bytes);
+}
+
+void AllocationTracker::noteFree() noexcept {
+    ++threadStats.frees;
+    freeCount.add();
+}
+
+void AllocationTracker::markAvailable() noexcept {
+    hooksLinked.store(true, std::memory_order_relaxed);
+}
+
+} // namespace fabric
@@ -1,5 +1,328 @@
-// BufferPool.cc: Fixed-size slab allocator
-// Header-only implementation; this file exists for CMake source grouping
-// and future non-inline additions.
-
 #include "fabric/utils/BufferPool.hh"
+
+#include <algorithm>
+#include <chrono>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace fabric {
+
+namespace {
+
+constexpr size_t kSlotAlignment = alignof(std::max_align_t);
+constexpr size_t kSlabAlignment = 64;
+constexpr size_t kHugePageSize = size_t{2} << 20;
+
+size_t roundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+// Free-stack head: slot index in the low word, ABA tag in the high word
+uint64_t packHead(uint32_t index, uint32_t tag) {
+    return (static_cast<uint64_t>(tag) << 32) | index;
+}
+
+uint32_t headIndex(uint64_t head) {
+    return static_cast<uint32_t>(head);
+}
+
+uint32_t headTag(uint64_t head) {
+    return static_cast<uint32_t>(head >> 32);
+}
+
+size_t magazineShard() {
+    static std::atomic<size_t> next{0};
+    thread_local size_t shard = next.fetch_add(1, std::memory_order_relaxed) % BufferPool::kMagazineShards;
+    return shard;
+}
+
+} // namespace
+
+struct BufferPool::SizeClass {
+    struct alignas(64) Magazine {
+        std::atomic_flag busy;
+        uint32_t count = 0;
+        std::array<uint32_t, kMaxMagazineSize> slots{};
+    };
+
+    size_t slotSize = 0;
+    size_t stride = 0;
+    size_t slotsPerSlab = 0;
+    size_t maxSlabs = 0;
+    size_t slabBytes = 0;
+
+    std::unique_ptr<std::atomic<uint8_t*>[]> slabs;
+    std::atomic<size_t> slabCount{0};
+    std::unique_ptr<std::atomic<uint32_t>[]> next;
+    std::atomic<uint64_t> head{packHead(kEmpty, 0)};
+    std::mutex growMutex;
+    std::array<Magazine, kMagazineShards> magazines;
+
+    std::atomic<size_t> borrowed{0};
+    std::atomic<size_t> highWater{0};
+    std::atomic<uint64_t> borrows{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> waits{0};
+    std::atomic<uint64_t> waitNanos{0};
+    std::atomic<uint64_t> grows{0};
+};
+
+BufferPool::BufferPool(size_t slotSize, size_t slotCount, std::pmr::memory_resource* resource)
+    : BufferPool(BufferPoolConfig{.classes = {{slotSize, slotCount}}, .resource = resource}) {}
+
+BufferPool::BufferPool(const BufferPoolConfig& config)
+    : config_(config), resource_(config.resource ? config.resource : std::pmr::get_default_resource()) {
+    if (config_.classes.empty())
+        throwError("BufferPool needs at least one size class");
+    if (config_.magazineSize > kMaxMagazineSize)
+        throwError("BufferPool magazine size exceeds kMaxMagazineSize");
+
+    std::sort(config_.classes.begin(), config_.classes.end(),
+              [](const BufferPoolClass& a, const BufferPoolClass& b) { return a.slotSize < b.slotSize; });
+
+    for (const auto& spec : config_.classes) {
+        if (spec.slotSize == 0 || spec.slotCount == 0)
+            throwError("BufferPool size classes need a non-zero slot size and count");
+
+        auto sc = std::make_unique<SizeClass>();
+        sc->slotSize = spec.slotSize;
+        sc->stride = roundUp(spec.slotSize, kSlotAlignment);
+        sc->slotsPerSlab = spec.slotCount;
+        sc->maxSlabs = config_.growable ? std::max<size_t>(config_.maxSlabs, 1) : 1;
+        sc->slabBytes = sc->stride * sc->slotsPerSlab;
+        if (config_.hugePages)
+            sc->slabBytes = roundUp(sc->slabBytes, kHugePageSize);
+        if (sc->slotsPerSlab * sc->maxSlabs >= kEmpty)
+            throwError("BufferPool size class has too many slots");
+
+        sc->slabs = std::make_unique<std::atomic<uint8_t*>[]>(sc->maxSlabs);
+        sc->next = std::make_unique<std::atomic<uint32_t>[]>(sc->slotsPerSlab * sc->maxSlabs);
+        addSlab(*sc);
+        classes_.push_back(std::move(sc));
+    }
+}
+
+BufferPool::~BufferPool() {
+    size_t alignment = config_.hugePages ? kHugePageSize : kSlabAlignment;
+    for (auto& sc : classes_) {
+        for (size_t i = 0; i < sc->slabCount.load(std::memory_order_acquire); ++i)
+            resource_->deallocate(sc->slabs[i].load(std::memory_order_relaxed), sc->slabBytes, alignment);
+    }
+}
+
+BufferSlot BufferPool::borrow(size_t minSize) {
+    auto classIndex = classFor(minSize);
+    if (!classIndex)
+        throwError("BufferPool has no slot of " + std::to_string(minSize) + " bytes");
+
+    if (auto slot = tryBorrowFrom(*classIndex))
+        return std::move(*slot);
+
+    auto& sc = *classes_[*classIndex];
+    sc.waits.fetch_add(1, std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+
+    std::unique_lock lock(waitMutex_);
+    waiters_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::optional<BufferSlot> slot;
+    while (!(slot = tryBorrowFrom(*classIndex)))
+        waitCv_.wait(lock);
+    waiters_.fetch_sub(1);
+
+    auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    sc.waitNanos.fetch_add(static_cast<uint64_t>(waited.count()), std::memory_order_relaxed);
+    return std::move(*slot);
+}
+
+std::optional<BufferSlot> BufferPool::tryBorrow(size_t minSize) {
+    auto classIndex = classFor(minSize);
+    if (!classIndex)
+        return std::nullopt;
+    auto slot = tryBorrowFrom(*classIndex);
+    if (!slot)
+        classes_[*classIndex]->misses.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+size_t BufferPool::available() const {
+    size_t total = 0;
+    for (const auto& sc : classes_)
+        total += sc->slabCount.load(std::memory_order_acquire) * sc->slotsPerSlab -
+                 sc->borrowed.load(std::memory_order_acquire);
+    return total;
+}
+
+size_t BufferPool::capacity() const {
+    size_t total = 0;
+    for (const auto& sc : classes_)
+        total += sc->slabCount.load(std::memory_order_acquire) * sc->slotsPerSlab;
+    return total;
+}
+
+size_t BufferPool::slotSize() const {
+    return classes_.back()->slotSize;
+}
+
+std::vector<BufferPoolClassStats> BufferPool::stats() const {
+    std::vector<BufferPoolClassStats> result;
+    result.reserve(classes_.size());
+    for (const auto& sc : classes_) {
+        BufferPoolClassStats s;
+        s.slotSize = sc->slotSize;
+        s.capacity = sc->slabCount.load(std::memory_order_acquire) * sc->slotsPerSlab;
+        s.borrowed = sc->borrowed.load(std::memory_order_relaxed);
+        s.highWater = sc->highWater.load(std::memory_order_relaxed);
+        s.borrows = sc->borrows.load(std::memory_order_relaxed);
+        s.misses = sc->misses.load(std::memory_order_relaxed);
+        s.waits = sc->waits.load(std::memory_order_relaxed);
+        s.waitNanos = sc->waitNanos.load(std::memory_order_relaxed);
+        s.grows = sc->grows.load(std::memory_order_relaxed);
+        result.push_back(s);
+    }
+    return result;
+}
+
+std::optional<size_t> BufferPool::classFor(size_t minSize) const {
+    for (size_t i = 0; i < classes_.size(); ++i) {
+        if (classes_[i]->slotSize >= minSize)
+            return i;
+    }
+    return std::nullopt;
+}
+
+std::optional<BufferSlot> BufferPool::tryBorrowFrom(size_t classIndex) {
+    auto& sc = *classes_[classIndex];
+
+    // Own magazine, then the shared stack, then a new slab, then other
+    // threads' magazines so a parked slot is never reported as missing
+    uint32_t index = kEmpty;
+    if (config_.magazineSize > 0) {
+        auto& magazine = sc.magazines[magazineShard()];
+        if (!magazine.busy.test_and_set(std::memory_order_acquire)) {
+            if (magazine.count > 0)
+                index = magazine.slots[--magazine.count];
+            magazine.busy.clear(std::memory_order_release);
+        }
+    }
+    if (index == kEmpty)
+        index = popFree(sc);
+    if (index == kEmpty && config_.growable && grow(sc))
+        index = popFree(sc);
+    if (index == kEmpty && config_.magazineSize > 0)
+        index = stealFromMagazines(sc);
+    if (index == kEmpty)
+        return std::nullopt;
+
+    size_t out = sc.borrowed.fetch_add(1, std::memory_order_acq_rel) + 1;
+    size_t peak = sc.highWater.load(std::memory_order_relaxed);
+    while (out > peak && !sc.highWater.compare_exchange_weak(peak, out, std::memory_order_relaxed)) {
+    }
+    sc.borrows.fetch_add(1, std::memory_order_relaxed);
+    return BufferSlot(this, slotData(sc, index), sc.slotSize, static_cast<uint32_t>(classIndex), index);
+}
+
+uint32_t BufferPool::popFree(SizeClass& sc) {
+    uint64_t head = sc.head.load(std::memory_order_acquire);
+    while (headIndex(head) != kEmpty) {
+        // next[] is preallocated, so reading a stale entry is harmless; the
+        // tag makes the CAS fail if the slot was popped and pushed meanwhile
+        uint32_t next = sc.next[headIndex(head)].load(std::memory_order_relaxed);
+        if (sc.head.compare_exchange_weak(head, packHead(next, headTag(head) + 1), std::memory_order_acquire,
+                                          std::memory_order_acquire))
+            return headIndex(head);
+    }
+    return kEmpty;
+}
+
+void BufferPool::pushFree(SizeClass& sc, uint32_t index) {
+    uint64_t head = sc.head.load(std::memory_order_relaxed);
+    do {
+        sc.next[index].store(headIndex(head), std::memory_order_relaxed);
+    } while (!sc.head.compare_exchange_weak(head, packHead(index, headTag(head) + 1), std::memory_order_release,
+                                            std::memory_order_relaxed));
+}
+
+uint32_t BufferPool::stealFromMagazines(SizeClass& sc) {
+    for (auto& magazine : sc.magazines) {
+        if (magazine.busy.test_and_set(std::memory_order_acquire))
+            continue;
+        uint32_t index = magazine.count > 0 ? magazine.slots[--magazine.count] : kEmpty;
+        magazine.busy.clear(std::memory_order_release);
+        if (index != kEmpty)
+            return index;
+    }
+    return kEmpty;
+}
+
+bool BufferPool::grow(SizeClass& sc) {
+    std::lock_guard lock(sc.growMutex);
+    // Another thread may have grown or returned slots while we waited
+    if (headIndex(sc.head.load(std::memory_order_acquire)) != kEmpty)
+        return true;
+    if (sc.slabCount.load(std::memory_order_relaxed) >= sc.maxSlabs)
+        return false;
+    addSlab(sc);
+    sc.grows.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void BufferPool::addSlab(SizeClass& sc) {
+    size_t alignment = config_.hugePages ? kHugePageSize : kSlabAlignment;
+    auto* slab = static_cast<uint8_t*>(resource_->allocate(sc.slabBytes, alignment));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (config_.hugePages)
+        madvise(slab, sc.slabBytes, MADV_HUGEPAGE);
+#endif
+
+    size_t slabIndex = sc.slabCount.load(std::memory_order_relaxed);
+    sc.slabs[slabIndex].store(slab, std::memory_order_release);
+    sc.slabCount.store(slabIndex + 1, std::memory_order_release);
+
+    // Push in reverse so the lowest address is borrowed first
+    auto first = static_cast<uint32_t>(slabIndex * sc.slotsPerSlab);
+    for (size_t i = sc.slotsPerSlab; i > 0; --i)
+        pushFree(sc, first + static_cast<uint32_t>(i - 1));
+}
+
+uint8_t* BufferPool::slotData(const SizeClass& sc, uint32_t index) const {
+    uint8_t* slab = sc.slabs[index / sc.slotsPerSlab].load(std::memory_order_acquire);
+    return slab + (index % sc.slotsPerSlab) * sc.stride;
+}
+
+void BufferPool::returnSlot(uint32_t sizeClass, uint32_t index) {
+    auto& sc = *classes_[sizeClass];
+    sc.borrowed.fetch_sub(1, std::memory_order_acq_rel);
+
+    // Blocked borrowers go straight to the shared stack, so skip the cache
+    bool cached = false;
+    if (config_.magazineSize > 0 && waiters_.load() == 0) {
+        auto& magazine = sc.magazines[magazineShard()];
+        if (!magazine.busy.test_and_set(std::memory_order_acquire)) {
+            // Full: spill half so the cache keeps room for the next return
+            if (magazine.count == config_.magazineSize) {
+                size_t keep = config_.magazineSize / 2;
+                while (magazine.count > keep)
+                    pushFree(sc, magazine.slots[--magazine.count]);
+            }
+            magazine.slots[magazine.count++] = index;
+            magazine.busy.clear(std::memory_order_release);
+            cached = true;
+        }
+    }
+    if (!cached)
+        pushFree(sc, index);
+
+    // Pairs with the fence in borrow(): either the waiter sees this slot on
+    // its next attempt or we see the waiter here. Taking the mutex orders the
+    // notify after the waiter has gone to sleep.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) > 0) {
+        { std::lock_guard lock(waitMutex_); }
+        waitCv_.notify_all();
+    }
+}
+
+} // namespace fabric
@@ -0,0 +1,417 @@
+#include "fabric/utils/BuiltinProfiler.hh"
+#include "fabric/core/Log.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace fabric::profiler {
+
+namespace {
+
+struct CopiedEvent {
+    uint64_t timestamp;
+    const char* name;
+};
+
+// Copy buffer events [start, head) and drop any slots the owner overwrote
+// while they were read. Returns the index of the first event copied.
+uint64_t copyEvents(const ZoneEvent* ring, uint64_t start, uint64_t head, const std::atomic<uint64_t>& liveHead,
+                    std::vector<CopiedEvent>& events) {
+    events.clear();
+    for (uint64_t i = start; i < head; ++i) {
+        const auto& event = ring[i & (ThreadBuffer::kCapacity - 1)];
+        events.push_back({event.timestamp.load(std::memory_order_relaxed), event.name.load(std::memory_order_relaxed)});
+    }
+
+    uint64_t after = liveHead.load(std::memory_order_acquire);
+    if (after > ThreadBuffer::kCapacity && after - ThreadBuffer::kCapacity > start) {
+        auto skip = static_cast<size_t>(std::min<uint64_t>(after - ThreadBuffer::kCapacity - start, events.size()));
+        events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(skip));
+        start += skip;
+    }
+    return start;
+}
+
+} // namespace
+
+class Registry {
+  public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    // Reuses the buffer of a thread that has exited, if any. Its events are
+    // discarded and it gets a fresh track id.
+    ThreadBuffer* acquire() {
+        std::lock_guard lock(mutex_);
+        uint32_t id = nextId_++;
+        if (!free_.empty()) {
+            ThreadBuffer* buffer = free_.back();
+            free_.pop_back();
+            buffer->id_ = id;
+            buffer->name_.clear();
+            buffer->tail_.store(buffer->head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return buffer;
+        }
+        buffers_.push_back(std::make_unique<ThreadBuffer>(id));
+        cursors_.emplace_back();
+        return buffers_.back().get();
+    }
+
+    // The exited thread's events stay exportable until the buffer is reused
+    void release(ThreadBuffer* buffer) {
+        std::lock_guard lock(mutex_);
+        free_.push_back(buffer);
+    }
+
+    void setName(ThreadBuffer& buffer, const char* name) {
+        std::lock_guard lock(mutex_);
+        buffer.name_ = name;
+    }
+
+    void reset() {
+        std::lock_guard lock(mutex_);
+        for (auto& buffer : buffers_) {
+            buffer->tail_.store(buffer->head_.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+        lastFrameZones_.clear();
+    }
+
+    size_t exportChromeTrace(std::ostream& out);
+
+    // Fold every zone that ended at or before frameEnd into per-name totals
+    // and publish them as the last frame's zones
+    void aggregateFrame(uint64_t frameEnd);
+
+    std::vector<ZoneTotal> lastFrameZones() {
+        std::lock_guard lock(mutex_);
+        return lastFrameZones_;
+    }
+
+    // Frame statistics are only touched by the thread calling frameMark()
+    uint64_t frameCount = 0;
+    uint64_t lastFrameTicks = 0;
+    uint64_t lastFrameTimestamp = 0;
+    double hitchThresholdMs = 0.0;
+    std::string hitchDirectory = ".";
+    std::chrono::steady_clock::time_point lastHitchExport{};
+
+    const uint64_t baseTicks = readTimestamp();
+    const std::chrono::steady_clock::time_point baseTime = std::chrono::steady_clock::now();
+
+  private:
+    Registry() = default;
+
+    // Frame aggregation progress through one buffer; only touched by frameMark()
+    struct ZoneCursor {
+        uint64_t next = 0;              // First event not yet aggregated
+        std::vector<CopiedEvent> open;  // Begins still waiting for their end
+    };
+
+    struct ZoneTicks {
+        uint64_t count = 0;
+        uint64_t ticks = 0;
+    };
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+    std::vector<ZoneCursor> cursors_; // Parallel to buffers_
+    std::vector<ThreadBuffer*> free_;
+    uint32_t nextId_ = 1;
+
+    std::vector<CopiedEvent> scratch_;
+    std::unordered_map<std::string_view, ZoneTicks> frameTicks_;
+    std::vector<ZoneTotal> lastFrameZones_;
+};
+
+namespace {
+
+void writeEscaped(std::ostream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        switch (*c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(*c));
+                    out << buf;
+                } else {
+                    out << *c;
+                }
+        }
+    }
+}
+
+} // namespace
+
+void Registry::aggregateFrame(uint64_t frameEnd) {
+    std::lock_guard lock(mutex_);
+    frameTicks_.clear();
+
+    for (size_t b = 0; b < buffers_.size(); ++b) {
+        auto& buffer = *buffers_[b];
+        auto& cursor = cursors_[b];
+        uint64_t head = buffer.head_.load(std::memory_order_acquire);
+        uint64_t start = cursor.next;
+        // Events were discarded by reset() or a reused buffer, or lost to the
+        // ring wrapping; zones opened before the gap can't be closed
+        uint64_t tail = buffer.tail_.load(std::memory_order_relaxed);
+        if (head > ThreadBuffer::kCapacity)
+            tail = std::max(tail, head - ThreadBuffer::kCapacity);
+        if (tail > start) {
+            start = tail;
+            cursor.open.clear();
+        }
+
+        uint64_t copied = copyEvents(buffer.events_.get(), start, head, buffer.head_, scratch_);
+        if (copied > start)
+            cursor.open.clear();
+
+        cursor.next = copied;
+        for (const auto& event : scratch_) {
+            // Left for the next frame: recorded on another thread after this mark
+            if (event.timestamp > frameEnd)
+                break;
+            ++cursor.next;
+
+            if (!event.name) {
+                if (cursor.open.empty())
+                    continue;
+                const auto& begin = cursor.open.back();
+                auto& totals = frameTicks_[begin.name];
+                ++totals.count;
+                totals.ticks += event.timestamp > begin.timestamp ? event.timestamp - begin.timestamp : 0;
+                cursor.open.pop_back();
+            } else if (event.name != kFrameMarkName) {
+                cursor.open.push_back(event);
+            }
+        }
+    }
+
+    double ticksPerMs = ticksPerNanosecond() * 1.0e6;
+    lastFrameZones_.clear();
+    for (const auto& [name, totals] : frameTicks_) {
+        lastFrameZones_.push_back({name.data(), totals.count, static_cast<double>(totals.ticks) / ticksPerMs});
+    }
+    std::sort(lastFrameZones_.begin(), lastFrameZones_.end(),
+              [](const ZoneTotal& a, const ZoneTotal& b) { return a.totalMs > b.totalMs; });
+}
+
+size_t Registry::exportChromeTrace(std::ostream& out) {
+    double ticksPerUs = ticksPerNanosecond() * 1000.0;
+
+    std::lock_guard lock(mutex_);
+    size_t written = 0;
+    bool first = true;
+    auto separator = [&]() {
+        if (!first)
+            out << ",\n";
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    std::vector<CopiedEvent> events;
+    events.reserve(ThreadBuffer::kCapacity);
+    for (auto& buffer : buffers_) {
+        uint64_t head = buffer->head_.load(std::memory_order_acquire);
+        uint64_t start = buffer->tail_.load(std::memory_order_relaxed);
+        if (head > ThreadBuffer::kCapacity)
+            start = std::max(start, head - ThreadBuffer::kCapacity);
+
+        // The owner may have lapped the ring while we copied; overwritten slots are dropped
+        copyEvents(buffer->events_.get(), start, head, buffer->head_, events);
+
+        uint32_t tid = buffer->id();
+        separator();
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":\"";
+        if (buffer->name_.empty())
+            out << "Thread " << tid;
+        else
+            writeEscaped(out, buffer->name_.c_str());
+        out << "\"}}";
+
+        int depth = 0;
+        char ts[32];
+        for (const auto& event : events) {
+            uint64_t ticks = event.timestamp > baseTicks ? event.timestamp - baseTicks : 0;
+            double us = static_cast<double>(ticks) / ticksPerUs;
+            std::snprintf(ts, sizeof(ts), "%.3f", us);
+
+            if (!event.name) {
+                // End whose begin fell out of the ring
+                if (depth == 0)
+                    continue;
+                --depth;
+                separator();
+                out << "{\"ph\":\"E\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << ts << "}";
+            } else if (event.name == kFrameMarkName) {
+                separator();
+                out << "{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << ts
+                    << "}";
+            } else {
+                ++depth;
+                separator();
+                out << "{\"ph\":\"B\",\"name\":\"";
+                writeEscaped(out, event.name);
+                out << "\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << ts << "}";
+            }
+            ++written;
+        }
+    }
+
+    // Zone totals of the last completed frame, alongside the events
+    out << "\n],\"frameZones\":[";
+    for (size_t i = 0; i < lastFrameZones_.size(); ++i) {
+        const auto& zone = lastFrameZones_[i];
+        char totalMs[32];
+        std::snprintf(totalMs, sizeof(totalMs), "%.6f", zone.totalMs);
+        out << (i ? ",\n" : "\n") << "{\"name\":\"";
+        writeEscaped(out, zone.name);
+        out << "\",\"count\":" << zone.count << ",\"totalMs\":" << totalMs << "}";
+    }
+    out << "\n]}\n";
+    return written;
+}
+
+namespace {
+
+// Hands the thread's buffer back to the registry when the thread exits
+struct ThreadBufferOwner {
+    ThreadBuffer* buffer = nullptr;
+    ~ThreadBufferOwner();
+};
+
+thread_local ThreadBufferOwner tlsOwner;
+thread_local bool tlsOwnerDestroyed = false;
+
+ThreadBufferOwner::~ThreadBufferOwner() {
+    tlsOwnerDestroyed = true;
+    if (buffer) {
+        detail::tlsBuffer = nullptr;
+        Registry::instance().release(buffer);
+    }
+}
+
+} // namespace
+
+ThreadBuffer* detail::registerThread() {
+    ThreadBuffer* buffer = Registry::instance().acquire();
+    // A zone in a thread_local destructor that runs after the owner's gets a
+    // buffer that is never recycled rather than one another thread may reuse
+    if (!tlsOwnerDestroyed)
+        tlsOwner.buffer = buffer;
+    return buffer;
+}
+
+void setEnabled(bool enabled) {
+    detail::gEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool isEnabled() {
+    return detail::gEnabled.load(std::memory_order_relaxed);
+}
+
+void setThreadName(const char* name) {
+    Registry::instance().setName(detail::currentBuffer(), name);
+}
+
+double ticksPerNanosecond() {
+    auto& registry = Registry::instance();
+
+    // Calibrate over at least a millisecond so the ratio is stable
+    auto now = std::chrono::steady_clock::now();
+    while (now - registry.baseTime < std::chrono::milliseconds(1)) {
+        std::this_thread::yield();
+        now = std::chrono::steady_clock::now();
+    }
+    uint64_t ticks = readTimestamp();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - registry.baseTime);
+    double ns = static_cast<double>(elapsed.count());
+    return static_cast<double>(ticks - registry.baseTicks) / ns;
+}
+
+void frameMark() {
+    if (!isEnabled())
+        return;
+
+    auto& registry = Registry::instance();
+    detail::currentBuffer().push(kFrameMarkName);
+
+    uint64_t now = readTimestamp();
+    registry.aggregateFrame(now);
+    if (registry.lastFrameTimestamp != 0)
+        registry.lastFrameTicks = now - registry.lastFrameTimestamp;
+    registry.lastFrameTimestamp = now;
+    ++registry.frameCount;
+
+    if (registry.hitchThresholdMs <= 0.0 || registry.lastFrameTicks == 0)
+        return;
+
+    double frameMs = lastFrameMs();
+    auto wall = std::chrono::steady_clock::now();
+    if (frameMs <= registry.hitchThresholdMs || wall - registry.lastHitchExport < std::chrono::seconds(1))
+        return;
+
+    registry.lastHitchExport = wall;
+    auto path = (std::filesystem::path(registry.hitchDirectory) /
+                 ("fabric_hitch_" + std::to_string(registry.frameCount) + ".json"))
+                    .string();
+    if (exportChromeTrace(path))
+        FABRIC_LOG_WARN("Frame {} took {:.2f} ms, trace written to {}", registry.frameCount, frameMs, path);
+}
+
+std::vector<ZoneTotal> lastFrameZones() {
+    return Registry::instance().lastFrameZones();
+}
+
+uint64_t frameCount() {
+    return Registry::instance().frameCount;
+}
+
+double lastFrameMs() {
+    auto& registry = Registry::instance();
+    if (registry.lastFrameTicks == 0)
+        return 0.0;
+    return static_cast<double>(registry.lastFrameTicks) / ticksPerNanosecond() / 1.0e6;
+}
+
+void setHitchThreshold(double thresholdMs, const std::string& directory) {
+    auto& registry = Registry::instance();
+    registry.hitchThresholdMs = thresholdMs;
+    registry.hitchDirectory = directory;
+}
+
+size_t exportChromeTrace(std::ostream& out) {
+    return Registry::instance().exportChromeTrace(out);
+}
+
+bool exportChromeTrace(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        FABRIC_LOG_ERROR("Cannot open trace file {}", path);
+        return false;
+    }
+    exportChromeTrace(out);
+    return static_cast<bool>(out);
+}
+
+void reset() {
+    Registry::instance().reset();
+}
+
+} // namespace fabric::profiler
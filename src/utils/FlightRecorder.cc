@@ -0,0 +1,370 @@
+#include "fabric/utils/FlightRecorder.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fabric {
+
+namespace {
+
+constexpr char kMagic[4] = {'F', 'F', 'L', 'T'};
+
+// Dump files are little-endian regardless of host byte order
+void putU32(std::ostream& out, uint32_t value) {
+    char bytes[4];
+    for (int i = 0; i < 4; ++i)
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    out.write(bytes, sizeof(bytes));
+}
+
+void putU64(std::ostream& out, uint64_t value) {
+    putU32(out, static_cast<uint32_t>(value));
+    putU32(out, static_cast<uint32_t>(value >> 32));
+}
+
+bool getU32(std::istream& in, uint32_t& value) {
+    unsigned char bytes[4];
+    if (!in.read(reinterpret_cast<char*>(bytes), sizeof(bytes)))
+        return false;
+    value = 0;
+    for (int i = 0; i < 4; ++i)
+        value |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+    return true;
+}
+
+bool getU64(std::istream& in, uint64_t& value) {
+    uint32_t lo, hi;
+    if (!getU32(in, lo) || !getU32(in, hi))
+        return false;
+    value = (static_cast<uint64_t>(hi) << 32) | lo;
+    return true;
+}
+
+void writeEscaped(std::ostream& out, const std::string& text) {
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+            out << buf;
+        } else {
+            out << c;
+        }
+    }
+}
+
+double toMs(uint64_t ns) {
+    return static_cast<double>(ns) / 1.0e6;
+}
+
+} // namespace
+
+FlightRecorder::FlightRecorder(FlightRecorderConfig config)
+    : config_(std::move(config)), origin_(std::chrono::steady_clock::now()) {
+    config_.frameCapacity = std::max<size_t>(config_.frameCapacity, 2);
+    config_.framesAfterHitch = std::min(config_.framesAfterHitch, config_.frameCapacity / 2);
+    ring_.resize(config_.frameCapacity);
+    channels_.reserve(kMaxChannels);
+}
+
+FlightRecorder::ChannelId FlightRecorder::addChannel(const std::string& name, FlightChannelKind kind) {
+    return addSampledChannel(name, kind, nullptr);
+}
+
+FlightRecorder::ChannelId FlightRecorder::addSampledChannel(const std::string& name, FlightChannelKind kind,
+                                                            Sampler sampler) {
+    if (channels_.size() >= kMaxChannels)
+        throwError("FlightRecorder: channel limit reached adding '" + name + "'");
+    if (name.size() > 255)
+        throwError("FlightRecorder: channel name too long: '" + name + "'");
+
+    Channel channel{name, kind, std::move(sampler), 0};
+    if (channel.sampler && kind == FlightChannelKind::Counter)
+        channel.lastSample = channel.sampler();
+    channels_.push_back(std::move(channel));
+    return static_cast<ChannelId>(channels_.size() - 1);
+}
+
+void FlightRecorder::beginFrame() {
+    frameStart_ = std::chrono::steady_clock::now();
+    inFrame_ = true;
+}
+
+bool FlightRecorder::endFrame() {
+    auto now = std::chrono::steady_clock::now();
+    if (!inFrame_)
+        frameStart_ = now;
+    inFrame_ = false;
+
+    auto& record = ring_[frameCount_ % ring_.size()];
+    record.frame = ++frameCount_;
+    record.startNs =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(frameStart_ - origin_).count());
+    record.durationNs =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - frameStart_).count());
+
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        auto& channel = channels_[i];
+        if (channel.sampler) {
+            uint64_t sample = channel.sampler();
+            if (channel.kind == FlightChannelKind::Counter) {
+                uint64_t delta = sample >= channel.lastSample ? sample - channel.lastSample : 0;
+                channel.lastSample = sample;
+                sample = delta;
+            }
+            current_[i].store(saturate(sample), std::memory_order_relaxed);
+        }
+        // Gauges hold their level across frames; zones and counters restart
+        record.values[i] = channel.kind == FlightChannelKind::Gauge
+                               ? current_[i].load(std::memory_order_relaxed)
+                               : current_[i].exchange(0, std::memory_order_relaxed);
+    }
+
+    bool hitch = config_.hitchThresholdMs > 0.0 && toMs(record.durationNs) > config_.hitchThresholdMs;
+    if (hitch) {
+        ++hitchCount_;
+        if (pendingHitch_ == 0 && (dumpCount_ == 0 || now - lastDump_ >= config_.cooldown)) {
+            pendingHitch_ = record.frame;
+            pendingHitchDone_ = record.frame + config_.framesAfterHitch;
+        }
+    }
+
+    if (pendingHitch_ != 0 && frameCount_ >= pendingHitchDone_)
+        writeHitchDump();
+
+    return hitch;
+}
+
+void FlightRecorder::writeHitchDump() {
+    uint64_t hitchFrame = pendingHitch_;
+    pendingHitch_ = 0;
+    lastDump_ = std::chrono::steady_clock::now();
+
+    const auto& record = ring_[(hitchFrame - 1) % ring_.size()];
+    auto path =
+        (std::filesystem::path(config_.directory) / ("fabric_hitch_" + std::to_string(hitchFrame) + ".fflight"))
+            .string();
+
+    if (!dump(path, hitchFrame)) {
+        FABRIC_LOG_ERROR("FlightRecorder: cannot write {}", path);
+        return;
+    }
+
+    ++dumpCount_;
+    lastDumpPath_ = path;
+    FABRIC_LOG_WARN("Hitch {} (threshold {:.1f} ms), flight record written to {}", summarize(record),
+                    config_.hitchThresholdMs, path);
+}
+
+std::vector<FlightFrame> FlightRecorder::snapshot() const {
+    size_t count = static_cast<size_t>(std::min<uint64_t>(frameCount_, ring_.size()));
+    std::vector<FlightFrame> frames;
+    frames.reserve(count);
+    for (uint64_t i = frameCount_ - count; i < frameCount_; ++i) {
+        frames.push_back(ring_[i % ring_.size()]);
+    }
+    return frames;
+}
+
+bool FlightRecorder::dump(const std::string& path, uint64_t hitchFrame) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    dump(out, hitchFrame);
+    return static_cast<bool>(out);
+}
+
+// Layout: magic, version, channel count, frame count, hitch frame,
+// threshold ns; then per channel (kind u8, name length u8, name bytes);
+// then per frame (frame, start ns, duration ns, one u32 per channel).
+void FlightRecorder::dump(std::ostream& out, uint64_t hitchFrame) const {
+    auto frames = snapshot();
+
+    out.write(kMagic, sizeof(kMagic));
+    putU32(out, kFileVersion);
+    putU32(out, static_cast<uint32_t>(channels_.size()));
+    putU32(out, static_cast<uint32_t>(frames.size()));
+    putU64(out, hitchFrame);
+    putU64(out, static_cast<uint64_t>(config_.hitchThresholdMs * 1.0e6));
+
+    for (const auto& channel : channels_) {
+        char head[2] = {static_cast<char>(channel.kind), static_cast<char>(channel.name.size())};
+        out.write(head, sizeof(head));
+        out.write(channel.name.data(), static_cast<std::streamsize>(channel.name.size()));
+    }
+
+    for (const auto& frame : frames) {
+        putU64(out, frame.frame);
+        putU64(out, frame.startNs);
+        putU64(out, frame.durationNs);
+        for (size_t i = 0; i < channels_.size(); ++i) {
+            putU32(out, frame.values[i]);
+        }
+    }
+}
+
+std::string FlightRecorder::summarize(const FlightFrame& frame) const {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "frame %llu: %.2f ms", static_cast<unsigned long long>(frame.frame),
+                  toMs(frame.durationNs));
+    std::string text = buf;
+
+    std::vector<size_t> zones;
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        if (channels_[i].kind == FlightChannelKind::Zone && frame.values[i] > 0)
+            zones.push_back(i);
+    }
+    std::sort(zones.begin(), zones.end(), [&](size_t a, size_t b) { return frame.values[a] > frame.values[b]; });
+    if (zones.size() > 3)
+        zones.resize(3);
+
+    if (!zones.empty()) {
+        text += " (";
+        for (size_t i = 0; i < zones.size(); ++i) {
+            std::snprintf(buf, sizeof(buf), "%s%s %.2f ms", i ? ", " : "", channels_[zones[i]].name.c_str(),
+                          toMs(frame.values[zones[i]]));
+            text += buf;
+        }
+        text += ")";
+    }
+
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        if (channels_[i].kind != FlightChannelKind::Zone && frame.values[i] > 0)
+            text += ", " + channels_[i].name + " " + std::to_string(frame.values[i]);
+    }
+    return text;
+}
+
+bool FlightRecorder::readDump(std::istream& in, FlightDump& out) {
+    char magic[sizeof(kMagic)];
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+        return false;
+
+    uint32_t version, channelCount, frameCount;
+    if (!getU32(in, version) || version != kFileVersion)
+        return false;
+    if (!getU32(in, channelCount) || channelCount > kMaxChannels || !getU32(in, frameCount))
+        return false;
+    if (!getU64(in, out.hitchFrame) || !getU64(in, out.thresholdNs))
+        return false;
+
+    out.channels.resize(channelCount);
+    for (auto& channel : out.channels) {
+        unsigned char head[2];
+        if (!in.read(reinterpret_cast<char*>(head), sizeof(head)) || head[0] > 2)
+            return false;
+        channel.kind = static_cast<FlightChannelKind>(head[0]);
+        channel.name.resize(head[1]);
+        if (!in.read(channel.name.data(), head[1]))
+            return false;
+    }
+
+    out.frames.clear();
+    for (uint32_t f = 0; f < frameCount; ++f) {
+        FlightFrame frame;
+        if (!getU64(in, frame.frame) || !getU64(in, frame.startNs) || !getU64(in, frame.durationNs))
+            return false;
+        for (uint32_t i = 0; i < channelCount; ++i) {
+            if (!getU32(in, frame.values[i]))
+                return false;
+        }
+        out.frames.push_back(frame);
+    }
+    return true;
+}
+
+size_t FlightRecorder::writeChromeTrace(const FlightDump& dump, std::ostream& out) {
+    size_t written = 0;
+    bool first = true;
+    char ts[32];
+    auto begin = [&](uint64_t ns) {
+        if (!first)
+            out << ",\n";
+        first = false;
+        ++written;
+        std::snprintf(ts, sizeof(ts), "%.3f", static_cast<double>(ns) / 1000.0);
+    };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Frames\"}}";
+    first = false;
+
+    for (const auto& frame : dump.frames) {
+        begin(frame.startNs);
+        char dur[32];
+        std::snprintf(dur, sizeof(dur), "%.3f", static_cast<double>(frame.durationNs) / 1000.0);
+        out << "{\"ph\":\"X\",\"name\":\"Frame " << frame.frame << "\",\"pid\":1,\"tid\":1,\"ts\":" << ts
+            << ",\"dur\":" << dur << ",\"args\":{";
+        for (size_t i = 0; i < dump.channels.size(); ++i) {
+            out << (i ? "," : "") << '"';
+            writeEscaped(out, dump.channels[i].name);
+            out << "\":" << frame.values[i];
+        }
+        out << "}}";
+
+        // Zones share one stacked track in milliseconds; others get their own
+        bool anyZone = false;
+        for (size_t i = 0; i < dump.channels.size(); ++i) {
+            const auto& channel = dump.channels[i];
+            if (channel.kind == FlightChannelKind::Zone) {
+                if (!anyZone) {
+                    begin(frame.startNs);
+                    out << "{\"ph\":\"C\",\"name\":\"zones_ms\",\"pid\":1,\"ts\":" << ts << ",\"args\":{";
+                } else {
+                    out << ",";
+                }
+                anyZone = true;
+                char value[32];
+                std::snprintf(value, sizeof(value), "%.3f", toMs(frame.values[i]));
+                out << '"';
+                writeEscaped(out, channel.name);
+                out << "\":" << value;
+            }
+        }
+        if (anyZone)
+            out << "}}";
+
+        for (size_t i = 0; i < dump.channels.size(); ++i) {
+            const auto& channel = dump.channels[i];
+            if (channel.kind == FlightChannelKind::Zone)
+                continue;
+            begin(frame.startNs);
+            out << "{\"ph\":\"C\",\"name\":\"";
+            writeEscaped(out, channel.name);
+            out << "\",\"pid\":1,\"ts\":" << ts << ",\"args\":{\"value\":" << frame.values[i] << "}}";
+        }
+
+        if (frame.frame == dump.hitchFrame) {
+            begin(frame.startNs);
+            out << "{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Hitch\",\"pid\":1,\"tid\":1,\"ts\":" << ts << "}";
+        }
+    }
+
+    out << "\n]}\n";
+    return written;
+}
+
+bool FlightRecorder::convertToChromeTrace(const std::string& dumpPath, const std::string& tracePath) {
+    std::ifstream in(dumpPath, std::ios::binary);
+    FlightDump dump;
+    if (!in || !readDump(in, dump)) {
+        FABRIC_LOG_ERROR("FlightRecorder: {} is not a valid flight record", dumpPath);
+        return false;
+    }
+
+    std::ofstream out(tracePath, std::ios::trunc);
+    if (!out) {
+        FABRIC_LOG_ERROR("FlightRecorder: cannot open {}", tracePath);
+        return false;
+    }
+    writeChromeTrace(dump, out);
+    return static_cast<bool>(out);
+}
+
+} // namespace fabric
@@ -0,0 +1,145 @@
+#include "fabric/utils/FrameArena.hh"
+#include "fabric/utils/MemoryHeaps.hh"
+
+#include <algorithm>
+#include <memory>
+
+namespace fabric {
+
+namespace {
+
+constexpr size_t kBlockAlignment = alignof(std::max_align_t);
+
+std::atomic<uint64_t> frameCounter{0};
+std::atomic<bool> arenasEnabled{false};
+
+struct ThreadArenas {
+    ThreadArenas()
+        : arenas{FrameArena(FrameArena::kDefaultCapacity, upstream()),
+                 FrameArena(FrameArena::kDefaultCapacity, upstream())} {}
+
+    static std::pmr::memory_resource* upstream() {
+        if (MemoryHeaps::configured()) {
+            auto& temp = MemoryHeaps::get(MemoryHeap::Temp);
+            if (temp.ownedByCurrentThread())
+                return &temp;
+        }
+        return std::pmr::get_default_resource();
+    }
+
+    std::array<FrameArena, 2> arenas;
+    uint64_t frame = 0; // Frame the arena at slot serves
+    size_t slot = 0;
+};
+
+// Kept apart from ThreadArenas so a job that never asks for frame memory
+// doesn't create the arenas (and with them the heaps) on its thread
+thread_local int tlsJobDepth = 0;
+thread_local bool tlsJobPinned = false; // The open job has called current()
+
+ThreadArenas& threadArenas() {
+    thread_local ThreadArenas local;
+    return local;
+}
+
+} // namespace
+
+FrameArena::FrameArena(size_t capacity, std::pmr::memory_resource* upstream)
+    : upstream_(upstream ? upstream : std::pmr::get_default_resource()), capacity_(capacity) {}
+
+FrameArena::~FrameArena() {
+    reset();
+    releaseBlock();
+}
+
+void FrameArena::reset() {
+    for (const auto& block : overflow_)
+        upstream_->deallocate(block.p, block.bytes, block.alignment);
+    overflow_.clear();
+
+    // Overflowed this time: grow so the same load fits in the block next time
+    if (overflowBytes_ > 0) {
+        releaseBlock();
+        capacity_ = std::max(capacity_ * 2, highWater_);
+    }
+    offset_ = 0;
+    overflowBytes_ = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    if (!block_)
+        block_ = static_cast<std::byte*>(upstream_->allocate(capacity_, kBlockAlignment));
+
+    size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+    if (alignment <= kBlockAlignment && aligned + bytes <= capacity_) {
+        offset_ = aligned + bytes;
+        highWater_ = std::max(highWater_, used());
+        return block_ + aligned;
+    }
+
+    void* p = upstream_->allocate(bytes, alignment);
+    overflow_.push_back({p, bytes, alignment});
+    overflowBytes_ += bytes;
+    highWater_ = std::max(highWater_, used());
+    return p;
+}
+
+void FrameArena::releaseBlock() {
+    if (block_) {
+        upstream_->deallocate(block_, capacity_, kBlockAlignment);
+        block_ = nullptr;
+    }
+}
+
+void FrameArenas::advance() {
+    frameCounter.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t FrameArenas::frame() {
+    return frameCounter.load(std::memory_order_acquire);
+}
+
+void FrameArenas::setEnabled(bool enabled) {
+    arenasEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool FrameArenas::isEnabled() {
+    return arenasEnabled.load(std::memory_order_relaxed);
+}
+
+std::pmr::memory_resource* FrameArenas::resource() {
+    return isEnabled() ? static_cast<std::pmr::memory_resource*>(&current()) : std::pmr::get_default_resource();
+}
+
+FrameArena& FrameArenas::current() {
+    auto& local = threadArenas();
+    if (tlsJobPinned)
+        return local.arenas[local.slot];
+
+    uint64_t frame = frameCounter.load(std::memory_order_acquire);
+    if (frame != local.frame) {
+        // The other arena served frame - 2 or earlier; this slot's is still
+        // live only if it served frame - 1
+        size_t next = local.slot ^ 1;
+        local.arenas[next].reset();
+        if (frame - local.frame > 1)
+            local.arenas[local.slot].reset();
+        local.slot = next;
+        local.frame = frame;
+    }
+    tlsJobPinned = tlsJobDepth > 0;
+    return local.arenas[local.slot];
+}
+
+FrameArenas::JobScope::JobScope() {
+    ++tlsJobDepth;
+}
+
+FrameArenas::JobScope::~JobScope() {
+    if (--tlsJobDepth > 0 || !tlsJobPinned)
+        return;
+    tlsJobPinned = false;
+    threadArenas().frame = frameCounter.load(std::memory_order_acquire);
+}
+
+} // namespace fabric
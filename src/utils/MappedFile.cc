@@ -0,0 +1,110 @@
+#include "fabric/utils/MappedFile.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <filesystem>
+#include <fstream>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FABRIC_MAPPED_FILE_POSIX 1
+#endif
+
+namespace fabric {
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+      mapped_(std::exchange(other.mapped_, false)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, false);
+    }
+    return *this;
+}
+
+void MappedFile::close() {
+    if (!data_)
+        return;
+    if (mapped_) {
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+#elif defined(FABRIC_MAPPED_FILE_POSIX)
+        munmap(data_, size_);
+#endif
+    } else {
+        delete[] data_;
+    }
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+}
+
+MappedFile MappedFile::open(const std::string& path) {
+    MappedFile file;
+
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (ec)
+        throwError("MappedFile: cannot stat " + path + ": " + ec.message());
+    if (size == 0)
+        throwError("MappedFile: " + path + " is empty");
+
+#if defined(_WIN32)
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        throwError("MappedFile: cannot open " + path);
+    HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(handle);
+    if (!mapping)
+        throwError("MappedFile: cannot map " + path);
+    void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+        throwError("MappedFile: cannot map " + path);
+    file.data_ = static_cast<uint8_t*>(view);
+    file.size_ = static_cast<size_t>(size);
+    file.mapped_ = true;
+#elif defined(FABRIC_MAPPED_FILE_POSIX)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throwError("MappedFile: cannot open " + path);
+    void* view = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+        throwError("MappedFile: cannot map " + path);
+    // Restores read the file front to back once
+    madvise(view, static_cast<size_t>(size), MADV_SEQUENTIAL);
+    file.data_ = static_cast<uint8_t*>(view);
+    file.size_ = static_cast<size_t>(size);
+    file.mapped_ = true;
+#else
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throwError("MappedFile: cannot open " + path);
+    file.data_ = new uint8_t[size];
+    file.size_ = static_cast<size_t>(size);
+    if (!in.read(reinterpret_cast<char*>(file.data_), static_cast<std::streamsize>(size)))
+        throwError("MappedFile: cannot read " + path);
+#endif
+
+    return file;
+}
+
+} // namespace fabric
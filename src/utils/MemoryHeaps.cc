@@ -0,0 +1,184 @@
+#include "fabric/utils/MemoryHeaps.hh"
+#include "fabric/core/Log.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/Metrics.hh"
+
+#include <mutex>
+#include <string>
+
+namespace fabric {
+
+namespace {
+
+constexpr std::array<const char*, kMemoryHeapCount> kHeapNames = {"chunk_storage", "mesh", "resources", "temp"};
+
+// Counts bytes obtained from operator new so the pool's footprint is visible
+class CountingUpstream : public std::pmr::memory_resource {
+  public:
+    uint64_t bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::atomic<uint64_t> bytes_{0};
+};
+
+// Default backend: a synchronized pool per heap. release() hands every pooled
+// chunk and oversized block back to operator new at once.
+class PoolHeapResource : public HeapResource {
+  public:
+    PoolHeapResource() : pool_(&upstream_) {}
+
+    const char* backendName() const override { return "pool"; }
+
+  protected:
+    void* allocateBlock(size_t bytes, size_t alignment) override { return pool_.allocate(bytes, alignment); }
+    void freeBlock(void* p, size_t bytes, size_t alignment) override { pool_.deallocate(p, bytes, alignment); }
+    void releaseAll() override { pool_.release(); }
+    uint64_t measureCommitted() const override { return upstream_.bytes(); }
+
+  private:
+    CountingUpstream upstream_;
+    std::pmr::synchronized_pool_resource pool_;
+};
+
+std::unique_ptr<HeapResource> createPoolHeap(MemoryHeap heap, const MemoryHeapConfig& config) {
+    if (heap == MemoryHeap::ChunkStorage && config.chunkLargePages)
+        FABRIC_LOG_WARN("Large pages for chunk storage need the mimalloc heap backend; using regular pages");
+    return std::make_unique<PoolHeapResource>();
+}
+
+struct HeapRegistry {
+    std::mutex mutex;
+    MemoryHeapConfig config;
+    MemoryHeaps::Factory factory = &createPoolHeap;
+    std::array<std::unique_ptr<HeapResource>, kMemoryHeapCount> heaps;
+    std::atomic<bool> created{false};
+};
+
+// Never destroyed: containers in other static objects may free into a heap
+// during exit
+HeapRegistry& heapRegistry() {
+    static auto* registry = new HeapRegistry();
+    return *registry;
+}
+
+void createHeapsLocked(HeapRegistry& registry) {
+    for (size_t i = 0; i < kMemoryHeapCount; ++i)
+        registry.heaps[i] = registry.factory(static_cast<MemoryHeap>(i), registry.config);
+    registry.created.store(true, std::memory_order_release);
+}
+
+} // namespace
+
+HeapResource::HeapResource() : owner_(std::this_thread::get_id()) {}
+
+MemoryHeapStats HeapResource::stats() const {
+    MemoryHeapStats s;
+    s.usedBytes = used_.load(std::memory_order_relaxed);
+    s.peakUsedBytes = peak_.load(std::memory_order_relaxed);
+    s.committedBytes = ownedByCurrentThread() ? measureCommitted() : committed_.load(std::memory_order_relaxed);
+    s.allocations = allocations_.load(std::memory_order_relaxed);
+    return s;
+}
+
+void HeapResource::release() {
+    if (!ownedByCurrentThread())
+        throwError(std::string("HeapResource::release called off the owning thread (") + backendName() + ")");
+    releaseAll();
+    used_.store(0, std::memory_order_relaxed);
+    peak_.store(0, std::memory_order_relaxed);
+    sampleCommitted();
+}
+
+void HeapResource::sampleCommitted() {
+    if (ownedByCurrentThread())
+        committed_.store(measureCommitted(), std::memory_order_relaxed);
+}
+
+void* HeapResource::do_allocate(size_t bytes, size_t alignment) {
+    if (!ownedByCurrentThread())
+        throwError(std::string("HeapResource allocation off the owning thread (") + backendName() + ")");
+    void* p = allocateBlock(bytes, alignment);
+    if (!p)
+        throw std::bad_alloc();
+
+    allocations_.fetch_add(1, std::memory_order_relaxed);
+    uint64_t used = used_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    uint64_t peak = peak_.load(std::memory_order_relaxed);
+    while (used > peak && !peak_.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+    }
+    return p;
+}
+
+void HeapResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    freeBlock(p, bytes, alignment);
+    used_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void MemoryHeaps::configure(const MemoryHeapConfig& config) {
+    auto& registry = heapRegistry();
+    std::lock_guard lock(registry.mutex);
+    if (registry.created.load(std::memory_order_relaxed))
+        throwError("MemoryHeaps::configure called after the heaps were created");
+    registry.config = config;
+    createHeapsLocked(registry);
+}
+
+bool MemoryHeaps::configured() {
+    return heapRegistry().created.load(std::memory_order_acquire);
+}
+
+HeapResource& MemoryHeaps::get(MemoryHeap heap) {
+    auto& registry = heapRegistry();
+    // Creating them here would hand ownership to whichever thread got here
+    // first, often a worker, and the main thread's allocations would throw
+    if (!registry.created.load(std::memory_order_acquire))
+        throwError(std::string("MemoryHeaps: ") + name(heap) +
+                   " heap used before MemoryHeaps::configure() was called on the main thread");
+    return *registry.heaps[static_cast<size_t>(heap)];
+}
+
+void MemoryHeaps::sampleCommitted() {
+    for (size_t i = 0; i < kMemoryHeapCount; ++i)
+        get(static_cast<MemoryHeap>(i)).sampleCommitted();
+}
+
+const char* MemoryHeaps::name(MemoryHeap heap) {
+    return kHeapNames[static_cast<size_t>(heap)];
+}
+
+void MemoryHeaps::registerMetrics(MetricsRegistry& registry) {
+    for (size_t i = 0; i < kMemoryHeapCount; ++i) {
+        auto heap = static_cast<MemoryHeap>(i);
+        std::string prefix = std::string("fabric_heap_") + name(heap);
+        registry.gaugeCallback(prefix + "_used_bytes", std::string("Live bytes in the ") + name(heap) + " heap",
+                               [heap] { return static_cast<double>(stats(heap).usedBytes); });
+        registry.gaugeCallback(prefix + "_peak_bytes", std::string("Peak live bytes in the ") + name(heap) + " heap",
+                               [heap] { return static_cast<double>(stats(heap).peakUsedBytes); });
+        registry.gaugeCallback(prefix + "_committed_bytes",
+                               std::string("Memory held by the ") + name(heap) + " heap backend",
+                               [heap] { return static_cast<double>(stats(heap).committedBytes); });
+    }
+}
+
+void MemoryHeaps::installBackend(Factory factory) {
+    auto& registry = heapRegistry();
+    std::lock_guard lock(registry.mutex);
+    if (registry.created.load(std::memory_order_relaxed))
+        throwError("MemoryHeaps::installBackend called after the heaps were created");
+    registry.factory = factory;
+}
+
+} // namespace fabric
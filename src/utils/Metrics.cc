@@ -0,0 +1,239 @@
+#include "fabric/utils/Metrics.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+namespace fabric {
+
+namespace {
+
+std::atomic<size_t> nextShard{0};
+
+void writeNumber(std::ostream& out, double value) {
+    if (std::isnan(value)) {
+        out << "NaN";
+    } else if (std::isinf(value)) {
+        out << (value > 0 ? "+Inf" : "-Inf");
+    } else {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.10g", value);
+        out << buf;
+    }
+}
+
+void writeHelp(std::ostream& out, const std::string& name, const std::string& help) {
+    if (help.empty())
+        return;
+    out << "# HELP " << name << ' ';
+    for (char c : help) {
+        if (c == '\\')
+            out << "\\\\";
+        else if (c == '\n')
+            out << "\\n";
+        else
+            out << c;
+    }
+    out << '\n';
+}
+
+} // namespace
+
+// -- Counter --
+
+size_t Counter::shardIndex() noexcept {
+    thread_local size_t index = nextShard.fetch_add(1, std::memory_order_relaxed) % kShards;
+    return index;
+}
+
+uint64_t Counter::value() const noexcept {
+    uint64_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+// -- Gauge --
+
+void Gauge::add(double delta) noexcept {
+    double current = value_.load(std::memory_order_relaxed);
+    while (!value_.compare_exchange_weak(current, current + delta, std::memory_order_relaxed)) {
+    }
+}
+
+// -- Histogram --
+
+size_t Histogram::bucketIndex(uint64_t value) noexcept {
+    if (value < kSubBuckets)
+        return static_cast<size_t>(value);
+    unsigned exponent = 63 - static_cast<unsigned>(std::countl_zero(value));
+    size_t sub = static_cast<size_t>(value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+    return (exponent - kSubBucketBits + 1) * kSubBuckets + sub;
+}
+
+uint64_t Histogram::bucketLowerBound(size_t index) noexcept {
+    if (index < kSubBuckets)
+        return index;
+    unsigned exponent = static_cast<unsigned>(index / kSubBuckets) + kSubBucketBits - 1;
+    uint64_t sub = index % kSubBuckets;
+    return (kSubBuckets + sub) << (exponent - kSubBucketBits);
+}
+
+uint64_t Histogram::bucketUpperBound(size_t index) noexcept {
+    if (index < kSubBuckets)
+        return index;
+    unsigned exponent = static_cast<unsigned>(index / kSubBuckets) + kSubBucketBits - 1;
+    return bucketLowerBound(index) + ((uint64_t{1} << (exponent - kSubBucketBits)) - 1);
+}
+
+void Histogram::record(uint64_t value) noexcept {
+    buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t seen = max_.load(std::memory_order_relaxed);
+    while (value > seen && !max_.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t Histogram::percentile(double q) const noexcept {
+    uint64_t total = count();
+    if (total == 0)
+        return 0;
+
+    q = std::clamp(q, 0.0, 1.0);
+    auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            uint64_t lower = bucketLowerBound(i);
+            uint64_t mid = lower + (bucketUpperBound(i) - lower) / 2;
+            return std::min(mid, max());
+        }
+    }
+    return max();
+}
+
+// -- MetricsRegistry --
+
+bool MetricsRegistry::isValidName(const std::string& name) {
+    if (name.empty())
+        return false;
+    auto head = [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'; };
+    if (!head(name[0]))
+        return false;
+    return std::all_of(name.begin() + 1, name.end(), [&](char c) { return head(c) || (c >= '0' && c <= '9'); });
+}
+
+MetricsRegistry::Entry& MetricsRegistry::findOrCreate(const std::string& name, const std::string& help, Kind kind) {
+    auto it = entries_.find(name);
+    if (it != entries_.end()) {
+        if (it->second.kind != kind)
+            throwError("Metric '" + name + "' already registered with a different type");
+        return it->second;
+    }
+
+    if (!isValidName(name))
+        throwError("Invalid metric name '" + name + "'");
+
+    Entry entry;
+    entry.kind = kind;
+    entry.help = help;
+    return entries_.emplace(name, std::move(entry)).first->second;
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help) {
+    std::lock_guard lock(mutex_);
+    auto& entry = findOrCreate(name, help, Kind::Counter);
+    if (!entry.counter)
+        entry.counter = std::make_unique<Counter>();
+    return *entry.counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help) {
+    std::lock_guard lock(mutex_);
+    auto& entry = findOrCreate(name, help, Kind::Gauge);
+    if (!entry.gauge)
+        entry.gauge = std::make_unique<Gauge>();
+    return *entry.gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, double unitScale) {
+    std::lock_guard lock(mutex_);
+    auto& entry = findOrCreate(name, help, Kind::Histogram);
+    if (!entry.histogram)
+        entry.histogram = std::make_unique<Histogram>(unitScale);
+    return *entry.histogram;
+}
+
+void MetricsRegistry::gaugeCallback(const std::string& name, const std::string& help, std::function<double()> read) {
+    std::lock_guard lock(mutex_);
+    auto& entry = findOrCreate(name, help, Kind::Callback);
+    entry.read = std::move(read);
+}
+
+bool MetricsRegistry::contains(const std::string& name) const {
+    std::lock_guard lock(mutex_);
+    return entries_.count(name) > 0;
+}
+
+void MetricsRegistry::remove(const std::string& name) {
+    std::lock_guard lock(mutex_);
+    entries_.erase(name);
+}
+
+size_t MetricsRegistry::size() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+void MetricsRegistry::renderPrometheus(std::ostream& out) const {
+    static constexpr double kQuantiles[] = {0.5, 0.9, 0.99, 0.999};
+
+    std::lock_guard lock(mutex_);
+    for (const auto& [name, entry] : entries_) {
+        writeHelp(out, name, entry.help);
+        switch (entry.kind) {
+            case Kind::Counter:
+                out << "# TYPE " << name << " counter\n" << name << ' ' << entry.counter->value() << '\n';
+                break;
+            case Kind::Gauge:
+                out << "# TYPE " << name << " gauge\n" << name << ' ';
+                writeNumber(out, entry.gauge->value());
+                out << '\n';
+                break;
+            case Kind::Callback:
+                out << "# TYPE " << name << " gauge\n" << name << ' ';
+                writeNumber(out, entry.read ? entry.read() : 0.0);
+                out << '\n';
+                break;
+            case Kind::Histogram: {
+                const auto& h = *entry.histogram;
+                out << "# TYPE " << name << " summary\n";
+                for (double q : kQuantiles) {
+                    out << name << "{quantile=\"" << q << "\"} ";
+                    writeNumber(out, static_cast<double>(h.percentile(q)) * h.unitScale());
+                    out << '\n';
+                }
+                out << name << "_sum ";
+                writeNumber(out, static_cast<double>(h.sum()) * h.unitScale());
+                out << '\n' << name << "_count " << h.count() << '\n';
+                break;
+            }
+        }
+    }
+}
+
+std::string MetricsRegistry::renderPrometheus() const {
+    std::ostringstream out;
+    renderPrometheus(out);
+    return out.str();
+}
+
+} // namespace fabric
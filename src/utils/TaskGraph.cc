@@ -0,0 +1,154 @@
+#include "fabric/utils/TaskGraph.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+
+namespace fabric {
+
+std::vector<size_t> runTaskGraph(TaskGraph& graph, Utils::ThreadPoolExecutor* workers) {
+    const size_t count = graph.dependencyCounts.size();
+    std::vector<size_t> pending = graph.dependencyCounts;
+    std::vector<bool> blocked = graph.blocked;
+    blocked.resize(count, false);
+    // Bytes rather than vector<bool>, whose packed bits workers can't write concurrently
+    std::vector<uint8_t> success(count, 0);
+
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+    std::vector<size_t> done;
+
+    std::deque<size_t> ready;
+    std::deque<size_t> callingReady;
+    for (size_t i = 0; i < count; ++i) {
+        if (pending[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    std::vector<size_t> completionOrder;
+    completionOrder.reserve(count);
+    std::vector<std::future<void>> tasks;
+    size_t running = 0;
+
+    auto complete = [&](size_t i) {
+        completionOrder.push_back(i);
+        for (size_t dependent : graph.dependents[i]) {
+            if (!success[i]) {
+                blocked[dependent] = true;
+            }
+            if (--pending[dependent] == 0) {
+                ready.push_back(dependent);
+            }
+        }
+    };
+
+    while (completionOrder.size() < count) {
+        // Hand out everything ready before running the next calling-thread
+        // task, so workers overlap with it as much as possible
+        while (!ready.empty()) {
+            size_t i = ready.front();
+            ready.pop_front();
+
+            if (blocked[i]) {
+                if (graph.skip) {
+                    graph.skip(i);
+                }
+                complete(i);
+            } else if (!workers || (graph.onCallingThread && graph.onCallingThread(i))) {
+                callingReady.push_back(i);
+            } else {
+                ++running;
+                // Each task writes only its own success slot; completion hands it back under doneMutex
+                tasks.push_back(workers->submit([&, i] {
+                    success[i] = graph.run(i);
+                    {
+                        std::lock_guard<std::mutex> lock(doneMutex);
+                        done.push_back(i);
+                    }
+                    doneCv.notify_one();
+                }));
+            }
+        }
+
+        std::vector<size_t> finished;
+        if (!callingReady.empty()) {
+            size_t i = callingReady.front();
+            callingReady.pop_front();
+            success[i] = graph.run(i);
+            complete(i);
+
+            std::lock_guard<std::mutex> lock(doneMutex);
+            finished.swap(done);
+        } else if (running > 0) {
+            std::unique_lock<std::mutex> lock(doneMutex);
+            doneCv.wait(lock, [&] { return !done.empty(); });
+            finished.swap(done);
+        }
+
+        for (size_t i : finished) {
+            --running;
+            complete(i);
+        }
+    }
+
+    for (auto& task : tasks) {
+        task.get();
+    }
+    return completionOrder;
+}
+
+void parallelFor(size_t count, Utils::ThreadPoolExecutor* workers, const std::function<void(size_t)>& body) {
+    if (!workers || count < 2) {
+        for (size_t i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    auto drain = [&next, count, &body]() {
+        try {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                body(i);
+            }
+        } catch (...) {
+            next.store(count);
+            throw;
+        }
+    };
+
+    size_t helpers = std::min(workers->getThreadCount(), count - 1);
+    std::vector<std::future<void>> pending;
+    pending.reserve(helpers);
+    for (size_t i = 0; i < helpers; ++i) {
+        pending.push_back(workers->submit(drain));
+    }
+
+    // Helpers reference the caller's state, so wait for all before rethrowing
+    std::exception_ptr error;
+    try {
+        drain();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& future : pending) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace fabric
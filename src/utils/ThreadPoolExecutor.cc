@@ -1,5 +1,6 @@
 #include "fabric/utils/ThreadPoolExecutor.hh"
 #include "fabric/core/Log.hh"
+#include "fabric/utils/FrameArena.hh"
 #include <algorithm>
 #include <iostream>
 
@@ -237,8 +238,10 @@ void ThreadPoolExecutor::workerThread() {
             }
         }
 
-        // Execute the task
+        // Execute the task. Frame arenas only rewind between tasks, so a task
+        // spanning frames keeps its frame memory.
         if (hasTask) {
+            FrameArenas::JobScope job;
             try {
                 task();
             } catch (const std::exception& e) {
@@ -0,0 +1,28 @@
+#!/bin/sh
+# Build and run the fabric_bench Google Benchmark suite.
+# Env: BENCH_FILTER - --benchmark_filter regex (default: all)
+# Env: BENCH_OUT    - JSON results path (default: build/bench/results.json)
+# Compare two result files with benchmark's tools/compare.py.
+set -eu
+
+preset="bench"
+build_dir="build/${preset}"
+out="${BENCH_OUT:-${build_dir}/results.json}"
+
+if [ ! -f "${build_dir}/build.ninja" ]; then
+  echo "Configuring (${preset})"
+  cmake --preset "${preset}"
+fi
+
+echo "Building fabric_bench"
+cmake --build "${build_dir}" --target fabric_bench -j
+
+filter_flag=""
+if [ -n "${BENCH_FILTER:-}" ]; then
+  filter_flag="--benchmark_filter=${BENCH_FILTER}"
+fi
+
+"${build_dir}/bin/fabric_bench" $filter_flag \
+  --benchmark_out="${out}" --benchmark_out_format=json
+
+echo "Results written to ${out}"
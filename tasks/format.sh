@@ -12,10 +12,10 @@ fi
 
 if [ "$fix_mode" = "1" ] || [ "$fix_mode" = "true" ]; then
   echo "Formatting source files"
-  find src include -name '*.cc' -o -name '*.hh' | xargs clang-format -i
+  find src include bench -name '*.cc' -o -name '*.hh' | xargs clang-format -i
   echo "Done"
 else
   echo "Checking format (dry-run)"
-  find src include -name '*.cc' -o -name '*.hh' | xargs clang-format --dry-run --Werror
+  find src include bench -name '*.cc' -o -name '*.hh' | xargs clang-format --dry-run --Werror
   echo "All files formatted correctly"
 fi
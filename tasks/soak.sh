@@ -0,0 +1,26 @@
+#!/bin/sh
+# Build and run the headless FabricSoak replay (Release, Noop renderer).
+# Env: SOAK_REPLAY - .finput recording to replay (default: built-in scripted flight)
+# Env: SOAK_OUT    - JSON report path (default: build/bench/soak.json)
+# Record a session with: Fabric --record-input session.finput
+set -eu
+
+preset="bench"
+build_dir="build/${preset}"
+out="${SOAK_OUT:-${build_dir}/soak.json}"
+
+if [ ! -f "${build_dir}/build.ninja" ]; then
+  echo "Configuring (${preset})"
+  cmake --preset "${preset}"
+fi
+
+echo "Building FabricSoak"
+cmake --build "${build_dir}" --target FabricSoak -j
+
+if [ -n "${SOAK_REPLAY:-}" ]; then
+  "${build_dir}/bin/FabricSoak" --replay "${SOAK_REPLAY}" --report "${out}"
+else
+  "${build_dir}/bin/FabricSoak" --report "${out}"
+fi
+
+echo "Report written to ${out}"
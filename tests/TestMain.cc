@@ -1,8 +1,11 @@
 #include "fabric/core/Log.hh"
+#include "fabric/utils/MemoryHeaps.hh"
 #include <gtest/gtest.h>
 
 int main(int argc, char** argv) {
   fabric::log::init();
+  // Heaps belong to the thread that creates them; tests run on this one
+  fabric::MemoryHeaps::configure({});
   ::testing::InitGoogleTest(&argc, argv);
   int result = RUN_ALL_TESTS();
   fabric::log::shutdown();
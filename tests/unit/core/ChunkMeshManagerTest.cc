@@ -119,3 +119,34 @@ TEST_F(ChunkMeshManagerTest, DeduplicatesDirtyMarking) {
     mgr.markDirty(0, 0, 0);
     EXPECT_EQ(mgr.dirtyCount(), 1u);
 }
+
+TEST_F(ChunkMeshManagerTest, RemoveChunkDropsMeshAndDirtyFlag) {
+    ChunkMeshManager mgr(dispatcher, density, essence);
+    mgr.markDirty(0, 0, 0);
+    mgr.update();
+    mgr.markDirty(0, 0, 0);
+    mgr.markDirty(1, 0, 0);
+
+    mgr.removeChunk(0, 0, 0);
+    EXPECT_EQ(mgr.meshFor({0, 0, 0}), nullptr);
+    EXPECT_FALSE(mgr.isDirty({0, 0, 0}));
+    EXPECT_TRUE(mgr.isDirty({1, 0, 0}));
+    EXPECT_EQ(mgr.meshCount(), 0u);
+}
+
+TEST_F(ChunkMeshManagerTest, RegisterMetricsPublishesCounts) {
+    MetricsRegistry registry;
+    {
+        ChunkMeshManager mgr(dispatcher, density, essence);
+        mgr.registerMetrics(registry);
+        mgr.markDirty(0, 0, 0);
+        mgr.markDirty(1, 0, 0);
+
+        auto text = registry.renderPrometheus();
+        EXPECT_NE(text.find("fabric_chunk_mesh_dirty 2\n"), std::string::npos);
+
+        mgr.update();
+        EXPECT_EQ(registry.histogram("fabric_chunk_remesh_seconds").count(), 2u);
+    }
+    EXPECT_EQ(registry.size(), 0u);
+}
@@ -1,4 +1,5 @@
 #include "fabric/core/ChunkStreaming.hh"
+#include "fabric/utils/AllocationTracker.hh"
 #include <gtest/gtest.h>
 #include <set>
 
@@ -103,3 +104,41 @@ TEST_F(ChunkStreamingTest, NegativeCoordinates) {
         EXPECT_NE(c.cx, 0);
     }
 }
+
+TEST_F(ChunkStreamingTest, RegisterMetricsPublishesTrackedCount) {
+    MetricsRegistry registry;
+    {
+        ChunkStreamingManager mgr(smallConfig());
+        mgr.registerMetrics(registry);
+        mgr.update(0.0f, 0.0f, 0.0f, 0.0f);
+
+        auto text = registry.renderPrometheus();
+        EXPECT_NE(text.find("fabric_chunk_streaming_tracked 125\n"), std::string::npos);
+        EXPECT_NE(text.find("fabric_chunk_streaming_radius 2\n"), std::string::npos);
+        EXPECT_EQ(registry.histogram("fabric_chunk_streaming_update_seconds").count(), 1u);
+    }
+    EXPECT_EQ(registry.size(), 0u);
+}
+
+TEST_F(ChunkStreamingTest, StationaryUpdateDoesNotAllocate) {
+    ChunkStreamingManager mgr(smallConfig());
+    mgr.update(40.0f, 0.0f, 40.0f, 0.0f);
+    mgr.update(40.0f, 0.0f, 40.0f, 0.0f);
+
+    StreamingUpdate result;
+    EXPECT_NO_ALLOCATIONS({ result = mgr.update(40.0f, 0.0f, 40.0f, 0.0f); });
+    EXPECT_TRUE(result.toLoad.empty());
+    EXPECT_TRUE(result.toUnload.empty());
+}
+
+TEST_F(ChunkStreamingTest, LoadOrderIsDeterministic) {
+    StreamingConfig cfg = smallConfig();
+    cfg.maxLoadsPerTick = 7;
+    ChunkStreamingManager a(cfg);
+    ChunkStreamingManager b(cfg);
+    auto ra = a.update(0.0f, 0.0f, 0.0f, 0.0f);
+    auto rb = b.update(0.0f, 0.0f, 0.0f, 0.0f);
+    ASSERT_EQ(ra.toLoad.size(), 7u);
+    EXPECT_EQ(ra.toLoad, rb.toLoad);
+    EXPECT_EQ(ra.toLoad[0], (ChunkCoord{0, 0, 0}));
+}
@@ -188,3 +188,19 @@ TEST_F(ChunkedGridTest, ForEachChunkDeterministic) {
 
     EXPECT_EQ(active, fromForEach);
 }
+
+TEST_F(ChunkedGridTest, ChunkDataMatchesCellLayout) {
+    EXPECT_EQ(grid.chunkData(0, 0, 0), nullptr);
+
+    float* cells = grid.ensureChunk(1, 0, -1);
+    ASSERT_NE(cells, nullptr);
+    EXPECT_FLOAT_EQ(cells[0], 0.0f);
+    cells[1 + 2 * kChunkSize + 3 * kChunkSize * kChunkSize] = 7.0f;
+
+    EXPECT_FLOAT_EQ(grid.get(kChunkSize + 1, 2, -kChunkSize + 3), 7.0f);
+    EXPECT_EQ(grid.chunkData(1, 0, -1), cells);
+    EXPECT_EQ(grid.ensureChunk(1, 0, -1), cells);
+
+    grid.clear();
+    EXPECT_EQ(grid.chunkCount(), 0u);
+}
@@ -0,0 +1,133 @@
+#include "fabric/core/ComponentScheduler.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace fabric;
+
+namespace {
+
+std::atomic<uint64_t> updateSequence{0};
+
+class OrderedComponent : public Component {
+  public:
+    explicit OrderedComponent(const std::string& id, OrderedComponent* parent = nullptr)
+        : Component(id), parent(parent) {}
+
+    void initialize() override {}
+    std::string render() override { return getId(); }
+    void update(float) override {
+        ++updates;
+        lastSequence = updateSequence.fetch_add(1) + 1;
+        if (parent && parent->lastSequence.load() == 0)
+            parentAfterChild = true;
+        if (throwOnUpdate)
+            throwError("update failed in " + getId());
+    }
+    void cleanup() override {}
+
+    OrderedComponent* parent;
+    int updates = 0;
+    std::atomic<uint64_t> lastSequence{0};
+    bool parentAfterChild = false;
+    bool throwOnUpdate = false;
+};
+
+// Builds a tree of the given fanout and depth, returning every node
+std::shared_ptr<OrderedComponent> buildTree(int fanout, int depth, std::vector<OrderedComponent*>& all,
+                                            OrderedComponent* parent = nullptr, const std::string& id = "n") {
+    auto node = std::make_shared<OrderedComponent>(id, parent);
+    all.push_back(node.get());
+    if (depth > 0) {
+        for (int i = 0; i < fanout; ++i)
+            node->addChild(buildTree(fanout, depth - 1, all, node.get(), id + "." + std::to_string(i)));
+    }
+    return node;
+}
+
+} // namespace
+
+TEST(ComponentSchedulerTest, SerialUpdateVisitsEveryNodeOnce) {
+    std::vector<OrderedComponent*> all;
+    auto root = buildTree(3, 3, all);
+
+    ComponentScheduler scheduler(root);
+    scheduler.update(0.016f);
+
+    EXPECT_EQ(scheduler.nodeCount(), all.size());
+    for (auto* node : all) {
+        EXPECT_EQ(node->updates, 1) << node->getId();
+        EXPECT_FALSE(node->parentAfterChild) << node->getId();
+    }
+}
+
+TEST(ComponentSchedulerTest, ParallelUpdateKeepsParentsFirst) {
+    std::vector<OrderedComponent*> all;
+    auto root = buildTree(4, 4, all);
+    Utils::ThreadPoolExecutor workers(4);
+
+    ComponentScheduler scheduler(root, &workers);
+    scheduler.setMinRangeSize(8);
+    for (int frame = 0; frame < 10; ++frame) {
+        for (auto* node : all)
+            node->lastSequence = 0;
+        scheduler.update(0.016f);
+    }
+
+    EXPECT_GT(scheduler.rangeCount(), 1u);
+    EXPECT_GT(scheduler.serialCount(), 0u);
+    for (auto* node : all) {
+        EXPECT_EQ(node->updates, 10) << node->getId();
+        EXPECT_FALSE(node->parentAfterChild) << node->getId();
+    }
+    workers.shutdown();
+}
+
+TEST(ComponentSchedulerTest, RebuildsOnlyOnStructuralChange) {
+    std::vector<OrderedComponent*> all;
+    auto root = buildTree(2, 2, all);
+
+    ComponentScheduler scheduler(root);
+    scheduler.update(0.016f);
+    scheduler.update(0.016f);
+    EXPECT_EQ(scheduler.rebuildCount(), 1u);
+
+    // Property edits do not touch structure
+    root->setProperty<int>("score", 1);
+    scheduler.update(0.016f);
+    EXPECT_EQ(scheduler.rebuildCount(), 1u);
+
+    auto extra = std::make_shared<OrderedComponent>("extra", all[1]);
+    all[1]->addChild(extra);
+    scheduler.update(0.016f);
+    EXPECT_EQ(scheduler.rebuildCount(), 2u);
+    EXPECT_EQ(scheduler.nodeCount(), all.size() + 1);
+    EXPECT_EQ(extra->updates, 1);
+
+    all[1]->removeChild("extra");
+    scheduler.update(0.016f);
+    EXPECT_EQ(scheduler.rebuildCount(), 3u);
+    EXPECT_EQ(extra->updates, 1);
+}
+
+TEST(ComponentSchedulerTest, NullRootIsNoOp) {
+    ComponentScheduler scheduler;
+    EXPECT_NO_THROW(scheduler.update(0.016f));
+    EXPECT_EQ(scheduler.nodeCount(), 0u);
+}
+
+TEST(ComponentSchedulerTest, ExceptionPropagatesAfterAllRangesFinish) {
+    std::vector<OrderedComponent*> all;
+    auto root = buildTree(4, 3, all);
+    Utils::ThreadPoolExecutor workers(2);
+
+    ComponentScheduler scheduler(root, &workers);
+    scheduler.setMinRangeSize(2);
+    all.back()->throwOnUpdate = true;
+
+    EXPECT_THROW(scheduler.update(0.016f), FabricException);
+    workers.shutdown();
+}
@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace fabric;
 using namespace fabric::Testing;
@@ -93,12 +95,99 @@ TEST_F(ComponentTest, PropertyGetThrowsOnMissingProperty) {
   EXPECT_THROW(rootComponent->getProperty<int>("nonexistent"), FabricException);
 }
 
-// Skip this test for now, as the template implementation makes it hard to test
-// TODO: Fix this test once the component property system is refactored
-TEST_F(ComponentTest, DISABLED_PropertyGetThrowsOnWrongType) {
+TEST_F(ComponentTest, PropertyGetThrowsOnWrongType) {
   rootComponent->setProperty<int>("intProp", 42);
-  
-  // Currently not working: std::shared_ptr<void> cannot be dynamic_cast
+
   EXPECT_THROW(rootComponent->getProperty<std::string>("intProp"), FabricException);
+  EXPECT_THROW(rootComponent->getProperty<float>(PropertyKey("intProp")), FabricException);
+}
+
+TEST_F(ComponentTest, PropertyKeyInterning) {
+  PropertyKey a("width");
+  PropertyKey b("width");
+  PropertyKey c("height");
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a.id(), c.id());
+  EXPECT_EQ(a.name(), "width");
+  EXPECT_EQ(PropertyKey::find("width"), a.id());
+  EXPECT_FALSE(PropertyKey::find("never-interned-property").has_value());
+}
+
+TEST_F(ComponentTest, PropertyKeyInterningAcrossThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kNames = 64;
+  std::vector<std::vector<PropertyId>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&ids, t] {
+      for (int round = 0; round < 2; ++round)
+        for (int i = 0; i < kNames; ++i) {
+          auto name = "threaded-prop-" + std::to_string((i * (t + 1)) % kNames);
+          PropertyId id = PropertyKey::intern(name);
+          if (round == 1)
+            ids[t].push_back(PropertyKey::find(name).value_or(~id));
+          else
+            ids[t].push_back(id);
+        }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  for (int t = 0; t < kThreads; ++t)
+    for (int i = 0; i < 2 * kNames; ++i) {
+      auto name = "threaded-prop-" + std::to_string(((i % kNames) * (t + 1)) % kNames);
+      EXPECT_EQ(ids[t][i], PropertyKey(name).id()) << name;
+    }
+}
+
+TEST_F(ComponentTest, PropertyKeyAndNameAccessAgree) {
+  static const PropertyKey kOpacity("opacity");
+  rootComponent->setProperty(kOpacity, 0.5f);
+
+  EXPECT_FLOAT_EQ(rootComponent->getProperty<float>("opacity"), 0.5f);
+  EXPECT_TRUE(rootComponent->hasProperty(kOpacity));
+  ASSERT_NE(rootComponent->findProperty<float>(kOpacity), nullptr);
+  EXPECT_FLOAT_EQ(*rootComponent->findProperty<float>(kOpacity), 0.5f);
+  EXPECT_EQ(rootComponent->findProperty<int>(kOpacity), nullptr);
+
+  // Overwrite keeps a single entry, even when the type changes
+  rootComponent->setProperty<int>("opacity", 1);
+  EXPECT_EQ(rootComponent->propertyCount(), 1u);
+  EXPECT_EQ(rootComponent->getProperty<int>(kOpacity), 1);
+
+  EXPECT_TRUE(rootComponent->removeProperty("opacity"));
+  EXPECT_FALSE(rootComponent->removeProperty(kOpacity));
+  EXPECT_FALSE(rootComponent->hasProperty("opacity"));
+}
+
+TEST_F(ComponentTest, ManyPropertiesStaySorted) {
+  std::vector<PropertyKey> keys;
+  for (int i = 0; i < 32; ++i)
+    keys.emplace_back("sorted-prop-" + std::to_string((i * 7) % 32));
+  for (int i = 0; i < 32; ++i)
+    rootComponent->setProperty<int>(keys[i], i);
+
+  for (int i = 0; i < 32; ++i)
+    EXPECT_EQ(rootComponent->getProperty<int>(keys[i]), i);
+  EXPECT_EQ(rootComponent->propertyCount(), 32u);
+}
+
+TEST_F(ComponentTest, RemoveChildReindexesRemaining) {
+  auto child3 = std::make_shared<MockComponent>("child3");
+  rootComponent->addChild(childComponent1);
+  rootComponent->addChild(childComponent2);
+  rootComponent->addChild(child3);
+
+  EXPECT_TRUE(rootComponent->removeChild("child1"));
+  EXPECT_EQ(rootComponent->getChild("child3"), child3);
+  EXPECT_EQ(rootComponent->getChild("child2"), childComponent2);
+  EXPECT_EQ(rootComponent->getChild("child1"), nullptr);
+
+  // The removed id can be reused
+  rootComponent->addChild(std::make_shared<MockComponent>("child1"));
+  ASSERT_EQ(rootComponent->children().size(), 3u);
+  EXPECT_EQ(rootComponent->children()[2]->getId(), "child1");
 }
 
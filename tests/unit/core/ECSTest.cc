@@ -1,10 +1,12 @@
 #include "fabric/core/ECS.hh"
 #include "fabric/core/Spatial.hh"
+#include "fabric/utils/ErrorHandling.hh"
 
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <cmath>
 #include <numbers>
+#include <string>
 #include <vector>
 
 using namespace fabric;
@@ -431,3 +433,221 @@ TEST(ECSTest, UpdateTransformsRotationPropagation) {
     EXPECT_NEAR(y, 0.0f, 1e-5f);
     EXPECT_NEAR(z, -1.0f, 1e-5f);
 }
+
+TEST(ECSTest, UpdateWorldBoundsAttachesAndTransforms) {
+    World world;
+    world.registerCoreComponents();
+
+    auto e = world.createSceneEntity("box");
+    e.set<BoundingBox>({0.0f, 0.0f, 0.0f, 2.0f, 1.0f, 1.0f});
+    // 90 degrees about Y, then translate +10 on X: x' = z + 10, z' = -x
+    e.set<LocalToWorld>({{0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 10, 0, 0, 1}});
+
+    world.updateWorldBounds();
+
+    const auto* wb = e.try_get<WorldBounds>();
+    ASSERT_NE(wb, nullptr);
+    EXPECT_NEAR(wb->minX, 10.0f, 1e-5f);
+    EXPECT_NEAR(wb->maxX, 11.0f, 1e-5f);
+    EXPECT_NEAR(wb->minY, 0.0f, 1e-5f);
+    EXPECT_NEAR(wb->maxY, 1.0f, 1e-5f);
+    EXPECT_NEAR(wb->minZ, -2.0f, 1e-5f);
+    EXPECT_NEAR(wb->maxZ, 0.0f, 1e-5f);
+}
+
+TEST(ECSTest, UpdateWorldBoundsWithoutLocalToWorldCopiesBox) {
+    World world;
+    world.registerCoreComponents();
+
+    auto e = world.get().entity().set<BoundingBox>({-1.0f, -2.0f, -3.0f, 1.0f, 2.0f, 3.0f});
+    world.updateWorldBounds();
+
+    const auto* wb = e.try_get<WorldBounds>();
+    ASSERT_NE(wb, nullptr);
+    EXPECT_FLOAT_EQ(wb->minY, -2.0f);
+    EXPECT_FLOAT_EQ(wb->maxZ, 3.0f);
+}
+
+TEST(ECSTest, UpdateWorldBoundsSkipsUnchangedTables) {
+    World world;
+    world.registerCoreComponents();
+
+    auto e = world.createSceneEntity("static");
+    e.set<BoundingBox>({-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f});
+    world.updateWorldBounds();
+
+    // Scribble on the cached bounds without touching the inputs: a refresh
+    // that skips unchanged tables leaves the scribble alone
+    e.ensure<WorldBounds>().minX = 42.0f;
+    world.updateWorldBounds();
+    EXPECT_FLOAT_EQ(e.try_get<WorldBounds>()->minX, 42.0f);
+
+    // Moving the entity changes LocalToWorld, so its table is re-fitted
+    e.set<LocalToWorld>({{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 5, 0, 0, 1}});
+    world.updateWorldBounds();
+    EXPECT_FLOAT_EQ(e.try_get<WorldBounds>()->minX, 4.0f);
+    EXPECT_FLOAT_EQ(e.try_get<WorldBounds>()->maxX, 6.0f);
+}
+
+TEST(ECSTest, RunFrameRunsPhasesInOrder) {
+    World world;
+    world.registerCoreComponents();
+    world.registerEnginePipeline(0.1);
+
+    std::vector<std::string> trace;
+    auto& w = world.get();
+    // Registered out of order on purpose: the phase decides, not registration
+    w.system("Extract").kind<phase::RenderExtraction>().run([&](flecs::iter&) { trace.push_back("extract"); });
+    w.system("Cull").kind<phase::Culling>().run([&](flecs::iter&) { trace.push_back("cull"); });
+    w.system("Step").kind<phase::Simulation>().run([&](flecs::iter&) { trace.push_back("step"); });
+    w.system("Gameplay").run([&](flecs::iter&) { trace.push_back("gameplay"); });
+    w.system("Input").kind<phase::Input>().run([&](flecs::iter&) { trace.push_back("input"); });
+
+    EXPECT_EQ(world.runFrame(0.25), 2);
+    std::vector<std::string> expected = {"input", "step", "step", "gameplay", "cull", "extract"};
+    EXPECT_EQ(trace, expected);
+    EXPECT_NEAR(world.fixedStepAlpha(), 0.5, 1e-9);
+
+    // The leftover half step carries into the next frame
+    trace.clear();
+    EXPECT_EQ(world.runFrame(0.06), 1);
+    expected = {"input", "step", "gameplay", "cull", "extract"};
+    EXPECT_EQ(trace, expected);
+}
+
+// Transforms and bounds stay on the calling thread; worker threads (used by
+// root interpolation) must not change their results
+TEST(ECSTest, RunFrameUpdatesTransformsAndBoundsWithThreadsSet) {
+    World world;
+    world.registerCoreComponents();
+    world.registerEnginePipeline();
+    world.setThreads(4);
+
+    std::vector<flecs::entity> roots;
+    for (int i = 0; i < 64; ++i) {
+        auto root = world.createSceneEntity();
+        root.set<Position>({static_cast<float>(i), 0.0f, 0.0f});
+        roots.push_back(root);
+    }
+    auto child = world.createChildEntity(roots[10], "child");
+    child.set<Position>({0.0f, 3.0f, 0.0f});
+    child.set<BoundingBox>({-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f});
+
+    world.runFrame(0.0);
+
+    for (int i = 0; i < 64; ++i)
+        EXPECT_FLOAT_EQ(roots[static_cast<size_t>(i)].get<LocalToWorld>().matrix[12], static_cast<float>(i));
+
+    float x, y, z;
+    extractTranslation(child.get<LocalToWorld>(), x, y, z);
+    EXPECT_FLOAT_EQ(x, 10.0f);
+    EXPECT_FLOAT_EQ(y, 3.0f);
+
+    const auto* wb = child.try_get<WorldBounds>();
+    ASSERT_NE(wb, nullptr);
+    EXPECT_FLOAT_EQ(wb->minX, 9.0f);
+    EXPECT_FLOAT_EQ(wb->maxY, 4.0f);
+}
+
+TEST(ECSTest, RunFrameSkipsStaticTables) {
+    World world;
+    world.registerCoreComponents();
+    world.registerEnginePipeline();
+
+    auto still = world.createSceneEntity("still");
+    still.set<BoundingBox>({-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f});
+    auto child = world.createChildEntity(still, "child");
+    child.set<BoundingBox>({-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f});
+    auto mover = world.createSceneEntity("mover");
+    mover.set<BoundingBox>({-1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f});
+    mover.set<Renderable>({0}); // A table of its own
+
+    // Gaining WorldBounds moves entities to new tables, which count as
+    // changed once more on the following frame
+    world.runFrame(0.0);
+    world.runFrame(0.0);
+
+    // Scribble on derived data without touching any input: frames that skip
+    // unchanged tables leave the scribbles alone
+    still.ensure<LocalToWorld>().matrix[13] = 7.0f;
+    still.ensure<WorldBounds>().minX = 42.0f;
+    child.ensure<WorldBounds>().minX = 42.0f;
+    mover.set<Position>({5.0f, 0.0f, 0.0f});
+    world.runFrame(0.0);
+
+    EXPECT_FLOAT_EQ(still.get<LocalToWorld>().matrix[13], 7.0f);
+    EXPECT_FLOAT_EQ(still.get<WorldBounds>().minX, 42.0f);
+    EXPECT_FLOAT_EQ(child.get<WorldBounds>().minX, 42.0f);
+    EXPECT_FLOAT_EQ(mover.get<WorldBounds>().minX, 4.0f);
+
+    // Moving the parent recomposes and re-fits the child
+    still.set<Position>({0.0f, 2.0f, 0.0f});
+    world.runFrame(0.0);
+    EXPECT_FLOAT_EQ(still.get<WorldBounds>().minY, 1.0f);
+    EXPECT_FLOAT_EQ(child.get<WorldBounds>().minY, 1.0f);
+    EXPECT_FLOAT_EQ(child.get<WorldBounds>().minX, -1.0f);
+}
+
+TEST(ECSTest, RunFrameInterpolatesRenderTransform) {
+    World world;
+    world.registerCoreComponents();
+    world.registerEnginePipeline(0.1);
+
+    auto mover = world.createSceneEntity("mover");
+    mover.add<PreviousTransform>();
+    auto rider = world.createChildEntity(mover, "rider");
+    rider.set<Position>({0.0f, 2.0f, 0.0f});
+    rider.add<PreviousTransform>();
+    EXPECT_TRUE(mover.has<RenderTransform>());
+
+    world.get().system<Position>("Advance").kind<phase::Simulation>().each([mover](flecs::entity e, Position& p) {
+        if (e == mover)
+            p.x += 1.0f;
+    });
+
+    // One step from x=0 to x=1 with half a step left over
+    EXPECT_EQ(world.runFrame(0.15), 1);
+    EXPECT_NEAR(world.fixedStepAlpha(), 0.5, 1e-9);
+
+    EXPECT_FLOAT_EQ(mover.get<LocalToWorld>().matrix[12], 1.0f);
+    EXPECT_FLOAT_EQ(mover.get<RenderTransform>().matrix[12], 0.5f);
+
+    // The child rides its parent's render matrix, not its LocalToWorld
+    float x, y, z;
+    extractTranslation(rider.get<LocalToWorld>(), x, y, z);
+    EXPECT_FLOAT_EQ(x, 1.0f);
+    const auto& render = rider.get<RenderTransform>().matrix;
+    EXPECT_FLOAT_EQ(render[12], 0.5f);
+    EXPECT_FLOAT_EQ(render[13], 2.0f);
+
+    // No step this frame: the same pair, further along
+    EXPECT_EQ(world.runFrame(0.03), 0);
+    EXPECT_NEAR(mover.get<RenderTransform>().matrix[12], 0.8f, 1e-5f);
+}
+
+TEST(ECSTest, SystemTimingsNameEngineSystems) {
+    World world;
+    world.registerCoreComponents();
+    world.registerEnginePipeline();
+    world.enableSystemStats();
+    world.createSceneEntity("timed");
+
+    world.runFrame(1.0 / 60.0);
+
+    std::vector<std::string> names;
+    for (const auto& timing : world.systemTimings()) {
+        names.push_back(timing.name);
+        EXPECT_GE(timing.seconds, 0.0);
+    }
+    for (const char* expected : {"RootTransforms", "ChildTransforms", "AttachWorldBounds", "RefreshWorldBounds"})
+        EXPECT_NE(std::find(names.begin(), names.end(), expected), names.end()) << expected;
+}
+
+TEST(ECSTest, EnginePipelineMisuseThrows) {
+    World world;
+    world.registerCoreComponents();
+    EXPECT_THROW(world.runFrame(0.1), FabricException);
+
+    world.registerEnginePipeline();
+    EXPECT_THROW(world.registerEnginePipeline(), FabricException);
+}
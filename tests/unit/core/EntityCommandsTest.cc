@@ -0,0 +1,164 @@
+#include "fabric/core/EntityCommands.hh"
+#include "fabric/core/ECS.hh"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+struct Label {
+    std::string text;
+    std::shared_ptr<int> token;
+};
+
+} // namespace
+
+TEST(EntityCommandsTest, AppliesInRecordingOrder) {
+    World world;
+    world.registerCoreComponents();
+    auto parent = world.createSceneEntity("parent");
+
+    EntityCommandBuffer buffer;
+    auto child = buffer.create("child");
+    buffer.set<Position>(child, {1.0f, 2.0f, 3.0f});
+    buffer.add<SceneEntity>(child);
+    buffer.childOf(child, parent);
+    buffer.set<Position>(parent, {4.0f, 5.0f, 6.0f});
+    EXPECT_EQ(buffer.size(), 5u);
+
+    auto created = buffer.apply(world.get());
+    ASSERT_EQ(created.size(), 1u);
+    EXPECT_TRUE(buffer.empty());
+
+    auto found = world.get().lookup("parent::child");
+    ASSERT_TRUE(found.is_valid());
+    EXPECT_EQ(found, created[0]);
+    EXPECT_TRUE(found.has<SceneEntity>());
+    EXPECT_FLOAT_EQ(found.get<Position>().y, 2.0f);
+    EXPECT_FLOAT_EQ(parent.get<Position>().z, 6.0f);
+}
+
+TEST(EntityCommandsTest, WorkerBuffersMergeBySortKey) {
+    World world;
+    world.registerCoreComponents();
+
+    constexpr int kJobs = 8;
+    std::vector<std::thread> workers;
+    for (int job = 0; job < kJobs; ++job) {
+        workers.emplace_back([&world, job] {
+            auto buffer = world.commands().acquire(static_cast<uint64_t>(job));
+            auto e = buffer->create(("job_" + std::to_string(job)).c_str());
+            buffer->set<Position>(e, {static_cast<float>(job), 0.0f, 0.0f});
+            world.commands().submit(std::move(buffer));
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+
+    EXPECT_EQ(world.commands().pendingBuffers(), static_cast<size_t>(kJobs));
+    EXPECT_EQ(world.flushCommands(), static_cast<size_t>(kJobs * 2));
+    EXPECT_EQ(world.commands().pendingBuffers(), 0u);
+
+    // Ids are handed out in merge order, whichever worker finished first
+    flecs::entity_t previous = 0;
+    for (int job = 0; job < kJobs; ++job) {
+        auto e = world.get().lookup(("job_" + std::to_string(job)).c_str());
+        ASSERT_TRUE(e.is_valid());
+        EXPECT_FLOAT_EQ(e.get<Position>().x, static_cast<float>(job));
+        EXPECT_GT(e.id(), previous);
+        previous = e.id();
+    }
+}
+
+TEST(EntityCommandsTest, CommandsOnDeadEntitiesAreDropped) {
+    World world;
+    world.registerCoreComponents();
+    auto doomed = world.get().entity().set<Position>({1.0f, 1.0f, 1.0f});
+    auto stale = world.get().entity();
+    stale.destruct();
+
+    EntityCommandBuffer buffer;
+    buffer.destroy(doomed);
+    buffer.set<Position>(doomed, {2.0f, 2.0f, 2.0f});
+    buffer.add<SceneEntity>(stale);
+    auto temp = buffer.create();
+    buffer.destroy(temp);
+
+    auto created = buffer.apply(world.get());
+
+    EXPECT_FALSE(doomed.is_alive());
+    EXPECT_FALSE(stale.is_alive());
+    ASSERT_EQ(created.size(), 1u);
+    EXPECT_FALSE(created[0].is_alive());
+}
+
+TEST(EntityCommandsTest, FlushCountsOnlyAppliedCommands) {
+    World world;
+    world.registerCoreComponents();
+    auto stale = world.get().entity();
+    stale.destruct();
+
+    auto buffer = world.commands().acquire();
+    auto e = buffer->create();
+    buffer->set<Position>(e, {1.0f, 0.0f, 0.0f});
+    buffer->add<SceneEntity>(stale);
+    buffer->childOf(e, stale);
+    const auto* recorded = buffer.get();
+    world.commands().submit(std::move(buffer));
+
+    EXPECT_EQ(world.flushCommands(), 2u);
+
+    // The buffer comes back empty from the free list
+    auto recycled = world.commands().acquire(3);
+    EXPECT_EQ(recycled.get(), recorded);
+    EXPECT_TRUE(recycled->empty());
+    EXPECT_EQ(recycled->sortKey(), 3u);
+}
+
+TEST(EntityCommandsTest, PayloadsAreReleased) {
+    World world;
+    world.get().component<Label>();
+    auto token = std::make_shared<int>(7);
+
+    {
+        EntityCommandBuffer dropped;
+        dropped.set<Label>(dropped.create(), {"dropped", token});
+        EXPECT_EQ(token.use_count(), 2);
+        dropped.clear();
+        EXPECT_EQ(token.use_count(), 1);
+    }
+
+    EntityCommandBuffer buffer;
+    auto e = buffer.create();
+    buffer.set<Label>(e, {"kept", token});
+    auto created = buffer.apply(world.get());
+    ASSERT_EQ(created.size(), 1u);
+    EXPECT_EQ(created[0].get<Label>().text, "kept");
+    EXPECT_EQ(token.use_count(), 2);
+
+    created[0].destruct();
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(EntityCommandsTest, RunFrameFlushesBeforeInput) {
+    World world;
+    world.registerCoreComponents();
+    world.registerEnginePipeline();
+
+    int seen = -1;
+    world.get().system("CountBeforeInput").kind<phase::Input>().run([&](flecs::iter&) {
+        seen = world.get().count<SceneEntity>();
+    });
+
+    auto buffer = world.commands().acquire();
+    buffer->add<SceneEntity>(buffer->create());
+    world.commands().submit(std::move(buffer));
+
+    world.runFrame(0.0);
+    EXPECT_EQ(seen, 1);
+}
@@ -1,4 +1,5 @@
 #include "fabric/core/Event.hh"
+#include "fabric/utils/AllocationTracker.hh"
 #include "fabric/utils/Testing.hh"
 #include "fabric/utils/ErrorHandling.hh"
 #include <gtest/gtest.h>
@@ -254,3 +255,27 @@ TEST_F(EventTest, BinaryDataInVariant) {
   EXPECT_EQ(result[3], 0xEF);
 }
 
+
+TEST_F(EventTest, DispatchWithListenersDoesNotAllocate) {
+  int calls = 0;
+  dispatcher->addEventListener("click", [&calls](Event&) { ++calls; });
+  dispatcher->addEventListener("click", [&calls](Event&) { ++calls; }, 5);
+
+  EXPECT_NO_ALLOCATIONS({ dispatcher->dispatchEvent(*testEvent1); });
+  EXPECT_EQ(calls, 2);
+}
+
+TEST_F(EventTest, RemoveDuringDispatchKeepsCurrentSnapshot) {
+  int calls = 0;
+  std::string second;
+  dispatcher->addEventListener("click", [&](Event&) {
+    ++calls;
+    dispatcher->removeEventListener("click", second);
+  });
+  second = dispatcher->addEventListener("click", [&calls](Event&) { ++calls; });
+
+  dispatcher->dispatchEvent(*testEvent1);
+  EXPECT_EQ(calls, 2);
+  dispatcher->dispatchEvent(*testEvent1);
+  EXPECT_EQ(calls, 3);
+}
@@ -1,4 +1,5 @@
 #include "fabric/core/InputManager.hh"
+#include "fabric/utils/ErrorHandling.hh"
 #include <gtest/gtest.h>
 #include <string>
 #include <vector>
@@ -221,3 +222,104 @@ TEST_F(InputManagerTest, WorksWithoutDispatcher) {
     EXPECT_TRUE(noDispatcher.processEvent(e));
     EXPECT_TRUE(noDispatcher.isActionActive("test"));
 }
+
+// Interned action ids
+
+TEST_F(InputManagerTest, BindKeyReturnsStableActionId) {
+    ActionId jump = input.bindKey("jump", SDLK_SPACE);
+    ActionId jumpAlt = input.bindKey("jump", SDLK_J);
+    ActionId crouch = input.bindKey("crouch", SDLK_C);
+
+    EXPECT_EQ(jump, jumpAlt);
+    EXPECT_NE(jump, crouch);
+    EXPECT_EQ(input.findAction("jump"), jump);
+    EXPECT_EQ(input.actionName(crouch), "crouch");
+    EXPECT_FALSE(input.findAction("unknown").has_value());
+    EXPECT_FALSE(input.isActionActive("unknown"));
+    EXPECT_EQ(input.actionCount(), 2u);
+}
+
+TEST_F(InputManagerTest, IdAndStringQueriesAgree) {
+    ActionId jump = input.bindKey("jump", SDLK_SPACE);
+    input.processEvent(makeKeyDown(SDLK_SPACE));
+
+    EXPECT_TRUE(input.isActionActive(jump));
+    EXPECT_TRUE(input.isActionActive("jump"));
+    EXPECT_TRUE(input.activeActions().test(jump));
+}
+
+TEST_F(InputManagerTest, PressedAndReleasedEdgesLastOneFrame) {
+    ActionId fire = input.bindKey("fire", SDLK_F);
+
+    input.processEvent(makeKeyDown(SDLK_F));
+    EXPECT_TRUE(input.wasActionPressed(fire));
+    EXPECT_FALSE(input.wasActionReleased(fire));
+    EXPECT_FALSE(input.previousActions().test(fire));
+
+    input.beginFrame();
+    EXPECT_FALSE(input.wasActionPressed(fire));
+    EXPECT_TRUE(input.isActionActive(fire));
+    EXPECT_TRUE(input.previousActions().test(fire));
+
+    input.processEvent(makeKeyUp(SDLK_F));
+    EXPECT_TRUE(input.wasActionReleased(fire));
+    EXPECT_FALSE(input.isActionActive(fire));
+}
+
+TEST_F(InputManagerTest, TapWithinOneFrameReportsBothEdges) {
+    ActionId fire = input.bindKey("fire", SDLK_F);
+    input.processEvent(makeKeyDown(SDLK_F));
+    input.processEvent(makeKeyUp(SDLK_F));
+
+    EXPECT_FALSE(input.isActionActive(fire));
+    EXPECT_TRUE(input.wasActionPressed(fire));
+    EXPECT_TRUE(input.wasActionReleased(fire));
+}
+
+TEST_F(InputManagerTest, TooManyActionsThrows) {
+    for (size_t i = 0; i < kMaxInputActions; ++i)
+        input.actionId("action" + std::to_string(i));
+    EXPECT_THROW(input.actionId("one-too-many"), FabricException);
+}
+
+// Binary state frames
+
+TEST_F(InputManagerTest, StateFrameRoundTrip) {
+    ActionId forward = input.bindKey("move_forward", SDLK_W);
+    ActionId jump = input.bindKey("jump", SDLK_SPACE);
+    input.processEvent(makeKeyDown(SDLK_W));
+    input.processEvent(makeKeyDown(SDLK_SPACE));
+    input.processEvent(makeKeyUp(SDLK_SPACE));
+    input.processEvent(makeMouseMotion(5.0f, 5.0f, 1.5f, -2.0f));
+    input.processEvent(makeMouseButton(3, true));
+
+    auto frame = input.captureFrame();
+    auto bytes = frame.serialize();
+    // varint count + 3 bitset bytes + two floats + button mask
+    EXPECT_EQ(bytes.size(), 1u + 3u + 8u + 1u);
+
+    auto decoded = InputStateFrame::deserialize(bytes);
+    EXPECT_EQ(decoded, frame);
+
+    InputManager remote;
+    remote.bindKey("move_forward", SDLK_W);
+    remote.bindKey("jump", SDLK_SPACE);
+    remote.applyFrame(decoded);
+    EXPECT_TRUE(remote.isActionActive(forward));
+    EXPECT_FALSE(remote.isActionActive(jump));
+    EXPECT_TRUE(remote.wasActionPressed(jump));
+    EXPECT_TRUE(remote.wasActionReleased(jump));
+    EXPECT_FLOAT_EQ(remote.mouseDeltaX(), 1.5f);
+    EXPECT_FLOAT_EQ(remote.mouseDeltaY(), -2.0f);
+    EXPECT_TRUE(remote.mouseButton(3));
+}
+
+TEST_F(InputManagerTest, StateFrameRejectsTruncatedData) {
+    input.bindKey("jump", SDLK_SPACE);
+    auto bytes = input.captureFrame().serialize();
+    bytes.pop_back();
+    EXPECT_THROW(InputStateFrame::deserialize(bytes), FabricException);
+
+    std::vector<uint8_t> hugeCount = {0xFF, 0x01};
+    EXPECT_THROW(InputStateFrame::deserialize(hugeCount), FabricException);
+}
@@ -0,0 +1,152 @@
+#include "fabric/core/InputRecorder.hh"
+#include "fabric/core/InputManager.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+using namespace fabric;
+
+class InputRecorderTest : public ::testing::Test {
+  protected:
+    static SDL_Event makeKey(SDL_Keycode key, bool down, bool repeat = false) {
+        SDL_Event e = {};
+        e.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+        e.key.key = key;
+        e.key.mod = SDL_KMOD_LSHIFT;
+        e.key.down = down;
+        e.key.repeat = repeat;
+        return e;
+    }
+
+    static SDL_Event makeMouseMotion(float x, float y, float xrel, float yrel) {
+        SDL_Event e = {};
+        e.type = SDL_EVENT_MOUSE_MOTION;
+        e.motion.x = x;
+        e.motion.y = y;
+        e.motion.xrel = xrel;
+        e.motion.yrel = yrel;
+        return e;
+    }
+
+    static SDL_Event makeMouseButton(Uint8 button, bool down) {
+        SDL_Event e = {};
+        e.type = down ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+        e.button.button = button;
+        e.button.down = down;
+        e.button.x = 640.0f;
+        e.button.y = 360.0f;
+        return e;
+    }
+
+    // Three frames: press W and look, click, release W and quit
+    static InputRecording sampleRecording() {
+        InputRecorder recorder;
+        recorder.beginFrame(0.016);
+        recorder.record(makeKey(SDLK_W, true));
+        recorder.record(makeMouseMotion(10.0f, 20.0f, 1.5f, -0.25f));
+        recorder.beginFrame(0.017);
+        recorder.record(makeMouseButton(SDL_BUTTON_LEFT, true));
+        recorder.record(makeMouseButton(SDL_BUTTON_LEFT, false));
+        recorder.beginFrame(0.015);
+        recorder.record(makeKey(SDLK_W, false));
+        SDL_Event quit = {};
+        quit.type = SDL_EVENT_QUIT;
+        recorder.record(quit);
+        return recorder.recording();
+    }
+};
+
+TEST_F(InputRecorderTest, RecordsFramesAndSamples) {
+    auto recording = sampleRecording();
+    ASSERT_EQ(recording.frames.size(), 3u);
+    EXPECT_EQ(recording.frames[0].dtNs, 16'000'000u);
+    EXPECT_EQ(recording.sampleCount(), 6u);
+    EXPECT_NEAR(recording.durationSeconds(), 0.048, 1e-9);
+
+    const auto& motion = recording.frames[0].samples[1];
+    EXPECT_EQ(motion.type, InputSampleType::MouseMotion);
+    EXPECT_FLOAT_EQ(motion.dx, 1.5f);
+    EXPECT_FLOAT_EQ(motion.dy, -0.25f);
+}
+
+TEST_F(InputRecorderTest, SkipsKeyRepeatAndUnusedEvents) {
+    InputRecorder recorder;
+    recorder.beginFrame(0.016);
+    recorder.record(makeKey(SDLK_W, true, true));
+    SDL_Event wheel = {};
+    wheel.type = SDL_EVENT_MOUSE_WHEEL;
+    recorder.record(wheel);
+    EXPECT_TRUE(recorder.recording().frames[0].samples.empty());
+}
+
+TEST_F(InputRecorderTest, SerializeRoundTrips) {
+    auto recording = sampleRecording();
+    auto bytes = recording.serialize();
+    auto decoded = InputRecording::deserialize(bytes);
+
+    ASSERT_EQ(decoded.frames.size(), recording.frames.size());
+    for (size_t i = 0; i < recording.frames.size(); ++i) {
+        EXPECT_EQ(decoded.frames[i].dtNs, recording.frames[i].dtNs);
+        EXPECT_EQ(decoded.frames[i].samples, recording.frames[i].samples);
+    }
+}
+
+TEST_F(InputRecorderTest, DeserializeRejectsCorruptData) {
+    std::vector<uint8_t> garbage = {'n', 'o', 'p', 'e', 1, 0, 0, 0};
+    EXPECT_THROW(InputRecording::deserialize(garbage), FabricException);
+
+    auto bytes = sampleRecording().serialize();
+    bytes.resize(bytes.size() - 3);
+    EXPECT_THROW(InputRecording::deserialize(bytes), FabricException);
+
+    bytes = sampleRecording().serialize();
+    bytes[4] = 99; // version
+    EXPECT_THROW(InputRecording::deserialize(bytes), FabricException);
+}
+
+TEST_F(InputRecorderTest, SaveAndLoadFile) {
+    auto path = (std::filesystem::temp_directory_path() / "fabric_input_test.finput").string();
+    auto recording = sampleRecording();
+    ASSERT_TRUE(recording.save(path));
+
+    auto loaded = InputRecording::load(path);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->sampleCount(), recording.sampleCount());
+    std::filesystem::remove(path);
+
+    EXPECT_FALSE(InputRecording::load(path).has_value());
+}
+
+TEST_F(InputRecorderTest, ReplayDrivesInputManager) {
+    EventDispatcher dispatcher;
+    InputManager input(dispatcher);
+    input.bindKey("move_forward", SDLK_W);
+
+    InputReplayer replayer(sampleRecording());
+    bool quit = false;
+    auto sink = [&](const SDL_Event& event) {
+        input.processEvent(event);
+        if (event.type == SDL_EVENT_QUIT)
+            quit = true;
+    };
+
+    EXPECT_DOUBLE_EQ(replayer.nextFrame(sink), 0.016);
+    EXPECT_TRUE(input.isActionActive("move_forward"));
+    EXPECT_FLOAT_EQ(input.mouseDeltaX(), 1.5f);
+    input.beginFrame();
+
+    replayer.nextFrame(sink);
+    EXPECT_FALSE(input.mouseButton(SDL_BUTTON_LEFT));
+    EXPECT_FLOAT_EQ(input.mouseDeltaX(), 0.0f);
+
+    replayer.nextFrame(sink);
+    EXPECT_FALSE(input.isActionActive("move_forward"));
+    EXPECT_TRUE(quit);
+    EXPECT_TRUE(replayer.finished());
+    EXPECT_EQ(replayer.nextFrame(sink), 0.0);
+
+    replayer.rewind();
+    EXPECT_EQ(replayer.frameIndex(), 0u);
+}
@@ -58,4 +58,55 @@ TEST_F(JsonTypesTest, FromJsonMissingField) {
   EXPECT_THROW(j.get_to(v), nlohmann::json::out_of_range);
 }
 
+TEST_F(JsonTypesTest, BinaryFormatsRoundTrip) {
+  Quaternion<float> original(0.1f, 0.2f, 0.3f, 0.9f);
+  for (auto format : {JsonFormat::Text, JsonFormat::MessagePack, JsonFormat::Cbor}) {
+    auto bytes = encodeJson(original, format);
+    auto restored = decodeJson<Quaternion<float>>(bytes, format);
+    EXPECT_FLOAT_EQ(restored.x, 0.1f);
+    EXPECT_FLOAT_EQ(restored.y, 0.2f);
+    EXPECT_FLOAT_EQ(restored.z, 0.3f);
+    EXPECT_FLOAT_EQ(restored.w, 0.9f);
+  }
+}
+
+TEST_F(JsonTypesTest, BinaryFormatsAreSmallerThanText) {
+  Vector3<float, Space::World> v(1.5f, -2.25f, 1024.0f);
+  auto text = encodeJson(v, JsonFormat::Text);
+  EXPECT_LT(encodeJson(v, JsonFormat::MessagePack).size(), text.size());
+  EXPECT_LT(encodeJson(v, JsonFormat::Cbor).size(), text.size());
+}
+
+TEST_F(JsonTypesTest, DecodeMalformedBinaryThrows) {
+  std::vector<uint8_t> truncated = encodeJson(Vector3<float, Space::World>(1.0f, 2.0f, 3.0f), JsonFormat::Cbor);
+  truncated.resize(truncated.size() / 2);
+  EXPECT_THROW(decodeJson<Vector3<float>>(truncated, JsonFormat::Cbor), nlohmann::json::parse_error);
+}
+
+TEST_F(JsonTypesTest, SaxParseSeesBinaryValues) {
+  struct Counter : nlohmann::json_sax<nlohmann::json> {
+    int keys = 0;
+    int numbers = 0;
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool number_integer(number_integer_t) override { ++numbers; return true; }
+    bool number_unsigned(number_unsigned_t) override { ++numbers; return true; }
+    bool number_float(number_float_t, const string_t&) override { ++numbers; return true; }
+    bool string(string_t&) override { return true; }
+    bool binary(binary_t&) override { return true; }
+    bool start_object(std::size_t) override { return true; }
+    bool key(string_t&) override { ++keys; return true; }
+    bool end_object() override { return true; }
+    bool start_array(std::size_t) override { return true; }
+    bool end_array() override { return true; }
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override { return false; }
+  };
+
+  auto bytes = encodeJson(Vector4<float, Space::World>(1.0f, 2.0f, 3.0f, 4.0f), JsonFormat::MessagePack);
+  Counter counter;
+  EXPECT_TRUE(parseJsonSax(bytes, JsonFormat::MessagePack, counter));
+  EXPECT_EQ(counter.keys, 4);
+  EXPECT_EQ(counter.numbers, 4);
+}
+
 } // namespace fabric
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "fabric/core/MetricsServer.hh"
+
+#include <asio/connect.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/read.hpp>
+#include <asio/write.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace fabric;
+
+namespace {
+
+std::string fetch(uint16_t port, const std::string& request) {
+    asio::io_context client;
+    asio::ip::tcp::socket socket(client);
+    socket.connect({asio::ip::make_address("127.0.0.1"), port});
+    asio::write(socket, asio::buffer(request));
+
+    std::string response;
+    asio::error_code ec;
+    asio::read(socket, asio::dynamic_buffer(response), ec);
+    return response;
+}
+
+} // namespace
+
+TEST(MetricsServerTest, BuildResponseServesMetrics) {
+    MetricsRegistry registry;
+    registry.counter("fabric_requests_total").add(2);
+
+    auto response = MetricsServer::buildResponse("GET /metrics HTTP/1.1\r\nHost: x\r\n\r\n", registry);
+    EXPECT_EQ(response.rfind("HTTP/1.1 200 OK\r\n", 0), 0u);
+    EXPECT_NE(response.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+    EXPECT_NE(response.find("fabric_requests_total 2\n"), std::string::npos);
+}
+
+TEST(MetricsServerTest, BuildResponseRejectsOtherRequests) {
+    MetricsRegistry registry;
+    EXPECT_EQ(MetricsServer::buildResponse("GET / HTTP/1.1\r\n\r\n", registry).rfind("HTTP/1.1 404", 0), 0u);
+    EXPECT_EQ(MetricsServer::buildResponse("POST /metrics HTTP/1.1\r\n\r\n", registry).rfind("HTTP/1.1 405", 0), 0u);
+    EXPECT_EQ(MetricsServer::buildResponse("garbage", registry).rfind("HTTP/1.1 400", 0), 0u);
+}
+
+TEST(MetricsServerTest, InvalidAddressFailsToStart) {
+    MetricsRegistry registry;
+    asio::io_context context;
+    MetricsServer server(registry, context);
+    EXPECT_FALSE(server.start("not-an-address", 0));
+    EXPECT_FALSE(server.running());
+}
+
+TEST(MetricsServerTest, ServesScrapeOverLoopback) {
+    MetricsRegistry registry;
+    registry.gauge("fabric_test_value").set(42);
+
+    asio::io_context context;
+    MetricsServer server(registry, context);
+    ASSERT_TRUE(server.start("127.0.0.1", 0));
+    ASSERT_NE(server.port(), 0);
+
+    std::atomic<bool> done{false};
+    std::string response;
+    std::thread client([&] {
+        response = fetch(server.port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        done = true;
+    });
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!done && std::chrono::steady_clock::now() < deadline) {
+        context.poll();
+        context.restart();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    client.join();
+
+    EXPECT_NE(response.find("200 OK"), std::string::npos);
+    EXPECT_NE(response.find("fabric_test_value 42\n"), std::string::npos);
+    EXPECT_EQ(server.requestCount(), 1u);
+
+    server.stop();
+    context.poll();
+    EXPECT_FALSE(server.running());
+}
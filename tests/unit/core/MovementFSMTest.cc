@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "fabric/core/MovementFSM.hh"
+#include <vector>
 
 using namespace fabric;
 
@@ -136,3 +137,21 @@ TEST_F(MovementFSMTest, StateToStringCoversAllStates) {
     EXPECT_EQ(MovementFSM::stateToString(CharacterState::Dashing), "Dashing");
     EXPECT_EQ(MovementFSM::stateToString(CharacterState::Boosting), "Boosting");
 }
+
+TEST_F(MovementFSMTest, StateTracksPrevious) {
+    fsm.tryTransition(CharacterState::Jumping);
+    fsm.tryTransition(CharacterState::Falling);
+    EXPECT_EQ(fsm.state().state, CharacterState::Falling);
+    EXPECT_EQ(fsm.state().previous, CharacterState::Jumping);
+}
+
+TEST(MovementStateTest, BatchOfCharacters) {
+    std::vector<MovementState> characters(3, MovementState(CharacterState::Grounded));
+    characters[2].tryTransition(CharacterState::Flying);
+
+    std::vector<CharacterState> targets(3, CharacterState::Boosting);
+    EXPECT_EQ(applyTransitions<kMovementTransitions>(characters, targets), 1u);
+    EXPECT_EQ(characters[0].state, CharacterState::Grounded);
+    EXPECT_EQ(characters[2].state, CharacterState::Boosting);
+    EXPECT_TRUE(MovementFSM::isFlying(characters[2].state));
+}
@@ -1,5 +1,8 @@
 #include "fabric/core/Pipeline.hh"
+#include "fabric/utils/AllocationTracker.hh"
+#include <functional>
 #include <gtest/gtest.h>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -174,3 +177,118 @@ TEST(PipelineTest, HandlerCount) {
   pipeline.addHandler("named", [](TestContext&, auto next) { next(); });
   EXPECT_EQ(pipeline.handlerCount(), 2u);
 }
+
+TEST(PipelineTest, ExecuteDoesNotAllocate) {
+  Pipeline<TestContext> pipeline;
+  for (int i = 0; i < 10; ++i) {
+    pipeline.addHandler([](TestContext& ctx, auto next) {
+      ++ctx.value;
+      next();
+    }, i);
+  }
+  pipeline.compile();
+
+  TestContext ctx;
+  EXPECT_NO_ALLOCATIONS({ pipeline.execute(ctx); });
+  EXPECT_EQ(ctx.value, 10);
+}
+
+TEST(PipelineTest, RecompilesAfterChange) {
+  Pipeline<TestContext> pipeline;
+  pipeline.addHandler("b", [](TestContext& ctx, auto next) {
+    ctx.log.push_back("B");
+    next();
+  }, 1);
+
+  TestContext first;
+  pipeline.execute(first);
+  ASSERT_EQ(first.log.size(), 1u);
+
+  pipeline.addHandler("a", [](TestContext& ctx, auto next) {
+    ctx.log.push_back("A");
+    next();
+  }, 0);
+
+  TestContext second;
+  pipeline.execute(second);
+  ASSERT_EQ(second.log.size(), 2u);
+  EXPECT_EQ(second.log[0], "A");
+  EXPECT_EQ(second.log[1], "B");
+}
+
+TEST(PipelineTest, CopyOfCompiledPipelineOutlivesOriginal) {
+  auto original = std::make_unique<Pipeline<TestContext>>();
+  original->addHandler("second", [](TestContext& ctx, auto next) {
+    ctx.log.push_back("B");
+    next();
+  }, 1);
+  original->addHandler("first", [](TestContext& ctx, auto next) {
+    ctx.log.push_back("A");
+    next();
+  }, 0);
+  original->compile();
+
+  Pipeline<TestContext> copy = *original;
+  original->removeHandler("first");
+  original.reset();
+
+  TestContext ctx;
+  copy.execute(ctx);
+  ASSERT_EQ(ctx.log.size(), 2u);
+  EXPECT_EQ(ctx.log[0], "A");
+  EXPECT_EQ(ctx.log[1], "B");
+}
+
+TEST(PipelineTest, StdFunctionNextStillAccepted) {
+  Pipeline<TestContext> pipeline;
+  pipeline.addHandler([](TestContext& ctx, std::function<void()> next) {
+    ctx.value = 1;
+    next();
+  });
+  pipeline.addHandler([](TestContext& ctx, auto) { ctx.value += 1; });
+
+  TestContext ctx;
+  pipeline.execute(ctx);
+  EXPECT_EQ(ctx.value, 2);
+}
+
+TEST(PipelineTest, StaticPipelineRunsInOrderAndShortCircuits) {
+  auto pipeline = makeStaticPipeline<TestContext>(
+      [](TestContext& ctx, auto next) {
+        ctx.log.push_back("A");
+        next();
+        ctx.log.push_back("A-after");
+      },
+      [](TestContext& ctx, auto next) {
+        ctx.log.push_back("B");
+        if (ctx.value == 0)
+          next();
+      },
+      [](TestContext& ctx, auto) { ctx.log.push_back("C"); });
+  static_assert(decltype(pipeline)::handlerCount() == 3);
+
+  TestContext ctx;
+  pipeline.execute(ctx);
+  EXPECT_EQ(ctx.log, (std::vector<std::string>{"A", "B", "C", "A-after"}));
+
+  TestContext blocked;
+  blocked.value = 1;
+  pipeline.execute(blocked);
+  EXPECT_EQ(blocked.log, (std::vector<std::string>{"A", "B", "A-after"}));
+}
+
+TEST(PipelineTest, StaticPipelineDoesNotAllocate) {
+  auto pipeline = makeStaticPipeline<TestContext>(
+      [](TestContext& ctx, auto next) {
+        ctx.value += 1;
+        next();
+      },
+      [](TestContext& ctx, auto next) {
+        ctx.value *= 3;
+        next();
+      });
+
+  TestContext ctx;
+  EXPECT_NO_ALLOCATIONS({ pipeline.execute(ctx); });
+  EXPECT_EQ(ctx.value, 3);
+}
@@ -1,9 +1,16 @@
 #include "fabric/core/Plugin.hh"
 #include "fabric/utils/Testing.hh"
 #include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace fabric;
 using namespace fabric::Testing;
@@ -38,6 +45,55 @@ public:
   bool shutdownCalled = false;
 };
 
+// Records init/shutdown order into a shared journal
+class DependentPlugin : public Plugin {
+public:
+  struct Journal {
+    std::mutex mutex;
+    std::vector<std::string> initialized;
+    std::vector<std::string> shutDown;
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+  };
+
+  DependentPlugin(std::string name, std::vector<std::string> deps, Journal& journal,
+                  bool result = true, std::chrono::milliseconds work = std::chrono::milliseconds(0))
+    : name(std::move(name)), deps(std::move(deps)), journal(journal), result(result), work(work) {}
+
+  std::string getName() const override { return name; }
+  std::string getVersion() const override { return "1.0.0"; }
+  std::string getAuthor() const override { return "Test Author"; }
+  std::string getDescription() const override { return "A plugin with dependencies"; }
+  std::vector<std::string> getDependencies() const override { return deps; }
+
+  bool initialize() override {
+    int now = ++journal.running;
+    int seen = journal.maxRunning.load();
+    while (now > seen && !journal.maxRunning.compare_exchange_weak(seen, now)) {
+    }
+    std::this_thread::sleep_for(work);
+    --journal.running;
+
+    std::lock_guard<std::mutex> lock(journal.mutex);
+    journal.initialized.push_back(name);
+    return result;
+  }
+
+  void shutdown() override {
+    std::lock_guard<std::mutex> lock(journal.mutex);
+    journal.shutDown.push_back(name);
+  }
+
+  std::vector<std::shared_ptr<Component>> getComponents() override { return {}; }
+
+private:
+  std::string name;
+  std::vector<std::string> deps;
+  Journal& journal;
+  bool result;
+  std::chrono::milliseconds work;
+};
+
 class PluginTest : public ::testing::Test {
 protected:
   void SetUp() override {
@@ -46,7 +102,20 @@ protected:
     });
   }
 
+  void addDependent(const std::string& name, std::vector<std::string> deps, bool result = true,
+                    std::chrono::milliseconds work = std::chrono::milliseconds(0)) {
+    manager.registerPlugin(name, [this, name, deps, result, work]() {
+      return std::make_shared<DependentPlugin>(name, deps, journal, result, work);
+    });
+    ASSERT_TRUE(manager.loadPlugin(name));
+  }
+
+  static size_t positionOf(const std::vector<std::string>& order, const std::string& name) {
+    return static_cast<size_t>(std::find(order.begin(), order.end(), name) - order.begin());
+  }
+
   PluginManager manager;
+  DependentPlugin::Journal journal;
 };
 
 TEST_F(PluginTest, RegisterPlugin) {
@@ -163,3 +232,86 @@ TEST_F(PluginTest, GetComponents) {
   EXPECT_EQ(components[0]->getId(), "component1");
   EXPECT_EQ(components[1]->getId(), "component2");
 }
+
+TEST_F(PluginTest, InitializeAllRespectsDependencies) {
+  addDependent("renderer", {"window", "assets"});
+  addDependent("window", {});
+  addDependent("assets", {"filesystem"});
+  addDependent("filesystem", {});
+
+  EXPECT_TRUE(manager.initializeAll());
+
+  const auto& order = journal.initialized;
+  ASSERT_EQ(order.size(), 4u);
+  EXPECT_LT(positionOf(order, "filesystem"), positionOf(order, "assets"));
+  EXPECT_LT(positionOf(order, "assets"), positionOf(order, "renderer"));
+  EXPECT_LT(positionOf(order, "window"), positionOf(order, "renderer"));
+}
+
+TEST_F(PluginTest, InitializeAllRunsIndependentPluginsConcurrently) {
+  addDependent("a", {}, true, std::chrono::milliseconds(50));
+  addDependent("b", {}, true, std::chrono::milliseconds(50));
+  addDependent("c", {}, true, std::chrono::milliseconds(50));
+  addDependent("d", {"a", "b", "c"});
+
+  Utils::ThreadPoolExecutor pool(3);
+  EXPECT_TRUE(manager.initializeAll(&pool));
+
+  EXPECT_GT(journal.maxRunning.load(), 1);
+  ASSERT_EQ(journal.initialized.size(), 4u);
+  EXPECT_EQ(journal.initialized.back(), "d");
+}
+
+TEST_F(PluginTest, InitializeAllSkipsDependentsOfFailures) {
+  addDependent("base", {}, false);
+  addDependent("child", {"base"});
+  addDependent("orphan", {"not-loaded"});
+  addDependent("independent", {});
+
+  EXPECT_FALSE(manager.initializeAll());
+  EXPECT_EQ(journal.initialized, (std::vector<std::string>{"base", "independent"}));
+
+  auto timings = manager.getInitTimings();
+  ASSERT_EQ(timings.size(), 4u);
+  for (const auto& timing : timings) {
+    if (timing.name == "child" || timing.name == "orphan") {
+      EXPECT_TRUE(timing.skipped) << timing.name;
+      EXPECT_FALSE(timing.success) << timing.name;
+    } else {
+      EXPECT_FALSE(timing.skipped) << timing.name;
+    }
+  }
+}
+
+TEST_F(PluginTest, InitializeAllRejectsCycles) {
+  addDependent("a", {"b"});
+  addDependent("b", {"a"});
+
+  EXPECT_FALSE(manager.initializeAll());
+  EXPECT_TRUE(journal.initialized.empty());
+}
+
+TEST_F(PluginTest, ShutdownAllReversesDependencyOrder) {
+  addDependent("app", {"core"});
+  addDependent("core", {});
+  addDependent("ui", {"app", "core"});
+
+  manager.shutdownAll();
+  EXPECT_EQ(journal.shutDown, (std::vector<std::string>{"ui", "app", "core"}));
+}
+
+TEST_F(PluginTest, InitTimingsReportEachPlugin) {
+  addDependent("first", {}, true, std::chrono::milliseconds(5));
+  addDependent("second", {"first"});
+
+  EXPECT_TRUE(manager.getInitTimings().empty());
+  EXPECT_TRUE(manager.initializeAll());
+
+  auto timings = manager.getInitTimings();
+  ASSERT_EQ(timings.size(), 2u);
+  EXPECT_EQ(timings[0].name, "first");
+  EXPECT_EQ(timings[1].name, "second");
+  EXPECT_TRUE(timings[0].success);
+  EXPECT_GE(timings[0].duration, std::chrono::milliseconds(5));
+  EXPECT_GE(timings[1].start, timings[0].start + timings[0].duration);
+}
@@ -2,6 +2,7 @@
 #include "fabric/utils/Testing.hh"
 #include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 
 using namespace fabric;
 
@@ -193,3 +194,52 @@ TEST_F(RenderingTest, TransformInterpolateMidpoint) {
     EXPECT_FLOAT_EQ(result.getScale().y, 2.0f);
     EXPECT_FLOAT_EQ(result.getScale().z, 2.0f);
 }
+
+// TransformBatch tests
+
+TEST_F(RenderingTest, TransformBatchMatchesInterpolator) {
+    const float half = 0.1f; // 11 degrees per step; nlerp drifts from slerp on wide arcs
+    PreviousTransform prev{{1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+    Position pos{5.0f, -2.0f, 7.0f};
+    Rotation rot{0.0f, std::sin(half), 0.0f, std::cos(half)};
+    Scale scl{2.0f, 1.0f, 0.5f};
+
+    Transform<float> a;
+    a.setPosition(Vector3<float, Space::World>(1.0f, 2.0f, 3.0f));
+    Transform<float> b;
+    b.setPosition(Vector3<float, Space::World>(5.0f, -2.0f, 7.0f));
+    b.setRotation(Quaternion<float>(rot.x, rot.y, rot.z, rot.w));
+    b.setScale(Vector3<float, Space::World>(2.0f, 1.0f, 0.5f));
+
+    TransformBatch batch;
+    std::vector<RenderTransform> out(3);
+    for (float alpha : {0.0f, 0.25f, 0.5f, 1.0f}) {
+        batch.resize(3);
+        for (size_t i = 0; i < 3; ++i) {
+            batch.setPrevious(i, prev);
+            batch.setCurrent(i, pos, rot, scl);
+        }
+        batch.interpolate(alpha, out);
+
+        auto expected = TransformInterpolator::interpolate(a, b, alpha).getMatrix().elements;
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 16; ++j)
+                EXPECT_TRUE(almostEq(out[i].matrix[j], expected[j], 1e-3f)) << "alpha " << alpha << " [" << j << "]";
+        }
+    }
+}
+
+TEST_F(RenderingTest, TransformBatchTakesShorterArc) {
+    // q and -q are the same rotation; blending toward -q must not swing through 360 degrees
+    PreviousTransform prev{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+    TransformBatch batch;
+    batch.resize(1);
+    batch.setPrevious(0, prev);
+    batch.setCurrent(0, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f, -1.0f}, {1.0f, 1.0f, 1.0f});
+
+    std::vector<RenderTransform> out(1);
+    batch.interpolate(0.5f, out);
+    RenderTransform identity;
+    for (size_t j = 0; j < 16; ++j)
+        EXPECT_TRUE(almostEq(out[0].matrix[j], identity.matrix[j]));
+}
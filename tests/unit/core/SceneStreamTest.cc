@@ -0,0 +1,126 @@
+#include "fabric/core/SceneStream.hh"
+#include "fabric/core/ECS.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+Scene makeScene() {
+    Scene scene;
+    SceneRecord root;
+    root.name = "root";
+    root.position = {1.0f, 2.0f, 3.0f};
+    scene.entities.push_back(root);
+
+    SceneRecord child;
+    child.name = "child";
+    child.parent = 0;
+    child.rotation = Quaternion<float>(0.0f, 0.7071f, 0.0f, 0.7071f);
+    child.scale = {2.0f, 2.0f, 2.0f};
+    scene.entities.push_back(child);
+    return scene;
+}
+
+std::vector<SceneRecord> streamAll(std::span<const uint8_t> bytes, JsonFormat format) {
+    std::vector<SceneRecord> records;
+    streamScene(bytes, format, [&](const SceneRecord& r) { records.push_back(r); });
+    return records;
+}
+
+std::vector<uint8_t> textBytes(const std::string& text) {
+    return {text.begin(), text.end()};
+}
+
+} // namespace
+
+TEST(SceneStreamTest, StreamMatchesDomInEveryFormat) {
+    Scene scene = makeScene();
+    for (auto format : {JsonFormat::Text, JsonFormat::MessagePack, JsonFormat::Cbor}) {
+        auto bytes = encodeJson(scene, format);
+        auto records = streamAll(bytes, format);
+        auto dom = decodeJson<Scene>(bytes, format);
+
+        ASSERT_EQ(records.size(), 2u);
+        ASSERT_EQ(dom.entities.size(), 2u);
+        for (size_t i = 0; i < records.size(); ++i) {
+            EXPECT_EQ(records[i].name, dom.entities[i].name);
+            EXPECT_EQ(records[i].parent, dom.entities[i].parent);
+            EXPECT_FLOAT_EQ(records[i].position.x, dom.entities[i].position.x);
+            EXPECT_FLOAT_EQ(records[i].rotation.y, dom.entities[i].rotation.y);
+            EXPECT_FLOAT_EQ(records[i].scale.z, dom.entities[i].scale.z);
+        }
+        EXPECT_EQ(records[1].parent, 0);
+        EXPECT_FLOAT_EQ(records[0].position.z, 3.0f);
+        EXPECT_FLOAT_EQ(records[1].rotation.w, 0.7071f);
+    }
+}
+
+TEST(SceneStreamTest, MissingFieldsKeepDefaults) {
+    auto records = streamAll(textBytes(R"({"entities": [{"position": {"x": 5}}]})"), JsonFormat::Text);
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_TRUE(records[0].name.empty());
+    EXPECT_EQ(records[0].parent, -1);
+    EXPECT_FLOAT_EQ(records[0].position.x, 5.0f);
+    EXPECT_FLOAT_EQ(records[0].position.y, 0.0f);
+    EXPECT_FLOAT_EQ(records[0].rotation.w, 1.0f);
+    EXPECT_FLOAT_EQ(records[0].scale.x, 1.0f);
+}
+
+TEST(SceneStreamTest, UnknownKeysAreSkipped) {
+    auto json = R"({
+        "version": 3,
+        "meta": {"entities": [{"name": "decoy"}]},
+        "entities": [
+            {"name": "a", "tags": ["x", {"name": "nested"}], "extra": {"position": {"x": 9}},
+             "position": {"x": 1, "q": 7, "y": 2, "z": 3}},
+            [1, 2, 3],
+            {"name": "b"}
+        ],
+        "trailer": {"name": "ignored"}
+    })";
+    auto records = streamAll(textBytes(json), JsonFormat::Text);
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].name, "a");
+    EXPECT_FLOAT_EQ(records[0].position.x, 1.0f);
+    EXPECT_FLOAT_EQ(records[0].position.y, 2.0f);
+    EXPECT_EQ(records[1].name, "b");
+}
+
+TEST(SceneStreamTest, TopLevelArrayIsEntityList) {
+    auto records = streamAll(textBytes(R"([{"name": "a"}, {"name": "b", "parent": 0}])"), JsonFormat::Text);
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[1].parent, 0);
+}
+
+TEST(SceneStreamTest, MalformedInputThrows) {
+    auto bytes = textBytes(R"({"entities": [{"name": "a"},)");
+    EXPECT_THROW(streamAll(bytes, JsonFormat::Text), FabricException);
+
+    auto binary = encodeJson(makeScene(), JsonFormat::MessagePack);
+    binary.resize(binary.size() - 4);
+    EXPECT_THROW(streamAll(binary, JsonFormat::MessagePack), FabricException);
+}
+
+TEST(SceneStreamTest, LoadSceneCreatesHierarchy) {
+    World world;
+    world.registerCoreComponents();
+
+    auto bytes = encodeJson(makeScene(), JsonFormat::Cbor);
+    EXPECT_EQ(loadScene(world, bytes, JsonFormat::Cbor), 2u);
+
+    auto root = world.get().lookup("root");
+    auto child = world.get().lookup("root::child");
+    ASSERT_TRUE(root.is_valid());
+    ASSERT_TRUE(child.is_valid());
+    EXPECT_EQ(child.parent(), root);
+    EXPECT_TRUE(child.has<SceneEntity>());
+    EXPECT_FLOAT_EQ(root.get<Position>().y, 2.0f);
+    EXPECT_FLOAT_EQ(child.get<Rotation>().y, 0.7071f);
+    EXPECT_FLOAT_EQ(child.get<Scale>().x, 2.0f);
+}
@@ -2,6 +2,7 @@
 #include "fabric/core/ECS.hh"
 #include "fabric/core/Rendering.hh"
 #include "fabric/core/Spatial.hh"
+#include "fabric/utils/AllocationTracker.hh"
 #include "fabric/utils/Testing.hh"
 #include <gtest/gtest.h>
 #include <bx/math.h>
@@ -34,6 +35,12 @@ protected:
         e.set<BoundingBox>({minX, minY, minZ, maxX, maxY, maxZ});
     }
 
+    // Helper: refresh WorldBounds as runFrame's Bounds phase would, then cull
+    std::vector<flecs::entity> cull(const float* viewProjection) {
+        ecsWorld.updateWorldBounds();
+        return FrustumCuller::cull(viewProjection, ecsWorld.get());
+    }
+
     // Helper: collect visible entity names
     std::unordered_set<std::string> visibleNames(
         const std::vector<flecs::entity>& entities) {
@@ -57,7 +64,7 @@ TEST_F(FrustumCullerTest, EntitiesWithoutBoundingBoxAlwaysVisible) {
     float vp[16];
     camera.getViewProjection(vp);
 
-    auto visible = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible = cull(vp);
 
     // Both entities have no BoundingBox, so both should be visible
     EXPECT_EQ(visible.size(), 2u);
@@ -77,7 +84,7 @@ TEST_F(FrustumCullerTest, EntityBehindCameraIsCulled) {
     float vp[16];
     camera.getViewProjection(vp);
 
-    auto visible = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible = cull(vp);
     auto names = visibleNames(visible);
 
     EXPECT_FALSE(names.count("behind"));
@@ -96,7 +103,7 @@ TEST_F(FrustumCullerTest, EntityInFrontOfCameraIsVisible) {
     float vp[16];
     camera.getViewProjection(vp);
 
-    auto visible = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible = cull(vp);
     auto names = visibleNames(visible);
 
     EXPECT_TRUE(names.count("front"));
@@ -114,7 +121,7 @@ TEST_F(FrustumCullerTest, EntityFarOutsideFrustumIsCulled) {
     float vp[16];
     camera.getViewProjection(vp);
 
-    auto visible = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible = cull(vp);
     auto names = visibleNames(visible);
 
     EXPECT_FALSE(names.count("far_right"));
@@ -136,7 +143,7 @@ TEST_F(FrustumCullerTest, FlatCullingDoesNotSkipChildren) {
     float vp[16];
     camera.getViewProjection(vp);
 
-    auto visible = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible = cull(vp);
     auto names = visibleNames(visible);
 
     EXPECT_FALSE(names.count("outside_parent"));
@@ -164,7 +171,7 @@ TEST_F(FrustumCullerTest, MixedVisibility) {
     float vp[16];
     camera.getViewProjection(vp);
 
-    auto visibleNodes = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visibleNodes = cull(vp);
     auto names = visibleNames(visibleNodes);
 
     EXPECT_TRUE(names.count("visible_1"));
@@ -183,7 +190,7 @@ TEST_F(FrustumCullerTest, OrthoFrustumCull) {
     auto outside = createEntity("outside");
     setBoundingBox(outside, 20.0f, 20.0f, 1.0f, 30.0f, 30.0f, 5.0f);
 
-    auto visible = FrustumCuller::cull(ortho.elements.data(), ecsWorld.get());
+    auto visible = cull(ortho.elements.data());
     auto names = visibleNames(visible);
 
     EXPECT_TRUE(names.count("inside"));
@@ -206,7 +213,7 @@ TEST_F(FrustumCullerTest, CameraMovementChangesVisibleSet) {
 
     float vp[16];
     camera.getViewProjection(vp);
-    auto visible1 = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible1 = cull(vp);
     auto names1 = visibleNames(visible1);
     EXPECT_FALSE(names1.count("left"));
     EXPECT_FALSE(names1.count("right"));
@@ -215,7 +222,7 @@ TEST_F(FrustumCullerTest, CameraMovementChangesVisibleSet) {
     camTransform.setPosition(Vec3f(-45.0f, 0.0f, 0.0f));
     camera.updateView(camTransform);
     camera.getViewProjection(vp);
-    auto visible2 = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible2 = cull(vp);
     auto names2 = visibleNames(visible2);
     EXPECT_TRUE(names2.count("left"));
     EXPECT_FALSE(names2.count("right"));
@@ -240,7 +247,7 @@ TEST_F(FrustumCullerTest, MultipleCamerasOnDifferentViews) {
 
     float vpA[16];
     cameraA.getViewProjection(vpA);
-    auto visibleA = FrustumCuller::cull(vpA, ecsWorld.get());
+    auto visibleA = cull(vpA);
     auto namesA = visibleNames(visibleA);
     EXPECT_TRUE(namesA.count("near_center"));
     EXPECT_FALSE(namesA.count("far_right"));
@@ -252,7 +259,7 @@ TEST_F(FrustumCullerTest, MultipleCamerasOnDifferentViews) {
 
     float vpB[16];
     cameraB.getViewProjection(vpB);
-    auto visibleB = FrustumCuller::cull(vpB, ecsWorld.get());
+    auto visibleB = cull(vpB);
     auto namesB = visibleNames(visibleB);
     EXPECT_FALSE(namesB.count("near_center"));
     EXPECT_TRUE(namesB.count("far_right"));
@@ -274,7 +281,7 @@ TEST_F(FrustumCullerTest, OnlySceneEntitiesCulled) {
 
     float vp[16];
     camera.getViewProjection(vp);
-    auto visible = FrustumCuller::cull(vp, ecsWorld.get());
+    auto visible = cull(vp);
     auto names = visibleNames(visible);
 
     EXPECT_TRUE(names.count("scene_entity"));
@@ -301,3 +308,64 @@ TEST(BoundingBoxComponentTest, SetAndGetBoundingBox) {
     EXPECT_FLOAT_EQ(bb->minX, -1.0f);
     EXPECT_FLOAT_EQ(bb->maxX, 1.0f);
 }
+
+TEST_F(FrustumCullerTest, CullIntoReservedVectorDoesNotAllocate) {
+    Camera camera;
+    camera.setPerspective(60.0f, 16.0f / 9.0f, 0.1f, 100.0f, true);
+    Transform<float> camTransform;
+    camera.updateView(camTransform);
+
+    createEntity("entity_a");
+    createEntity("entity_b");
+
+    float vp[16];
+    camera.getViewProjection(vp);
+
+    ecsWorld.updateWorldBounds();
+    std::vector<flecs::entity> visible;
+    FrustumCuller::cull(vp, ecsWorld.get(), visible);
+    ASSERT_EQ(visible.size(), 2u);
+
+    // Flecs' own allocations go through its C allocator and aren't counted
+    EXPECT_NO_ALLOCATIONS({ FrustumCuller::cull(vp, ecsWorld.get(), visible); });
+    EXPECT_EQ(visible.size(), 2u);
+}
+
+TEST_F(FrustumCullerTest, MovedEntityIsCulledOnceBoundsRefresh) {
+    Camera camera;
+    camera.setPerspective(60.0f, 1.0f, 0.1f, 100.0f, true);
+    Transform<float> camTransform;
+    camera.updateView(camTransform);
+
+    auto mover = createEntity("mover");
+    setBoundingBox(mover, -1.0f, -1.0f, 5.0f, 1.0f, 1.0f, 10.0f);
+
+    float vp[16];
+    camera.getViewProjection(vp);
+    EXPECT_TRUE(visibleNames(cull(vp)).count("mover"));
+
+    // Translate far to the side through LocalToWorld only
+    mover.set<LocalToWorld>({{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 500, 0, 0, 1}});
+
+    // Culling alone tests the bounds from the last refresh
+    EXPECT_TRUE(visibleNames(FrustumCuller::cull(vp, ecsWorld.get())).count("mover"));
+    EXPECT_FALSE(visibleNames(cull(vp)).count("mover"));
+}
+
+TEST_F(FrustumCullerTest, RemovingBoundingBoxMakesEntityVisible) {
+    Camera camera;
+    camera.setPerspective(60.0f, 1.0f, 0.1f, 100.0f, true);
+    Transform<float> camTransform;
+    camera.updateView(camTransform);
+
+    auto e = createEntity("unbounded");
+    setBoundingBox(e, 500.0f, 0.0f, 5.0f, 510.0f, 1.0f, 10.0f);
+
+    float vp[16];
+    camera.getViewProjection(vp);
+    EXPECT_FALSE(visibleNames(cull(vp)).count("unbounded"));
+
+    // The stale WorldBounds stays behind, but without a BoundingBox the entity is unbounded
+    e.remove<BoundingBox>();
+    EXPECT_TRUE(visibleNames(cull(vp)).count("unbounded"));
+}
@@ -0,0 +1,152 @@
+#include "fabric/core/Startup.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+struct Journal {
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    void record(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(name);
+    }
+
+    size_t positionOf(const std::string& name) {
+        return static_cast<size_t>(std::find(order.begin(), order.end(), name) - order.begin());
+    }
+
+    // Tracks how many phases overlap while sleeping for `work`
+    void busy(std::chrono::milliseconds work) {
+        int now = ++running;
+        int seen = maxRunning.load();
+        while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(work);
+        --running;
+    }
+};
+
+} // namespace
+
+TEST(StartupTest, RunsPhasesAfterTheirDependencies) {
+    Startup startup(2);
+    Journal journal;
+    startup.addPhase("render", {"window", "shaders"}, [&] { journal.record("render"); }, StartupThread::Main);
+    startup.addPhase("window", {}, [&] { journal.record("window"); }, StartupThread::Main);
+    startup.addPhase("shaders", {"index"}, [&] { journal.record("shaders"); });
+    startup.addPhase("index", {}, [&] { journal.record("index"); });
+
+    startup.run();
+
+    ASSERT_EQ(journal.order.size(), 4u);
+    EXPECT_LT(journal.positionOf("index"), journal.positionOf("shaders"));
+    EXPECT_LT(journal.positionOf("shaders"), journal.positionOf("render"));
+    EXPECT_LT(journal.positionOf("window"), journal.positionOf("render"));
+}
+
+TEST(StartupTest, MainPhasesRunOnCallingThread) {
+    Startup startup(2);
+    auto caller = std::this_thread::get_id();
+    std::thread::id mainPhaseThread;
+    startup.addPhase("main", {}, [&] { mainPhaseThread = std::this_thread::get_id(); }, StartupThread::Main);
+    startup.addPhase("worker", {}, [] {});
+
+    startup.run();
+    EXPECT_EQ(mainPhaseThread, caller);
+}
+
+TEST(StartupTest, WorkerPhasesOverlapMainPhases) {
+    Startup startup(2);
+    Journal journal;
+    auto work = std::chrono::milliseconds(40);
+    startup.addPhase("window", {}, [&] { journal.busy(work); }, StartupThread::Main);
+    startup.addPhase("fonts", {}, [&] { journal.busy(work); });
+    startup.addPhase("index", {}, [&] { journal.busy(work); });
+
+    startup.run();
+    EXPECT_GT(journal.maxRunning.load(), 1);
+}
+
+TEST(StartupTest, ZeroWorkersRunsEverythingInline) {
+    Startup startup(0);
+    auto caller = std::this_thread::get_id();
+    bool allOnCaller = true;
+    for (const char* name : {"a", "b", "c"}) {
+        startup.addPhase(name, {}, [&] { allOnCaller = allOnCaller && std::this_thread::get_id() == caller; });
+    }
+
+    startup.run();
+    EXPECT_TRUE(allOnCaller);
+    EXPECT_EQ(startup.timeline().size(), 3u);
+}
+
+TEST(StartupTest, FailureSkipsDependentsAndRethrows) {
+    Startup startup(2);
+    Journal journal;
+    startup.addPhase("gpu", {}, [] { throw std::runtime_error("no device"); }, StartupThread::Main);
+    startup.addPhase("shaders", {"gpu"}, [&] { journal.record("shaders"); });
+    startup.addPhase("audio", {}, [&] { journal.record("audio"); });
+
+    EXPECT_THROW(startup.run(), std::runtime_error);
+    EXPECT_EQ(journal.order, std::vector<std::string>{"audio"});
+
+    auto timeline = startup.timeline();
+    ASSERT_EQ(timeline.size(), 3u);
+    for (const auto& phase : timeline) {
+        EXPECT_EQ(phase.success, phase.name == "audio") << phase.name;
+        EXPECT_EQ(phase.skipped, phase.name == "shaders") << phase.name;
+    }
+}
+
+TEST(StartupTest, RejectsInvalidGraphs) {
+    Startup duplicate;
+    duplicate.addPhase("a", {}, [] {});
+    EXPECT_THROW(duplicate.addPhase("a", {}, [] {}), FabricException);
+
+    Startup unknown;
+    bool ran = false;
+    unknown.addPhase("a", {"missing"}, [&] { ran = true; });
+    EXPECT_THROW(unknown.run(), FabricException);
+
+    Startup cycle;
+    cycle.addPhase("a", {"b"}, [&] { ran = true; });
+    cycle.addPhase("b", {"a"}, [&] { ran = true; });
+    EXPECT_THROW(cycle.run(), FabricException);
+    EXPECT_FALSE(ran);
+}
+
+TEST(StartupTest, TimelineAndFirstFrame) {
+    Startup startup(1);
+    startup.addPhase("slow", {}, [] { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+    startup.addPhase("after", {"slow"}, [] {}, StartupThread::Main);
+    startup.run();
+
+    auto timeline = startup.timeline();
+    ASSERT_EQ(timeline.size(), 2u);
+    EXPECT_EQ(timeline[0].name, "slow");
+    EXPECT_EQ(timeline[0].thread, StartupThread::Worker);
+    EXPECT_GE(timeline[0].duration, std::chrono::milliseconds(5));
+    EXPECT_GE(timeline[1].start, timeline[0].start + timeline[0].duration);
+
+    EXPECT_EQ(startup.timeToFirstFrame().count(), 0);
+    startup.markFirstFrame();
+    auto firstFrame = startup.timeToFirstFrame();
+    EXPECT_GE(firstFrame, timeline[1].start);
+    startup.markFirstFrame();
+    EXPECT_EQ(startup.timeToFirstFrame(), firstFrame);
+}
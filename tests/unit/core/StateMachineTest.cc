@@ -181,3 +181,96 @@ TEST_F(StateMachineTest, MultipleHooksOnSameState) {
   EXPECT_EQ(hook1, 1);
   EXPECT_EQ(hook2, 1);
 }
+
+// Compile-time transition tables
+
+inline constexpr TransitionTable<ConnectionState, 5> kConnectionTransitions{
+  {ConnectionState::Disconnected, ConnectionState::Connecting},
+  {ConnectionState::Connecting, ConnectionState::Connected},
+  {ConnectionState::Connected, ConnectionState::Draining},
+  {ConnectionState::Draining, ConnectionState::Closed},
+  {ConnectionState::Connected, ConnectionState::Closed},
+  {ConnectionState::Disconnected, ConnectionState::Closed},
+};
+
+using FixedConnection = FixedStateMachine<kConnectionTransitions>;
+
+static_assert(kConnectionTransitions.allows(ConnectionState::Connecting, ConnectionState::Connected));
+static_assert(!kConnectionTransitions.allows(ConnectionState::Closed, ConnectionState::Disconnected));
+static_assert(kConnectionTransitions.allows(ConnectionState::Closed, ConnectionState::Closed));
+static_assert(std::is_trivially_copyable_v<FixedConnection>);
+
+TEST(FixedStateMachineTest, MatchesRuntimeStateMachine) {
+  StateMachine<ConnectionState> runtime(ConnectionState::Disconnected, connectionStateToString);
+  runtime.addTransition(ConnectionState::Disconnected, ConnectionState::Connecting);
+  runtime.addTransition(ConnectionState::Connecting, ConnectionState::Connected);
+  runtime.addTransition(ConnectionState::Connected, ConnectionState::Draining);
+  runtime.addTransition(ConnectionState::Draining, ConnectionState::Closed);
+  runtime.addTransition(ConnectionState::Connected, ConnectionState::Closed);
+  runtime.addTransition(ConnectionState::Disconnected, ConnectionState::Closed);
+
+  for (int from = 0; from < 5; ++from) {
+    for (int to = 0; to < 5; ++to) {
+      auto f = static_cast<ConnectionState>(from);
+      auto t = static_cast<ConnectionState>(to);
+      EXPECT_EQ(kConnectionTransitions.allows(f, t), runtime.isValidTransition(f, t)) << from << " -> " << to;
+    }
+  }
+}
+
+TEST(FixedStateMachineTest, TryTransitionTracksPrevious) {
+  FixedConnection machine(ConnectionState::Disconnected);
+  EXPECT_FALSE(machine.tryTransition(ConnectionState::Connected));
+  EXPECT_EQ(machine.state, ConnectionState::Disconnected);
+
+  EXPECT_TRUE(machine.tryTransition(ConnectionState::Connecting));
+  EXPECT_EQ(machine.state, ConnectionState::Connecting);
+  EXPECT_EQ(machine.previous, ConnectionState::Disconnected);
+
+  // Self-transition succeeds and keeps previous
+  EXPECT_TRUE(machine.tryTransition(ConnectionState::Connecting));
+  EXPECT_EQ(machine.previous, ConnectionState::Disconnected);
+
+  EXPECT_THROW(machine.setState(ConnectionState::Draining), FabricException);
+}
+
+TEST(FixedStateMachineTest, HooksFireWithContext) {
+  StateHookTable<ConnectionState, 5, int> hooks;
+  std::vector<int> entered;
+  int transitions = 0;
+  hooks.onEnter(ConnectionState::Connected, [&](ConnectionState, ConnectionState, int id) { entered.push_back(id); });
+  hooks.onTransition(ConnectionState::Connecting, ConnectionState::Connected,
+                     [&](ConnectionState from, ConnectionState to, int) {
+                       EXPECT_EQ(from, ConnectionState::Connecting);
+                       EXPECT_EQ(to, ConnectionState::Connected);
+                       ++transitions;
+                     });
+  EXPECT_THROW(hooks.onEnter(ConnectionState::Closed, nullptr), FabricException);
+
+  FixedConnection a(ConnectionState::Connecting);
+  FixedConnection b(ConnectionState::Connecting);
+  EXPECT_TRUE(a.tryTransition(ConnectionState::Connected, hooks, 7));
+  EXPECT_TRUE(b.tryTransition(ConnectionState::Connected, hooks, 9));
+  // Self-transition and rejected transition fire nothing
+  EXPECT_TRUE(b.tryTransition(ConnectionState::Connected, hooks, 9));
+  EXPECT_FALSE(b.tryTransition(ConnectionState::Disconnected, hooks, 9));
+
+  EXPECT_EQ(entered, (std::vector<int>{7, 9}));
+  EXPECT_EQ(transitions, 2);
+}
+
+TEST(FixedStateMachineTest, BatchApplyTransitions) {
+  std::vector<FixedConnection> machines(4, FixedConnection(ConnectionState::Disconnected));
+  std::vector<ConnectionState> targets = {ConnectionState::Connecting, ConnectionState::Connected,
+                                          ConnectionState::Closed, ConnectionState::Disconnected};
+
+  size_t changed = applyTransitions<kConnectionTransitions>(machines, targets);
+  EXPECT_EQ(changed, 2u);
+  EXPECT_EQ(machines[0].state, ConnectionState::Connecting);
+  EXPECT_EQ(machines[1].state, ConnectionState::Disconnected);
+  EXPECT_EQ(machines[2].state, ConnectionState::Closed);
+  EXPECT_EQ(machines[3].state, ConnectionState::Disconnected);
+
+  targets.pop_back();
+  EXPECT_THROW(applyTransitions<kConnectionTransitions>(machines, targets), FabricException);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "fabric/core/TextureLoader.hh"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace fabric;
+
+namespace {
+
+// Binary PPM (P6), one of the formats stb_image decodes
+std::string writePpm(const std::string& name, int width, int height, uint8_t value) {
+    auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path, std::ios::binary);
+    out << "P6\n" << width << " " << height << "\n255\n";
+    std::string pixels(static_cast<size_t>(width * height * 3), static_cast<char>(value));
+    out.write(pixels.data(), static_cast<std::streamsize>(pixels.size()));
+    return path;
+}
+
+} // namespace
+
+TEST(TextureLoaderTest, MipCountAndImageSize) {
+    EXPECT_EQ(TextureLoader::mipCount(1, 1), 1);
+    EXPECT_EQ(TextureLoader::mipCount(4, 4), 3);
+    EXPECT_EQ(TextureLoader::mipCount(8, 2), 4);
+
+    EXPECT_EQ(TextureLoader::imageSize(4, 4, false), 64u);
+    // 4x4 + 2x2 + 1x1
+    EXPECT_EQ(TextureLoader::imageSize(4, 4, true), (16u + 4u + 1u) * 4u);
+    // 8x2 + 4x1 + 2x1 + 1x1
+    EXPECT_EQ(TextureLoader::imageSize(8, 2, true), (16u + 4u + 2u + 1u) * 4u);
+}
+
+TEST(TextureLoaderTest, BuildMipChainAveragesQuads) {
+    std::vector<uint8_t> data(TextureLoader::imageSize(2, 2, true), 0);
+    const uint8_t level0[] = {0, 0, 0, 255, 100, 100, 100, 255, 200, 200, 200, 255, 100, 100, 100, 255};
+    std::copy(std::begin(level0), std::end(level0), data.begin());
+
+    TextureLoader::buildMipChain(data.data(), 2, 2);
+
+    EXPECT_EQ(data[16], 100);
+    EXPECT_EQ(data[17], 100);
+    EXPECT_EQ(data[18], 100);
+    EXPECT_EQ(data[19], 255);
+}
+
+TEST(TextureLoaderTest, BuildMipChainHandlesOddSizes) {
+    std::vector<uint8_t> data(TextureLoader::imageSize(3, 1, true), 0);
+    for (size_t i = 0; i < 12; ++i) {
+        data[i] = 80;
+    }
+
+    TextureLoader::buildMipChain(data.data(), 3, 1);
+
+    // Levels 1x1 twice over; a uniform image stays uniform
+    for (size_t i = 12; i < data.size(); ++i) {
+        EXPECT_EQ(data[i], 80);
+    }
+}
+
+TEST(TextureLoaderTest, DecodeFileUsesPoolSlot) {
+    auto path = writePpm("fabric_texture_loader_pool.ppm", 4, 4, 50);
+    BufferPool pool(1024, 1);
+
+    auto image = TextureLoader::decodeFile(path, true, &pool);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_TRUE(image->pooled());
+    EXPECT_EQ(image->width, 4u);
+    EXPECT_EQ(image->height, 4u);
+    EXPECT_EQ(image->mipCount, 3);
+    EXPECT_EQ(image->size, TextureLoader::imageSize(4, 4, true));
+    EXPECT_EQ(image->data()[0], 50);
+    EXPECT_EQ(image->data()[3], 255);
+    EXPECT_EQ(pool.available(), 0u);
+
+    image.reset();
+    EXPECT_EQ(pool.available(), 1u);
+    std::filesystem::remove(path);
+}
+
+TEST(TextureLoaderTest, DecodeFileFallsBackToHeap) {
+    auto path = writePpm("fabric_texture_loader_heap.ppm", 16, 16, 10);
+    BufferPool pool(64, 1);
+
+    auto image = TextureLoader::decodeFile(path, false, &pool);
+    ASSERT_TRUE(image.has_value());
+    EXPECT_FALSE(image->pooled());
+    EXPECT_EQ(image->size, 16u * 16u * 4u);
+    EXPECT_EQ(pool.available(), 1u);
+    std::filesystem::remove(path);
+}
+
+TEST(TextureLoaderTest, DecodeFileMissingReturnsNullopt) {
+    EXPECT_FALSE(TextureLoader::decodeFile("/nonexistent/path/image.png", false, nullptr).has_value());
+}
+
+TEST(TextureLoaderTest, RequestMissingFileFails) {
+    TextureLoader loader;
+    auto id = loader.request("/nonexistent/path/image.png");
+    EXPECT_NE(id, kInvalidTextureId);
+    EXPECT_EQ(loader.state(id), TextureLoadState::Failed);
+    EXPECT_EQ(loader.pendingCount(), 0u);
+    loader.release(id);
+    EXPECT_EQ(loader.liveCount(), 0u);
+}
+
+TEST(TextureLoaderTest, CacheSharesUnchangedFile) {
+    auto path = writePpm("fabric_texture_loader_cache.ppm", 2, 2, 0);
+    TextureLoader loader;
+
+    auto a = loader.request(path);
+    auto b = loader.request(path);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(loader.cacheHits(), 1u);
+    EXPECT_EQ(loader.liveCount(), 1u);
+    EXPECT_EQ(loader.state(a), TextureLoadState::Pending);
+
+    loader.release(a);
+    EXPECT_EQ(loader.liveCount(), 1u);
+    loader.release(b);
+    EXPECT_EQ(loader.liveCount(), 0u);
+    EXPECT_EQ(loader.pendingCount(), 0u);
+    std::filesystem::remove(path);
+}
+
+TEST(TextureLoaderTest, CacheKeepsMipSettingsApart) {
+    auto path = writePpm("fabric_texture_loader_mips.ppm", 4, 4, 0);
+    TextureLoader loader;
+
+    auto plain = loader.request(path);
+    auto mipped = loader.request(path, true);
+    EXPECT_NE(plain, mipped);
+    EXPECT_EQ(loader.cacheHits(), 0u);
+
+    EXPECT_EQ(loader.request(path, true), mipped);
+    EXPECT_EQ(loader.request(path), plain);
+    EXPECT_EQ(loader.cacheHits(), 2u);
+
+    // Dropping one variant leaves the other cached
+    loader.release(plain);
+    loader.release(plain);
+    EXPECT_EQ(loader.request(path, true), mipped);
+    EXPECT_EQ(loader.cacheHits(), 3u);
+
+    for (int i = 0; i < 3; ++i)
+        loader.release(mipped);
+    EXPECT_EQ(loader.liveCount(), 0u);
+    std::filesystem::remove(path);
+}
+
+TEST(TextureLoaderTest, CacheMissesAfterModification) {
+    auto path = writePpm("fabric_texture_loader_mtime.ppm", 2, 2, 0);
+    TextureLoader loader;
+
+    auto a = loader.request(path);
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(5));
+    auto b = loader.request(path);
+
+    EXPECT_NE(a, b);
+    EXPECT_EQ(loader.cacheHits(), 0u);
+    EXPECT_EQ(loader.liveCount(), 2u);
+
+    loader.release(a);
+    loader.release(b);
+    std::filesystem::remove(path);
+}
+
+TEST(TextureLoaderTest, DecodesOnWorkerThread) {
+    auto path = writePpm("fabric_texture_loader_worker.ppm", 8, 8, 0);
+    TextureLoaderConfig config;
+    config.slotSize = 1024;
+    config.slotCount = 2;
+    TextureLoader loader(config);
+
+    auto id = loader.request(path);
+    for (int i = 0; i < 200 && loader.pooledDecodes() == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(loader.pooledDecodes(), 1u);
+    EXPECT_EQ(loader.heapDecodes(), 0u);
+
+    // Upload has not run yet, so the placeholder is still in use
+    EXPECT_EQ(loader.state(id), TextureLoadState::Pending);
+    EXPECT_EQ(loader.handle(id).idx, loader.placeholder().idx);
+
+    loader.release(id);
+    std::filesystem::remove(path);
+}
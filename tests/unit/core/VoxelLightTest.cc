@@ -0,0 +1,281 @@
+#include "fabric/core/VoxelLight.hh"
+#include "fabric/core/VoxelMesher.hh"
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+using namespace fabric;
+using Essence = Vector4<float, Space::World>;
+
+class VoxelLightTest : public ::testing::Test {
+  protected:
+    ChunkedGrid<float> density;
+
+    void fillBox(int x0, int y0, int z0, int x1, int y1, int z1, float value) {
+        for (int z = z0; z <= z1; ++z)
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x)
+                    density.set(x, y, z, value);
+    }
+
+    // Floor at y = 0 and a roof over x < 16 at y = 20 in chunk (0, 0, 0)
+    void buildShelter() {
+        fillBox(0, 0, 0, 31, 0, 31, 1.0f);
+        fillBox(0, 20, 0, 15, 20, 31, 1.0f);
+    }
+
+    void addChunks(VoxelLighting& lighting, int nx, int ny, int nz) {
+        for (int cz = 0; cz < nz; ++cz)
+            for (int cy = 0; cy < ny; ++cy)
+                for (int cx = 0; cx < nx; ++cx)
+                    lighting.addChunk(cx, cy, cz);
+    }
+
+    static void expectSameLight(const VoxelLighting& a, const VoxelLighting& b) {
+        ASSERT_EQ(a.light().chunkCount(), b.light().chunkCount());
+        for (auto [cx, cy, cz] : a.light().activeChunks()) {
+            const uint8_t* lhs = a.light().chunkData(cx, cy, cz);
+            const uint8_t* rhs = b.light().chunkData(cx, cy, cz);
+            ASSERT_NE(rhs, nullptr);
+            for (int i = 0; i < kChunkVolume; ++i) {
+                ASSERT_EQ(lhs[i], rhs[i]) << "chunk " << cx << "," << cy << "," << cz << " cell " << i;
+            }
+        }
+    }
+};
+
+TEST_F(VoxelLightTest, SkyLightFallsAndSpreadsUnderRoof) {
+    buildShelter();
+    VoxelLighting lighting(density);
+    lighting.addChunk(0, 0, 0);
+    auto changed = lighting.propagate();
+
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(skyLight(lighting.lightAt(20, 1, 4)), 15);  // Open column reaches the floor
+    EXPECT_EQ(skyLight(lighting.lightAt(4, 25, 4)), 15);  // Above the roof
+    EXPECT_EQ(skyLight(lighting.lightAt(15, 19, 4)), 14); // One step in from the opening
+    EXPECT_EQ(skyLight(lighting.lightAt(4, 10, 4)), 3);   // Twelve steps in
+    EXPECT_EQ(lighting.lightAt(4, 20, 4), 0);             // Roof is opaque
+    EXPECT_EQ(blockLight(lighting.lightAt(20, 1, 4)), 0);
+    EXPECT_FALSE(lighting.hasPendingWork());
+}
+
+TEST_F(VoxelLightTest, BlockLightCrossesChunkFaces) {
+    VoxelLighting lighting(density);
+    addChunks(lighting, 2, 1, 1);
+    lighting.setEmitter(30, 5, 5, 14);
+    lighting.propagate();
+
+    EXPECT_EQ(blockLight(lighting.lightAt(30, 5, 5)), 14);
+    EXPECT_EQ(blockLight(lighting.lightAt(33, 5, 5)), 11);
+    EXPECT_EQ(blockLight(lighting.lightAt(30, 5, 9)), 10);
+    EXPECT_EQ(blockLight(lighting.lightAt(50, 5, 5)), 0);
+    EXPECT_EQ(skyLight(lighting.lightAt(33, 5, 5)), 15);
+
+    lighting.setEmitter(30, 5, 5, 0);
+    lighting.propagate();
+    for (int x = 20; x < 45; ++x)
+        EXPECT_EQ(blockLight(lighting.lightAt(x, 5, 5)), 0) << x;
+}
+
+TEST_F(VoxelLightTest, EditTouchesOnlyAffectedRegion) {
+    fillBox(0, 0, 0, 95, 0, 95, 1.0f);
+    VoxelLighting lighting(density);
+    addChunks(lighting, 3, 1, 3);
+    lighting.propagate();
+    size_t fullCells = lighting.lastChangedCells();
+
+    density.set(48, 10, 48, 1.0f);
+    lighting.voxelChanged(48, 10, 48);
+    auto changed = lighting.propagate();
+
+    EXPECT_EQ(skyLight(lighting.lightAt(48, 10, 48)), 0);
+    EXPECT_EQ(skyLight(lighting.lightAt(48, 9, 48)), 14); // Relit from the side
+    EXPECT_EQ(skyLight(lighting.lightAt(47, 9, 48)), 15);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], (ChunkCoord{1, 0, 1}));
+    EXPECT_LT(lighting.lastChangedCells(), 64u);
+    EXPECT_LT(lighting.lastChangedCells() * 1000, fullCells);
+
+    density.set(48, 10, 48, 0.0f);
+    lighting.voxelChanged(48, 10, 48);
+    lighting.propagate();
+    EXPECT_EQ(skyLight(lighting.lightAt(48, 9, 48)), 15);
+    EXPECT_LT(lighting.lastChangedCells(), 64u);
+}
+
+TEST_F(VoxelLightTest, IncrementalEditsMatchFullRecompute) {
+    fillBox(0, 0, 0, 63, 2, 63, 1.0f);
+    VoxelLighting incremental(density);
+    addChunks(incremental, 2, 2, 2);
+    incremental.setEmitter(10, 5, 10, 15);
+    incremental.propagate();
+
+    // Scatter blocks and lights with a fixed LCG, propagating in small batches
+    uint32_t seed = 12345;
+    auto next = [&seed](int range) {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<int>((seed >> 8) % static_cast<uint32_t>(range));
+    };
+    std::vector<std::tuple<int, int, int, uint8_t>> emitters;
+    for (int edit = 0; edit < 300; ++edit) {
+        int x = next(64);
+        int y = next(40);
+        int z = next(64);
+        if (edit % 25 == 0) {
+            auto level = static_cast<uint8_t>(next(16));
+            incremental.setEmitter(x, y, z, level);
+        } else {
+            density.set(x, y, z, density.get(x, y, z) > 0.5f ? 0.0f : 1.0f);
+            incremental.voxelChanged(x, y, z);
+        }
+        if (edit % 7 == 0)
+            incremental.propagate();
+    }
+    incremental.propagate();
+
+    VoxelLighting full(density);
+    for (auto [cx, cy, cz] : incremental.light().activeChunks()) {
+        for (int z = 0; z < kChunkSize; ++z)
+            for (int y = 0; y < kChunkSize; ++y)
+                for (int x = 0; x < kChunkSize; ++x) {
+                    int wx = cx * kChunkSize + x;
+                    int wy = cy * kChunkSize + y;
+                    int wz = cz * kChunkSize + z;
+                    if (uint8_t level = incremental.emitterAt(wx, wy, wz))
+                        full.setEmitter(wx, wy, wz, level);
+                }
+    }
+    addChunks(full, 2, 2, 2);
+    full.propagate();
+
+    expectSameLight(incremental, full);
+}
+
+TEST_F(VoxelLightTest, WorkerPoolMatchesSerial) {
+    buildShelter();
+    fillBox(40, 0, 0, 40, 50, 63, 1.0f);
+    Utils::ThreadPoolExecutor pool(4);
+
+    VoxelLighting serial(density);
+    VoxelLighting parallel(density, 0.5f, &pool);
+    for (auto* lighting : {&serial, &parallel}) {
+        addChunks(*lighting, 2, 2, 2);
+        lighting->setEmitter(20, 10, 20, 15);
+        lighting->setEmitter(45, 40, 30, 12);
+        lighting->propagate();
+    }
+    expectSameLight(serial, parallel);
+
+    density.set(31, 10, 20, 1.0f);
+    for (auto* lighting : {&serial, &parallel}) {
+        lighting->voxelChanged(31, 10, 20);
+        lighting->propagate();
+    }
+    expectSameLight(serial, parallel);
+}
+
+TEST_F(VoxelLightTest, RemovingChunkTakesItsLightAlong) {
+    VoxelLighting lighting(density);
+    addChunks(lighting, 2, 2, 1);
+    lighting.setEmitter(30, 5, 5, 15);
+    lighting.propagate();
+    ASSERT_EQ(blockLight(lighting.lightAt(34, 5, 5)), 11);
+    ASSERT_EQ(skyLight(lighting.lightAt(34, 5, 5)), 15);
+
+    lighting.removeChunk(0, 0, 0);
+    lighting.removeChunk(1, 1, 0);
+    lighting.propagate();
+
+    EXPECT_FALSE(lighting.light().hasChunk(0, 0, 0));
+    EXPECT_EQ(blockLight(lighting.lightAt(34, 5, 5)), 0);
+    EXPECT_EQ(skyLight(lighting.lightAt(34, 5, 5)), 15); // Open sky again above (1, 0, 0)
+}
+
+TEST_F(VoxelLightTest, MesherCarriesVertexLight) {
+    // The shelter carries on through the chunks either side along Z, so
+    // corners on those borders are shaded rather than taken as open sky
+    buildShelter();
+    fillBox(0, 0, -32, 31, 0, 63, 1.0f);
+    fillBox(0, 20, -32, 15, 20, 63, 1.0f);
+    ChunkedGrid<Essence> essence;
+    VoxelLighting lighting(density);
+    for (int cz = -1; cz <= 1; ++cz)
+        lighting.addChunk(0, 0, cz);
+    lighting.propagate();
+
+    auto unlit = VoxelMesher::meshChunkData(0, 0, 0, density, essence);
+    auto lit = VoxelMesher::meshChunkData(0, 0, 0, density, essence, 0.5f, &lighting.light());
+
+    for (const auto& v : unlit.vertices) {
+        EXPECT_EQ(v.skyLight(), 15);
+        EXPECT_EQ(v.blockLight(), 0);
+    }
+
+    // Floor tops: full sky in the open, darker deep under the roof
+    bool open = false;
+    bool shaded = false;
+    for (const auto& v : lit.vertices) {
+        if (v.normalIndex() != 2 || v.posY() != 1)
+            continue;
+        if (v.posX() >= 17)
+            open = open || v.skyLight() == 15;
+        if (v.posX() <= 4)
+            shaded = shaded || v.skyLight() <= 4;
+    }
+    EXPECT_TRUE(open);
+    EXPECT_TRUE(shaded);
+
+    // Quads only merge across equally lit cells
+    EXPECT_GT(lit.vertices.size(), unlit.vertices.size());
+}
+
+TEST_F(VoxelLightTest, MesherLightsFacesIntoUntrackedChunksAsOpenSky) {
+    density.set(4, 31, 4, 1.0f);
+    ChunkedGrid<Essence> essence;
+    VoxelLighting lighting(density);
+    lighting.addChunk(0, 0, 0);
+    lighting.propagate();
+    ASSERT_FALSE(lighting.light().hasChunk(0, 1, 0));
+
+    auto lit = VoxelMesher::meshChunkData(0, 0, 0, density, essence, 0.5f, &lighting.light());
+
+    // The top face looks into chunk (0, 1, 0), which has no light tracked
+    int topVertices = 0;
+    for (const auto& v : lit.vertices) {
+        if (v.normalIndex() != 2)
+            continue;
+        ++topVertices;
+        EXPECT_EQ(v.posY(), 32);
+        EXPECT_EQ(v.skyLight(), 15);
+        EXPECT_EQ(v.blockLight(), 0);
+    }
+    EXPECT_EQ(topVertices, 4);
+}
+
+TEST_F(VoxelLightTest, MesherSmoothsCornersIntoUntrackedChunksAsOpenSky) {
+    // Dark, roofed chunk (1, 0, 0) beside a block at the +X, +Z edge of chunk (0, 0, 0)
+    fillBox(32, 31, 0, 63, 31, 31, 1.0f);
+    density.set(31, 10, 31, 1.0f);
+    ChunkedGrid<Essence> essence;
+    VoxelLighting lighting(density);
+    lighting.addChunk(1, 0, 0);
+    lighting.propagate();
+    ASSERT_EQ(skyLight(lighting.light().get(32, 10, 31)), 0);
+    ASSERT_FALSE(lighting.light().hasChunk(1, 0, 1));
+
+    auto lit = VoxelMesher::meshChunkData(0, 0, 0, density, essence, 0.5f, &lighting.light());
+
+    // The +X face looks into the dark cell; corners on its +Z edge also touch
+    // untracked chunk (1, 0, 1), which counts as open sky: (0 + 0 + 15 + 15) / 4
+    int faceVertices = 0;
+    for (const auto& v : lit.vertices) {
+        if (v.normalIndex() != 0)
+            continue;
+        ++faceVertices;
+        EXPECT_EQ(v.skyLight(), v.posZ() == 32 ? 8 : 0) << "z " << static_cast<int>(v.posZ());
+    }
+    EXPECT_EQ(faceVertices, 4);
+}
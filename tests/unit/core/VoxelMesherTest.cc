@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "fabric/core/VoxelMesher.hh"
+#include "fabric/utils/AllocationTracker.hh"
 
 using namespace fabric;
 using Essence = Vector4<float, Space::World>;
@@ -227,6 +228,13 @@ TEST_F(VoxelMesherTest, PackedVertexRoundTrip) {
     EXPECT_EQ(v.normalIndex(), 4);
     EXPECT_EQ(v.aoLevel(), 2);
     EXPECT_EQ(v.paletteIndex(), 1023);
+    EXPECT_EQ(v.skyLight(), 15);
+    EXPECT_EQ(v.blockLight(), 0);
+
+    auto lit = VoxelVertex::pack(0, 0, 0, 0, 3, 65535, 0x9A);
+    EXPECT_EQ(lit.paletteIndex(), 65535);
+    EXPECT_EQ(lit.skyLight(), 0xA);
+    EXPECT_EQ(lit.blockLight(), 0x9);
 }
 
 TEST_F(VoxelMesherTest, PackedVertexSizeIs8Bytes) {
@@ -241,3 +249,34 @@ TEST_F(VoxelMesherTest, PaletteDeduplicatesColors) {
     auto data = VoxelMesher::meshChunkData(0, 0, 0, density, essence);
     EXPECT_EQ(data.palette.size(), 1u);
 }
+
+TEST_F(VoxelMesherTest, RemeshIntoExistingDataDoesNotAllocate) {
+    for (int x = 0; x < 4; ++x) {
+        density.set(x, 0, 0, 1.0f);
+        essence.set(x, 0, 0, Essence(static_cast<float>(x) * 0.25f, 0.5f, 0.0f, 1.0f));
+    }
+
+    ChunkMeshData data;
+    VoxelMesher::meshChunkData(0, 0, 0, density, essence, data);
+    auto vertexCount = data.vertices.size();
+    auto paletteSize = data.palette.size();
+
+    EXPECT_NO_ALLOCATIONS({ VoxelMesher::meshChunkData(0, 0, 0, density, essence, data); });
+    EXPECT_EQ(data.vertices.size(), vertexCount);
+    EXPECT_EQ(data.palette.size(), paletteSize);
+}
+
+TEST_F(VoxelMesherTest, OutParamMatchesReturnedData) {
+    density.set(0, 0, 0, 1.0f);
+    density.set(0, 1, 0, 1.0f);
+    essence.set(0, 1, 0, Essence(1.0f, 0.0f, 0.0f, 1.0f));
+
+    ChunkMeshData data;
+    data.palette.push_back({0.5f, 0.5f, 0.5f, 1.0f}); // Stale content is cleared
+    VoxelMesher::meshChunkData(0, 0, 0, density, essence, data);
+    auto expected = VoxelMesher::meshChunkData(0, 0, 0, density, essence);
+
+    EXPECT_EQ(data.vertices.size(), expected.vertices.size());
+    EXPECT_EQ(data.indices, expected.indices);
+    EXPECT_EQ(data.palette.size(), expected.palette.size());
+}
@@ -0,0 +1,144 @@
+#include "fabric/core/WorldSave.hh"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Same name as Position, different layout
+struct WidePosition {
+    double x, y, z;
+};
+
+} // namespace
+
+TEST(WorldSaveTest, RoundTripsEntitiesAndHierarchy) {
+    auto path = tempPath("fabric_world_roundtrip.fworld");
+    std::vector<flecs::entity_t> ids;
+
+    {
+        World world;
+        world.registerCoreComponents();
+        auto root = world.createSceneEntity();
+        root.set<Position>({1.0f, 2.0f, 3.0f});
+        auto child = world.createChildEntity(root);
+        child.set<Position>({4.0f, 5.0f, 6.0f}).set<Renderable>({42});
+        for (int i = 0; i < 1000; ++i)
+            ids.push_back(world.get().entity().set<Position>({float(i), 0.0f, 0.0f}).id());
+        ids.push_back(root.id());
+        ids.push_back(child.id());
+
+        WorldSaveStats stats;
+        ASSERT_TRUE(WorldSave::core().save(world.get(), path, &stats));
+        EXPECT_EQ(stats.entities, 1002u);
+        EXPECT_GE(stats.tables, 3u);
+    }
+
+    World restored;
+    restored.registerCoreComponents();
+    auto stats = WorldSave::core().load(restored.get(), path);
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->entities, 1002u);
+
+    auto& w = restored.get();
+    for (int i = 0; i < 1000; ++i) {
+        auto e = w.entity(ids[i]);
+        ASSERT_TRUE(e.is_alive());
+        const auto* pos = e.try_get<Position>();
+        ASSERT_NE(pos, nullptr);
+        EXPECT_FLOAT_EQ(pos->x, float(i));
+    }
+
+    auto root = w.entity(ids[1000]);
+    auto child = w.entity(ids[1001]);
+    EXPECT_TRUE(root.has<SceneEntity>());
+    EXPECT_EQ(root.get<Position>().z, 3.0f);
+    EXPECT_EQ(child.parent(), root);
+    EXPECT_EQ(child.get<Renderable>().sortKey, 42u);
+    EXPECT_FLOAT_EQ(child.get<Position>().y, 5.0f);
+
+    std::filesystem::remove(path);
+}
+
+TEST(WorldSaveTest, RoundTripsGrids) {
+    auto path = tempPath("fabric_world_grid.fworld");
+    {
+        World world;
+        world.registerCoreComponents();
+        DensityField density;
+        density.write(1, 2, 3, 0.5f);
+        density.write(-40, 70, 5, 2.0f);
+
+        WorldSaveStats stats;
+        ASSERT_TRUE(WorldSave::core().grid("density", density.grid()).save(world.get(), path, &stats));
+        EXPECT_EQ(stats.chunks, 2u);
+    }
+
+    World world;
+    world.registerCoreComponents();
+    DensityField density;
+    density.write(500, 500, 500, 9.0f); // Replaced by the load
+    auto stats = WorldSave::core().grid("density", density.grid()).load(world.get(), path);
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->chunks, 2u);
+    EXPECT_EQ(density.grid().chunkCount(), 2u);
+    EXPECT_FLOAT_EQ(density.read(1, 2, 3), 0.5f);
+    EXPECT_FLOAT_EQ(density.read(-40, 70, 5), 2.0f);
+    EXPECT_FLOAT_EQ(density.read(500, 500, 500), 0.0f);
+
+    std::filesystem::remove(path);
+}
+
+TEST(WorldSaveTest, RefusesIdsAlreadyInUse) {
+    auto path = tempPath("fabric_world_in_use.fworld");
+    World world;
+    world.registerCoreComponents();
+    flecs::entity_t id = world.get().entity().set<Position>({1.0f, 1.0f, 1.0f}).id();
+    ASSERT_TRUE(WorldSave::core().save(world.get(), path));
+
+    // Loading into the same world would overwrite live entities
+    EXPECT_FALSE(WorldSave::core().load(world.get(), path).has_value());
+    EXPECT_FLOAT_EQ(world.get().entity(id).get<Position>().x, 1.0f);
+
+    std::filesystem::remove(path);
+}
+
+TEST(WorldSaveTest, RejectsBadFiles) {
+    World world;
+    world.registerCoreComponents();
+    EXPECT_FALSE(WorldSave::core().load(world.get(), tempPath("fabric_world_missing.fworld")).has_value());
+
+    auto garbage = tempPath("fabric_world_garbage.fworld");
+    {
+        std::ofstream out(garbage, std::ios::binary);
+        out << "definitely not a world save, but long enough to have a header";
+    }
+    EXPECT_FALSE(WorldSave::core().load(world.get(), garbage).has_value());
+    std::filesystem::remove(garbage);
+}
+
+TEST(WorldSaveTest, RejectsComponentSizeMismatch) {
+    auto path = tempPath("fabric_world_schema.fworld");
+    {
+        World world;
+        world.registerCoreComponents();
+        world.get().entity().set<Position>({1.0f, 2.0f, 3.0f});
+        ASSERT_TRUE(WorldSave::core().save(world.get(), path));
+    }
+
+    World world;
+    WorldSave mismatched;
+    mismatched.component<WidePosition>("Position");
+    EXPECT_FALSE(mismatched.load(world.get(), path).has_value());
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,71 @@
+#include "fabric/ui/TextureAtlas.hh"
+
+#include <gtest/gtest.h>
+
+using namespace fabric;
+
+TEST(TextureAtlasTest, AllocateOpensFirstPage) {
+    TextureAtlas atlas(256, 2);
+    EXPECT_EQ(atlas.pageCount(), 0u);
+
+    auto region = atlas.allocate(16, 16);
+    ASSERT_TRUE(region.has_value());
+    EXPECT_EQ(region->page, 0);
+    EXPECT_EQ(region->x, 0);
+    EXPECT_EQ(region->y, 0);
+    EXPECT_EQ(atlas.pageCount(), 1u);
+    EXPECT_EQ(atlas.liveRegions(0), 1u);
+}
+
+TEST(TextureAtlasTest, RegionsOnSameShelfDoNotOverlap) {
+    TextureAtlas atlas(256, 1);
+    auto a = atlas.allocate(20, 10);
+    auto b = atlas.allocate(30, 10);
+    ASSERT_TRUE(a && b);
+    EXPECT_EQ(a->y, b->y);
+    EXPECT_GE(b->x, a->x + a->width);
+}
+
+TEST(TextureAtlasTest, TallerRegionOpensNewShelf) {
+    TextureAtlas atlas(256, 1);
+    auto a = atlas.allocate(10, 8);
+    auto b = atlas.allocate(10, 32);
+    ASSERT_TRUE(a && b);
+    EXPECT_GE(b->y, a->y + a->height);
+}
+
+TEST(TextureAtlasTest, OversizedRegionRejected) {
+    TextureAtlas atlas(64, 4);
+    EXPECT_FALSE(atlas.allocate(65, 8).has_value());
+    EXPECT_FALSE(atlas.allocate(0, 8).has_value());
+    EXPECT_EQ(atlas.pageCount(), 0u);
+}
+
+TEST(TextureAtlasTest, SpillsToNextPageThenFails) {
+    TextureAtlas atlas(64, 2);
+    auto a = atlas.allocate(64, 64);
+    auto b = atlas.allocate(64, 64);
+    ASSERT_TRUE(a && b);
+    EXPECT_EQ(a->page, 0);
+    EXPECT_EQ(b->page, 1);
+    EXPECT_FALSE(atlas.allocate(8, 8).has_value());
+}
+
+TEST(TextureAtlasTest, PageResetsWhenAllRegionsReleased) {
+    TextureAtlas atlas(64, 1);
+    auto a = atlas.allocate(64, 32);
+    auto b = atlas.allocate(64, 32);
+    ASSERT_TRUE(a && b);
+    EXPECT_FALSE(atlas.allocate(8, 8).has_value());
+
+    atlas.release(*a);
+    EXPECT_EQ(atlas.liveRegions(0), 1u);
+    EXPECT_FALSE(atlas.allocate(8, 8).has_value());
+
+    atlas.release(*b);
+    EXPECT_EQ(atlas.liveRegions(0), 0u);
+    auto c = atlas.allocate(64, 64);
+    ASSERT_TRUE(c.has_value());
+    EXPECT_EQ(c->x, 0);
+    EXPECT_EQ(c->y, 0);
+}
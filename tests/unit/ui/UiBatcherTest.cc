@@ -0,0 +1,111 @@
+#include "fabric/ui/UiBatcher.hh"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+using namespace fabric;
+
+namespace {
+
+std::array<Rml::Vertex, 4> makeQuad() {
+    std::array<Rml::Vertex, 4> quad{};
+    quad[0].position = {0.0f, 0.0f};
+    quad[1].position = {10.0f, 0.0f};
+    quad[2].position = {10.0f, 10.0f};
+    quad[3].position = {0.0f, 10.0f};
+    quad[0].tex_coord = {0.0f, 0.0f};
+    quad[1].tex_coord = {1.0f, 0.0f};
+    quad[2].tex_coord = {1.0f, 1.0f};
+    quad[3].tex_coord = {0.0f, 1.0f};
+    return quad;
+}
+
+constexpr std::array<uint16_t, 6> kQuadIndices = {0, 1, 2, 0, 2, 3};
+
+bgfx::TextureHandle tex(uint16_t idx) {
+    return bgfx::TextureHandle{idx};
+}
+
+} // namespace
+
+TEST(UiBatcherTest, StartsEmpty) {
+    UiBatcher batcher;
+    EXPECT_TRUE(batcher.empty());
+    EXPECT_TRUE(batcher.vertices().empty());
+    EXPECT_TRUE(batcher.batches().empty());
+}
+
+TEST(UiBatcherTest, SameTextureAndScissorMerge) {
+    UiBatcher batcher;
+    auto quad = makeQuad();
+    for (int i = 0; i < 100; ++i) {
+        batcher.append(quad, kQuadIndices, static_cast<float>(i * 10), 0.0f, {}, tex(1), {});
+    }
+    ASSERT_EQ(batcher.batches().size(), 1u);
+    EXPECT_EQ(batcher.batches()[0].indexCount, 600u);
+    EXPECT_EQ(batcher.vertices().size(), 400u);
+}
+
+TEST(UiBatcherTest, TextureChangeSplitsBatch) {
+    UiBatcher batcher;
+    auto quad = makeQuad();
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(1), {});
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(2), {});
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(2), {});
+    ASSERT_EQ(batcher.batches().size(), 2u);
+    EXPECT_EQ(batcher.batches()[1].firstIndex, 6u);
+    EXPECT_EQ(batcher.batches()[1].indexCount, 12u);
+}
+
+TEST(UiBatcherTest, ScissorChangeSplitsBatch) {
+    UiBatcher batcher;
+    auto quad = makeQuad();
+    UiScissor clip{true, 0, 0, 50, 50};
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(1), {});
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(1), clip);
+    EXPECT_EQ(batcher.batches().size(), 2u);
+}
+
+TEST(UiBatcherTest, TranslationAndIndexRebaseApplied) {
+    UiBatcher batcher;
+    auto quad = makeQuad();
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(1), {});
+    batcher.append(quad, kQuadIndices, 5.0f, 7.0f, {}, tex(1), {});
+
+    EXPECT_FLOAT_EQ(batcher.vertices()[4].position.x, 5.0f);
+    EXPECT_FLOAT_EQ(batcher.vertices()[6].position.y, 17.0f);
+    EXPECT_EQ(batcher.indices()[6], 4);
+    EXPECT_EQ(batcher.indices()[11], 7);
+}
+
+TEST(UiBatcherTest, UvRemappedIntoAtlasRegion) {
+    UiBatcher batcher;
+    auto quad = makeQuad();
+    UiUvRect uv{0.25f, 0.5f, 0.5f, 0.75f};
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, uv, tex(1), {});
+
+    EXPECT_FLOAT_EQ(batcher.vertices()[0].tex_coord.x, 0.25f);
+    EXPECT_FLOAT_EQ(batcher.vertices()[0].tex_coord.y, 0.5f);
+    EXPECT_FLOAT_EQ(batcher.vertices()[2].tex_coord.x, 0.5f);
+    EXPECT_FLOAT_EQ(batcher.vertices()[2].tex_coord.y, 0.75f);
+}
+
+TEST(UiBatcherTest, CanFitRespects16BitLimit) {
+    UiBatcher batcher;
+    EXPECT_TRUE(batcher.canFit(UiBatcher::kMaxVertices, 6));
+    EXPECT_FALSE(batcher.canFit(UiBatcher::kMaxVertices + 1, 6));
+
+    auto quad = makeQuad();
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(1), {});
+    EXPECT_FALSE(batcher.canFit(UiBatcher::kMaxVertices - 3, 6));
+}
+
+TEST(UiBatcherTest, ClearResetsStream) {
+    UiBatcher batcher;
+    auto quad = makeQuad();
+    batcher.append(quad, kQuadIndices, 0.0f, 0.0f, {}, tex(1), {});
+    batcher.clear();
+    EXPECT_TRUE(batcher.empty());
+    EXPECT_TRUE(batcher.indices().empty());
+}
@@ -0,0 +1,46 @@
+#include "fabric/utils/AllocationTracker.hh"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+TEST(AllocationTrackerTest, HooksAreLinkedIntoUnitTests) {
+  EXPECT_TRUE(AllocationTracker::available());
+}
+
+TEST(AllocationTrackerTest, ScopeCountsNewAndDelete) {
+  AllocationScope scope;
+  auto value = std::make_unique<int>(7);
+  EXPECT_EQ(scope.allocations(), 1u);
+  EXPECT_GE(scope.bytes(), sizeof(int));
+  value.reset();
+  EXPECT_EQ(scope.frees(), 1u);
+}
+
+TEST(AllocationTrackerTest, ScopeIgnoresOtherThreads) {
+  auto before = AllocationTracker::global();
+  AllocationScope scope;
+  std::thread worker([] {
+    std::vector<int> values(4096);
+    values[0] = 1;
+  });
+  worker.join();
+
+  // Only the std::thread bookkeeping lands on this thread; global sees the worker too
+  EXPECT_LT(scope.bytes(), 4096 * sizeof(int));
+  EXPECT_GE(AllocationTracker::global().bytes - before.bytes, 4096 * sizeof(int));
+}
+
+TEST(AllocationTrackerTest, ExpectNoAllocationsPassesForStackWork) {
+  std::vector<int> values;
+  values.reserve(16);
+  EXPECT_NO_ALLOCATIONS({
+    for (int i = 0; i < 16; ++i) {
+      values.push_back(i);
+    }
+  });
+  EXPECT_EQ(values.size(), 16u);
+}
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <thread>
 #include <vector>
+#include <algorithm>
 #include <atomic>
 
 using namespace fabric;
@@ -119,3 +120,152 @@ TEST(BufferPoolTest, BlockingBorrowWaitsForReturn) {
   EXPECT_TRUE(borrowed.load());
   EXPECT_EQ(pool.available(), 1u);
 }
+
+TEST(BufferPoolTest, SizeClassSelection) {
+  BufferPoolConfig config;
+  config.classes = {{256, 2}, {64, 2}};
+  BufferPool pool(config);
+  EXPECT_EQ(pool.capacity(), 4u);
+  EXPECT_EQ(pool.slotSize(), 256u);
+
+  auto small = pool.borrow();
+  EXPECT_EQ(small.size(), 64u);
+  auto fits = pool.borrow(65);
+  EXPECT_EQ(fits.size(), 256u);
+  auto exact = pool.borrow(64);
+  EXPECT_EQ(exact.size(), 64u);
+
+  // Nothing holds 512 bytes
+  EXPECT_FALSE(pool.tryBorrow(512).has_value());
+  EXPECT_THROW(pool.borrow(512), FabricException);
+}
+
+TEST(BufferPoolTest, SlotsAreAlignedAndDistinct) {
+  BufferPool pool(24, 4);
+  std::vector<BufferSlot> slots;
+  for (int i = 0; i < 4; ++i)
+    slots.push_back(pool.borrow());
+
+  for (size_t i = 0; i < slots.size(); ++i) {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(slots[i].data()) % alignof(std::max_align_t), 0u);
+    for (size_t j = i + 1; j < slots.size(); ++j)
+      EXPECT_NE(slots[i].data(), slots[j].data());
+  }
+}
+
+TEST(BufferPoolTest, StatsTrackHighWaterAndMisses) {
+  BufferPool pool(32, 2);
+  {
+    auto a = pool.borrow();
+    auto b = pool.borrow();
+    EXPECT_FALSE(pool.tryBorrow().has_value());
+  }
+  auto c = pool.borrow();
+
+  auto stats = pool.stats();
+  ASSERT_EQ(stats.size(), 1u);
+  EXPECT_EQ(stats[0].slotSize, 32u);
+  EXPECT_EQ(stats[0].capacity, 2u);
+  EXPECT_EQ(stats[0].borrowed, 1u);
+  EXPECT_EQ(stats[0].highWater, 2u);
+  EXPECT_EQ(stats[0].borrows, 3u);
+  EXPECT_EQ(stats[0].misses, 1u);
+  EXPECT_EQ(stats[0].grows, 0u);
+}
+
+TEST(BufferPoolTest, GrowableAddsSlabsUpToLimit) {
+  BufferPoolConfig config;
+  config.classes = {{16, 2}};
+  config.growable = true;
+  config.maxSlabs = 2;
+  BufferPool pool(config);
+
+  std::vector<BufferSlot> slots;
+  for (int i = 0; i < 4; ++i) {
+    auto slot = pool.tryBorrow();
+    ASSERT_TRUE(slot.has_value());
+    slots.push_back(std::move(*slot));
+  }
+  EXPECT_EQ(pool.capacity(), 4u);
+  EXPECT_FALSE(pool.tryBorrow().has_value());
+  EXPECT_EQ(pool.stats()[0].grows, 1u);
+
+  slots.clear();
+  EXPECT_EQ(pool.available(), 4u);
+}
+
+TEST(BufferPoolTest, MagazinesDoNotHideFreeSlots) {
+  BufferPoolConfig config;
+  config.classes = {{16, 4}};
+  config.magazineSize = 4;
+  BufferPool pool(config);
+
+  // Returned slots land in this thread's magazine...
+  {
+    std::vector<BufferSlot> slots;
+    for (int i = 0; i < 4; ++i)
+      slots.push_back(pool.borrow());
+  }
+
+  // ...but another thread can still borrow every one of them
+  size_t borrowed = 0;
+  std::thread other([&]() {
+    std::vector<BufferSlot> slots;
+    while (auto slot = pool.tryBorrow())
+      slots.push_back(std::move(*slot));
+    borrowed = slots.size();
+  });
+  other.join();
+  EXPECT_EQ(borrowed, 4u);
+  EXPECT_EQ(pool.available(), 4u);
+}
+
+TEST(BufferPoolTest, ConcurrentBorrowNeverSharesSlot) {
+  constexpr size_t kSlotCount = 8;
+  constexpr size_t kThreadCount = 8;
+  constexpr size_t kIterations = 2000;
+
+  BufferPoolConfig config;
+  config.classes = {{64, kSlotCount / 2}, {128, kSlotCount / 2}};
+  BufferPool pool(config);
+  std::atomic<bool> collision{false};
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreadCount; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = 0; i < kIterations; ++i) {
+        auto slot = pool.tryBorrow((i & 1) ? 100 : 0);
+        if (!slot)
+          continue;
+        // Stamp the slot and check nobody else wrote over it
+        auto tag = static_cast<uint8_t>(t + 1);
+        std::fill(slot->data(), slot->data() + slot->size(), tag);
+        std::this_thread::yield();
+        for (size_t b = 0; b < slot->size(); ++b) {
+          if (slot->data()[b] != tag)
+            collision.store(true);
+        }
+      }
+    });
+  }
+
+  for (auto& t : threads)
+    t.join();
+
+  EXPECT_FALSE(collision.load());
+  EXPECT_EQ(pool.available(), kSlotCount);
+}
+
+TEST(BufferPoolTest, BlockingBorrowIsCounted) {
+  BufferPool pool(16, 1);
+  auto slot = pool.borrow();
+
+  std::thread waiter([&]() { auto s = pool.borrow(); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  slot = BufferSlot();
+  waiter.join();
+
+  auto stats = pool.stats();
+  EXPECT_EQ(stats[0].waits, 1u);
+  EXPECT_GT(stats[0].waitNanos, 0u);
+}
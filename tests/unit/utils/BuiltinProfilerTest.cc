@@ -0,0 +1,213 @@
+#include "fabric/utils/BuiltinProfiler.hh"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace fabric;
+
+namespace {
+
+size_t countOccurrences(const std::string& text, const std::string& needle) {
+  size_t count = 0;
+  for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+std::string exportToString() {
+  std::ostringstream out;
+  profiler::exportChromeTrace(out);
+  return out.str();
+}
+
+} // namespace
+
+class BuiltinProfilerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    profiler::setEnabled(true);
+    profiler::reset();
+  }
+  void TearDown() override {
+    profiler::setHitchThreshold(0.0);
+    profiler::reset();
+  }
+};
+
+TEST_F(BuiltinProfilerTest, NestedZonesExportAsBeginEndPairs) {
+  {
+    profiler::ScopedZone outer("outer");
+    profiler::ScopedZone inner("inner");
+  }
+
+  auto trace = exportToString();
+  EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"outer\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"inner\""), std::string::npos);
+  EXPECT_EQ(countOccurrences(trace, "\"ph\":\"B\""), 2u);
+  EXPECT_EQ(countOccurrences(trace, "\"ph\":\"E\""), 2u);
+}
+
+TEST_F(BuiltinProfilerTest, DisabledZonesRecordNothing) {
+  profiler::setEnabled(false);
+  { profiler::ScopedZone zone("hidden"); }
+  profiler::setEnabled(true);
+
+  EXPECT_EQ(exportToString().find("hidden"), std::string::npos);
+}
+
+TEST_F(BuiltinProfilerTest, ResetDiscardsEvents) {
+  { profiler::ScopedZone zone("before_reset"); }
+  profiler::reset();
+  { profiler::ScopedZone zone("after_reset"); }
+
+  auto trace = exportToString();
+  EXPECT_EQ(trace.find("before_reset"), std::string::npos);
+  EXPECT_NE(trace.find("after_reset"), std::string::npos);
+}
+
+TEST_F(BuiltinProfilerTest, WrappedRingDropsOrphanedEnds) {
+  {
+    profiler::ScopedZone outer("evicted");
+    for (size_t i = 0; i < profiler::ThreadBuffer::kCapacity; ++i) {
+      profiler::ScopedZone zone("filler");
+    }
+  }
+
+  std::ostringstream out;
+  size_t written = profiler::exportChromeTrace(out);
+  auto trace = out.str();
+  EXPECT_EQ(trace.find("evicted"), std::string::npos);
+  EXPECT_EQ(countOccurrences(trace, "\"ph\":\"B\""), countOccurrences(trace, "\"ph\":\"E\""));
+  EXPECT_LE(written, profiler::ThreadBuffer::kCapacity);
+}
+
+TEST_F(BuiltinProfilerTest, ThreadsGetSeparateTracks) {
+  std::thread worker([] {
+    profiler::setThreadName("profiler_worker");
+    profiler::ScopedZone zone("worker_zone");
+  });
+  worker.join();
+  { profiler::ScopedZone zone("main_zone"); }
+
+  auto trace = exportToString();
+  EXPECT_NE(trace.find("\"name\":\"profiler_worker\""), std::string::npos);
+  EXPECT_NE(trace.find("worker_zone"), std::string::npos);
+  EXPECT_NE(trace.find("main_zone"), std::string::npos);
+}
+
+TEST_F(BuiltinProfilerTest, ExitedThreadBuffersAreReused) {
+  const profiler::ThreadBuffer* first = nullptr;
+  std::thread([&first] {
+    profiler::setThreadName("short_lived");
+    profiler::ScopedZone zone("first_zone");
+    first = profiler::detail::tlsBuffer;
+  }).join();
+
+  // The exited thread's events stay until its buffer is taken again
+  EXPECT_NE(exportToString().find("first_zone"), std::string::npos);
+
+  const profiler::ThreadBuffer* second = nullptr;
+  uint32_t secondId = 0;
+  std::thread([&] {
+    profiler::ScopedZone zone("second_zone");
+    second = profiler::detail::tlsBuffer;
+    secondId = second->id();
+  }).join();
+
+  EXPECT_EQ(second, first);
+  auto trace = exportToString();
+  EXPECT_EQ(trace.find("first_zone"), std::string::npos);
+  EXPECT_EQ(trace.find("short_lived"), std::string::npos);
+  EXPECT_NE(trace.find("second_zone"), std::string::npos);
+  EXPECT_NE(trace.find("\"tid\":" + std::to_string(secondId)), std::string::npos);
+}
+
+TEST_F(BuiltinProfilerTest, EscapesZoneNames) {
+  { profiler::ScopedZone zone("quote\"back\\slash"); }
+  EXPECT_NE(exportToString().find("quote\\\"back\\\\slash"), std::string::npos);
+}
+
+TEST_F(BuiltinProfilerTest, FrameMarkTracksFrames) {
+  auto before = profiler::frameCount();
+  profiler::frameMark();
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  profiler::frameMark();
+
+  EXPECT_EQ(profiler::frameCount(), before + 2);
+  EXPECT_GE(profiler::lastFrameMs(), 1.0);
+  EXPECT_NE(exportToString().find("\"ph\":\"i\""), std::string::npos);
+}
+
+TEST_F(BuiltinProfilerTest, FrameMarkAggregatesZonesPerFrame) {
+  auto totalFor = [](const char* name) {
+    for (const auto& zone : profiler::lastFrameZones()) {
+      if (std::string(zone.name) == name)
+        return zone;
+    }
+    return profiler::ZoneTotal{name, 0, 0.0};
+  };
+
+  profiler::frameMark();
+  for (int i = 0; i < 2; ++i) {
+    profiler::ScopedZone zone("frame_alpha");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  {
+    profiler::ScopedZone zone("frame_beta");
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+  }
+  profiler::frameMark();
+
+  auto alpha = totalFor("frame_alpha");
+  auto beta = totalFor("frame_beta");
+  EXPECT_EQ(alpha.count, 2u);
+  EXPECT_GE(alpha.totalMs, 2.0);
+  EXPECT_EQ(beta.count, 1u);
+  EXPECT_GE(beta.totalMs, 3.0);
+  EXPECT_NE(exportToString().find("{\"name\":\"frame_beta\",\"count\":1,"), std::string::npos);
+
+  // The next frame starts from zero; a zone on a worker counts too
+  std::thread([] {
+    profiler::ScopedZone zone("frame_beta");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }).join();
+  { profiler::ScopedZone zone("frame_beta"); }
+  profiler::frameMark();
+
+  EXPECT_EQ(totalFor("frame_alpha").count, 0u);
+  beta = totalFor("frame_beta");
+  EXPECT_EQ(beta.count, 2u);
+  EXPECT_GE(beta.totalMs, 1.0);
+}
+
+TEST_F(BuiltinProfilerTest, HitchThresholdWritesTrace) {
+  auto dir = std::filesystem::temp_directory_path() / "fabric_profiler_hitch";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  profiler::setHitchThreshold(1.0, dir.string());
+
+  profiler::frameMark();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  profiler::frameMark();
+
+  size_t files = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+    EXPECT_EQ(entry.path().extension(), ".json");
+    ++files;
+  }
+  EXPECT_EQ(files, 1u);
+  std::filesystem::remove_all(dir);
+}
+
+TEST_F(BuiltinProfilerTest, TimestampsAdvance) {
+  auto a = profiler::readTimestamp();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  auto b = profiler::readTimestamp();
+  EXPECT_GT(b, a);
+  EXPECT_GT(profiler::ticksPerNanosecond(), 0.0);
+}
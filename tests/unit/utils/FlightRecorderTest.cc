@@ -0,0 +1,205 @@
+#include "fabric/utils/FlightRecorder.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace fabric;
+
+namespace {
+
+FlightRecorderConfig quietConfig(size_t capacity = 8) {
+  FlightRecorderConfig config;
+  config.frameCapacity = capacity;
+  config.hitchThresholdMs = 0.0;
+  return config;
+}
+
+void runFrame(FlightRecorder& recorder) {
+  recorder.beginFrame();
+  recorder.endFrame();
+}
+
+} // namespace
+
+TEST(FlightRecorderTest, RingKeepsNewestFrames) {
+  FlightRecorder recorder(quietConfig(4));
+  for (int i = 0; i < 10; ++i) {
+    runFrame(recorder);
+  }
+
+  auto frames = recorder.snapshot();
+  ASSERT_EQ(frames.size(), 4u);
+  EXPECT_EQ(frames.front().frame, 7u);
+  EXPECT_EQ(frames.back().frame, 10u);
+  EXPECT_EQ(recorder.frameCount(), 10u);
+}
+
+TEST(FlightRecorderTest, CountersResetAndGaugesHold) {
+  FlightRecorder recorder(quietConfig());
+  auto events = recorder.addChannel("events", FlightChannelKind::Counter);
+  auto queue = recorder.addChannel("queue", FlightChannelKind::Gauge);
+
+  recorder.beginFrame();
+  recorder.count(events, 3);
+  recorder.setGauge(queue, 5);
+  recorder.endFrame();
+  runFrame(recorder);
+
+  auto frames = recorder.snapshot();
+  ASSERT_EQ(frames.size(), 2u);
+  EXPECT_EQ(frames[0].values[events], 3u);
+  EXPECT_EQ(frames[1].values[events], 0u);
+  EXPECT_EQ(frames[0].values[queue], 5u);
+  EXPECT_EQ(frames[1].values[queue], 5u);
+}
+
+TEST(FlightRecorderTest, SampledCounterRecordsDelta) {
+  FlightRecorder recorder(quietConfig());
+  uint64_t total = 100;
+  auto allocs = recorder.addSampledChannel("allocations", FlightChannelKind::Counter, [&total] { return total; });
+
+  total += 7;
+  runFrame(recorder);
+  total += 2;
+  runFrame(recorder);
+
+  auto frames = recorder.snapshot();
+  EXPECT_EQ(frames[0].values[allocs], 7u);
+  EXPECT_EQ(frames[1].values[allocs], 2u);
+}
+
+TEST(FlightRecorderTest, ScopedZoneAccumulatesTime) {
+  FlightRecorder recorder(quietConfig());
+  auto zone = recorder.addChannel("work", FlightChannelKind::Zone);
+
+  recorder.beginFrame();
+  for (int i = 0; i < 2; ++i) {
+    FlightRecorder::ScopedZone scope(recorder, zone);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  recorder.endFrame();
+
+  auto frame = recorder.snapshot().back();
+  EXPECT_GE(frame.values[zone], 2'000'000u);
+  EXPECT_GE(frame.durationNs, frame.values[zone]);
+}
+
+TEST(FlightRecorderTest, ChannelLimitThrows) {
+  FlightRecorder recorder(quietConfig());
+  for (size_t i = 0; i < FlightRecorder::kMaxChannels; ++i) {
+    recorder.addChannel("c" + std::to_string(i), FlightChannelKind::Counter);
+  }
+  EXPECT_THROW(recorder.addChannel("overflow", FlightChannelKind::Counter), FabricException);
+}
+
+TEST(FlightRecorderTest, DumpRoundTrips) {
+  FlightRecorder recorder(quietConfig());
+  auto zone = recorder.addChannel("render", FlightChannelKind::Zone);
+  auto events = recorder.addChannel("events", FlightChannelKind::Counter);
+  for (uint32_t i = 1; i <= 3; ++i) {
+    recorder.beginFrame();
+    recorder.addZoneTime(zone, i * 1000);
+    recorder.count(events, i);
+    recorder.endFrame();
+  }
+
+  std::stringstream buffer;
+  recorder.dump(buffer, 2);
+
+  FlightDump dump;
+  ASSERT_TRUE(FlightRecorder::readDump(buffer, dump));
+  EXPECT_EQ(dump.hitchFrame, 2u);
+  ASSERT_EQ(dump.channels.size(), 2u);
+  EXPECT_EQ(dump.channels[0].name, "render");
+  EXPECT_EQ(dump.channels[0].kind, FlightChannelKind::Zone);
+  ASSERT_EQ(dump.frames.size(), 3u);
+  EXPECT_EQ(dump.frames[2].frame, 3u);
+  EXPECT_EQ(dump.frames[2].values[zone], 3000u);
+  EXPECT_EQ(dump.frames[1].values[events], 2u);
+}
+
+TEST(FlightRecorderTest, RejectsCorruptDump) {
+  std::stringstream buffer("not a flight record");
+  FlightDump dump;
+  EXPECT_FALSE(FlightRecorder::readDump(buffer, dump));
+}
+
+TEST(FlightRecorderTest, ChromeTraceHasFramesCountersAndHitch) {
+  FlightRecorder recorder(quietConfig());
+  auto zone = recorder.addChannel("render", FlightChannelKind::Zone);
+  recorder.addChannel("queue", FlightChannelKind::Gauge);
+  recorder.beginFrame();
+  recorder.addZoneTime(zone, 1'500'000);
+  recorder.endFrame();
+
+  std::stringstream buffer;
+  recorder.dump(buffer, 1);
+  FlightDump dump;
+  ASSERT_TRUE(FlightRecorder::readDump(buffer, dump));
+
+  std::ostringstream trace;
+  EXPECT_EQ(FlightRecorder::writeChromeTrace(dump, trace), 4u);
+  auto text = trace.str();
+  EXPECT_NE(text.find("\"name\":\"Frame 1\""), std::string::npos);
+  EXPECT_NE(text.find("\"name\":\"zones_ms\""), std::string::npos);
+  EXPECT_NE(text.find("\"render\":1.500"), std::string::npos);
+  EXPECT_NE(text.find("\"name\":\"queue\""), std::string::npos);
+  EXPECT_NE(text.find("\"name\":\"Hitch\""), std::string::npos);
+}
+
+TEST(FlightRecorderTest, HitchWritesWindowAfterTrailingFrames) {
+  auto dir = std::filesystem::temp_directory_path() / "fabric_flight_hitch";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+
+  FlightRecorderConfig config;
+  config.frameCapacity = 16;
+  config.hitchThresholdMs = 1.0;
+  config.framesAfterHitch = 2;
+  config.directory = dir.string();
+  FlightRecorder recorder(config);
+  auto zone = recorder.addChannel("stall", FlightChannelKind::Zone);
+
+  runFrame(recorder);
+  recorder.beginFrame();
+  {
+    FlightRecorder::ScopedZone scope(recorder, zone);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_TRUE(recorder.endFrame());
+  EXPECT_EQ(recorder.dumpCount(), 0u);
+
+  runFrame(recorder);
+  runFrame(recorder);
+  ASSERT_EQ(recorder.dumpCount(), 1u);
+  EXPECT_EQ(recorder.hitchCount(), 1u);
+
+  auto expected = (dir / "fabric_hitch_2.fflight").string();
+  EXPECT_EQ(recorder.lastDumpPath(), expected);
+  auto tracePath = (dir / "hitch.json").string();
+  ASSERT_TRUE(FlightRecorder::convertToChromeTrace(expected, tracePath));
+  EXPECT_GT(std::filesystem::file_size(tracePath), 0u);
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST(FlightRecorderTest, SummaryListsLargestZones) {
+  FlightRecorder recorder(quietConfig());
+  auto small = recorder.addChannel("input", FlightChannelKind::Zone);
+  auto large = recorder.addChannel("render", FlightChannelKind::Zone);
+  auto events = recorder.addChannel("events", FlightChannelKind::Counter);
+  recorder.beginFrame();
+  recorder.addZoneTime(small, 1'000'000);
+  recorder.addZoneTime(large, 40'000'000);
+  recorder.count(events, 4);
+  recorder.endFrame();
+
+  auto summary = recorder.summarize(recorder.snapshot().back());
+  EXPECT_NE(summary.find("frame 1:"), std::string::npos);
+  EXPECT_LT(summary.find("render 40.00 ms"), summary.find("input 1.00 ms"));
+  EXPECT_NE(summary.find("events 4"), std::string::npos);
+}
@@ -0,0 +1,170 @@
+#include "fabric/utils/FrameArena.hh"
+#include "fabric/utils/AllocationTracker.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+class CountingResource : public std::pmr::memory_resource {
+public:
+  size_t live = 0;
+  size_t calls = 0;
+
+private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    live += bytes;
+    ++calls;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    live -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+} // namespace
+
+TEST(FrameArenaTest, BumpsWithinBlockAndResets) {
+  CountingResource upstream;
+  FrameArena arena(4096, &upstream);
+  EXPECT_EQ(upstream.calls, 0u); // Block is allocated lazily
+
+  auto* a = static_cast<char*>(arena.allocate(100, 1));
+  auto* b = static_cast<char*>(arena.allocate(100, 1));
+  EXPECT_EQ(b, a + 100);
+  EXPECT_EQ(arena.used(), 200u);
+  EXPECT_EQ(upstream.calls, 1u);
+
+  arena.reset();
+  EXPECT_EQ(arena.used(), 0u);
+  EXPECT_EQ(arena.allocate(8, 1), a);
+  EXPECT_EQ(upstream.calls, 1u);
+}
+
+TEST(FrameArenaTest, RespectsAlignment) {
+  FrameArena arena(4096);
+  static_cast<void>(arena.allocate(3, 1));
+  void* p = arena.allocate(64, 32);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % 32, 0u);
+}
+
+TEST(FrameArenaTest, OverflowGoesUpstreamAndBlockGrows) {
+  CountingResource upstream;
+  {
+    FrameArena arena(1024, &upstream);
+    static_cast<void>(arena.allocate(800, 8));
+    static_cast<void>(arena.allocate(800, 8));
+    EXPECT_EQ(arena.overflowBytes(), 800u);
+    EXPECT_EQ(arena.highWater(), 1600u);
+
+    arena.reset();
+    EXPECT_EQ(arena.overflowBytes(), 0u);
+    EXPECT_GE(arena.capacity(), 1600u);
+
+    static_cast<void>(arena.allocate(800, 8));
+    static_cast<void>(arena.allocate(800, 8));
+    EXPECT_EQ(arena.overflowBytes(), 0u);
+  }
+  EXPECT_EQ(upstream.live, 0u);
+}
+
+TEST(FrameArenaTest, PmrVectorDoesNotTouchTheHeap) {
+  FrameArena arena(1 << 16);
+  static_cast<void>(arena.allocate(1, 1)); // Warm: take the block from upstream
+  EXPECT_NO_ALLOCATIONS({
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 1000; ++i) {
+      values.push_back(i);
+    }
+  });
+}
+
+TEST(FrameArenaTest, DoubleBufferKeepsPreviousFrame) {
+  FrameArenas::advance();
+  auto& first = FrameArenas::current();
+  auto* value = static_cast<int*>(first.allocate(sizeof(int), alignof(int)));
+  *value = 42;
+
+  FrameArenas::advance();
+  auto& second = FrameArenas::current();
+  EXPECT_NE(&first, &second);
+  EXPECT_EQ(*value, 42);
+  EXPECT_GT(first.used(), 0u);
+
+  FrameArenas::advance();
+  EXPECT_EQ(&FrameArenas::current(), &first);
+  EXPECT_EQ(first.used(), 0u);
+}
+
+TEST(FrameArenaTest, ThreadsHaveTheirOwnArenas) {
+  FrameArenas::advance();
+  FrameArena* mainArena = &FrameArenas::current();
+  FrameArena* workerArena = nullptr;
+  std::thread worker([&workerArena] { workerArena = &FrameArenas::current(); });
+  worker.join();
+  EXPECT_NE(mainArena, workerArena);
+}
+
+TEST(FrameArenaTest, JobScopeDefersRewindUntilTheJobEnds) {
+  FrameArenas::advance();
+  FrameArena* pinned = nullptr;
+  {
+    FrameArenas::JobScope job;
+    pinned = &FrameArenas::current();
+    auto* value = static_cast<int*>(pinned->allocate(sizeof(int), alignof(int)));
+    *value = 7;
+
+    FrameArenas::advance();
+    FrameArenas::advance();
+    FrameArenas::advance();
+    EXPECT_EQ(&FrameArenas::current(), pinned);
+    EXPECT_EQ(*value, 7);
+  }
+
+  // The job's memory counts as allocated in the frame it ended
+  EXPECT_EQ(&FrameArenas::current(), pinned);
+  FrameArenas::advance();
+  EXPECT_NE(&FrameArenas::current(), pinned);
+  EXPECT_GT(pinned->used(), 0u);
+  FrameArenas::advance();
+  EXPECT_EQ(&FrameArenas::current(), pinned);
+  EXPECT_EQ(pinned->used(), 0u);
+}
+
+TEST(FrameArenaTest, ThreadPoolTasksKeepTheirArena) {
+  Utils::ThreadPoolExecutor pool(1);
+  std::atomic<bool> advanced{false};
+  auto task = pool.submit([&advanced] {
+    auto* arena = &FrameArenas::current();
+    auto* value = static_cast<int*>(arena->allocate(sizeof(int), alignof(int)));
+    *value = 11;
+    while (!advanced.load())
+      std::this_thread::yield();
+    return &FrameArenas::current() == arena && *value == 11 && arena->used() > 0;
+  });
+
+  FrameArenas::advance();
+  FrameArenas::advance();
+  advanced = true;
+  EXPECT_TRUE(task.get());
+}
+
+TEST(FrameArenaTest, ResourceIsOptIn) {
+  // Without a frame loop nothing would ever rewind the arenas
+  ASSERT_FALSE(FrameArenas::isEnabled());
+  EXPECT_EQ(FrameArenas::resource(), std::pmr::get_default_resource());
+
+  FrameArenas::setEnabled(true);
+  FrameArenas::advance();
+  EXPECT_EQ(FrameArenas::resource(), &FrameArenas::current());
+  FrameArenas::setEnabled(false);
+  EXPECT_EQ(FrameArenas::resource(), std::pmr::get_default_resource());
+}
@@ -0,0 +1,59 @@
+#include "fabric/utils/MappedFile.hh"
+#include "fabric/utils/ErrorHandling.hh"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+std::string writeFile(const std::string& name, const std::vector<uint8_t>& bytes) {
+    auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return path;
+}
+
+} // namespace
+
+TEST(MappedFileTest, MapsWholeFile) {
+    std::vector<uint8_t> bytes(10000);
+    for (size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<uint8_t>(i * 7);
+    auto path = writeFile("fabric_mapped_file.bin", bytes);
+
+    auto file = MappedFile::open(path);
+    ASSERT_TRUE(file);
+    ASSERT_EQ(file.size(), bytes.size());
+    EXPECT_EQ(std::memcmp(file.data(), bytes.data(), bytes.size()), 0);
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, MoveTransfersMapping) {
+    auto path = writeFile("fabric_mapped_file_move.bin", {1, 2, 3, 4});
+
+    auto file = MappedFile::open(path);
+    MappedFile moved(std::move(file));
+    EXPECT_FALSE(file);
+    ASSERT_TRUE(moved);
+    EXPECT_EQ(moved.bytes()[3], 4);
+
+    MappedFile assigned;
+    assigned = std::move(moved);
+    EXPECT_FALSE(moved);
+    EXPECT_EQ(assigned.size(), 4u);
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, MissingOrEmptyFileThrows) {
+    EXPECT_THROW(MappedFile::open("/nonexistent/fabric_mapped_file.bin"), FabricException);
+
+    auto path = writeFile("fabric_mapped_file_empty.bin", {});
+    EXPECT_THROW(MappedFile::open(path), FabricException);
+    std::filesystem::remove(path);
+}
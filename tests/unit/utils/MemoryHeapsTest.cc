@@ -0,0 +1,135 @@
+#include "fabric/utils/MemoryHeaps.hh"
+#include "fabric/core/ChunkedGrid.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include "fabric/utils/FrameArena.hh"
+#include "fabric/utils/Metrics.hh"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+TEST(MemoryHeapsTest, EachSubsystemHasItsOwnResource) {
+  EXPECT_NE(MemoryHeaps::resource(MemoryHeap::ChunkStorage), MemoryHeaps::resource(MemoryHeap::Mesh));
+  EXPECT_NE(MemoryHeaps::resource(MemoryHeap::Resources), MemoryHeaps::resource(MemoryHeap::Temp));
+  EXPECT_STREQ(MemoryHeaps::name(MemoryHeap::ChunkStorage), "chunk_storage");
+  EXPECT_STREQ(MemoryHeaps::name(MemoryHeap::Temp), "temp");
+}
+
+TEST(MemoryHeapsTest, TracksUsedAndPeakBytes) {
+  auto before = MemoryHeaps::stats(MemoryHeap::Temp);
+  auto* resource = MemoryHeaps::resource(MemoryHeap::Temp);
+
+  void* a = resource->allocate(4096, 64);
+  void* b = resource->allocate(1024);
+  auto during = MemoryHeaps::stats(MemoryHeap::Temp);
+  EXPECT_EQ(during.usedBytes - before.usedBytes, 5120u);
+  EXPECT_EQ(during.allocations - before.allocations, 2u);
+  EXPECT_GE(during.committedBytes, during.usedBytes);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0u);
+
+  resource->deallocate(a, 4096, 64);
+  resource->deallocate(b, 1024);
+  auto after = MemoryHeaps::stats(MemoryHeap::Temp);
+  EXPECT_EQ(after.usedBytes, before.usedBytes);
+  EXPECT_GE(after.peakUsedBytes, before.usedBytes + 5120);
+}
+
+TEST(MemoryHeapsTest, PmrContainersDrawFromHeap) {
+  auto before = MemoryHeaps::stats(MemoryHeap::Mesh).usedBytes;
+  {
+    std::pmr::vector<uint32_t> indices(MemoryHeaps::resource(MemoryHeap::Mesh));
+    indices.resize(1000);
+    EXPECT_GE(MemoryHeaps::stats(MemoryHeap::Mesh).usedBytes - before, 1000 * sizeof(uint32_t));
+  }
+  EXPECT_EQ(MemoryHeaps::stats(MemoryHeap::Mesh).usedBytes, before);
+}
+
+TEST(MemoryHeapsTest, ChunkedGridDefaultsToChunkStorage) {
+  auto before = MemoryHeaps::stats(MemoryHeap::ChunkStorage).usedBytes;
+  ChunkedGrid<float> grid;
+  grid.set(0, 0, 0, 1.0f);
+  grid.set(40, 0, 0, 1.0f);
+  EXPECT_EQ(grid.resource(), MemoryHeaps::resource(MemoryHeap::ChunkStorage));
+  EXPECT_EQ(MemoryHeaps::stats(MemoryHeap::ChunkStorage).usedBytes - before, 2 * kChunkVolume * sizeof(float));
+
+  grid.removeChunk(1, 0, 0);
+  EXPECT_EQ(MemoryHeaps::stats(MemoryHeap::ChunkStorage).usedBytes - before, kChunkVolume * sizeof(float));
+}
+
+TEST(MemoryHeapsTest, ReleaseDropsAbandonedChunksAtOnce) {
+  ChunkedGrid<float> grid;
+  for (int x = 0; x < 4; ++x)
+    grid.set(x * kChunkSize, 0, 0, 1.0f);
+  EXPECT_GE(MemoryHeaps::stats(MemoryHeap::ChunkStorage).usedBytes, 4 * kChunkVolume * sizeof(float));
+
+  grid.abandonChunks();
+  EXPECT_EQ(grid.chunkCount(), 0u);
+  MemoryHeaps::release(MemoryHeap::ChunkStorage);
+
+  auto stats = MemoryHeaps::stats(MemoryHeap::ChunkStorage);
+  EXPECT_EQ(stats.usedBytes, 0u);
+  EXPECT_EQ(stats.peakUsedBytes, 0u);
+
+  // The heap stays usable after a release
+  grid.set(0, 0, 0, 2.0f);
+  EXPECT_FLOAT_EQ(grid.get(0, 0, 0), 2.0f);
+}
+
+TEST(MemoryHeapsTest, AllocationOffOwningThreadThrows) {
+  auto* resource = MemoryHeaps::resource(MemoryHeap::Temp);
+  void* block = resource->allocate(256);
+  bool threw = false;
+  std::thread worker([&] {
+    try {
+      static_cast<void>(resource->allocate(64));
+    } catch (const FabricException&) {
+      threw = true;
+    }
+    // Frees are allowed from any thread
+    resource->deallocate(block, 256);
+  });
+  worker.join();
+  EXPECT_TRUE(threw);
+}
+
+TEST(MemoryHeapsTest, WorkerFirstTouchLeavesMainThreadOwner) {
+  // The test main configures the heaps, so a worker touching them first
+  // (here through its frame arenas) can't take them over
+  ASSERT_TRUE(MemoryHeaps::configured());
+  bool workerOwns = true;
+  bool workerThrew = false;
+  std::thread worker([&] {
+    try {
+      auto* p = FrameArenas::resource()->allocate(256);
+      EXPECT_NE(p, nullptr);
+      workerOwns = MemoryHeaps::get(MemoryHeap::Temp).ownedByCurrentThread();
+    } catch (const FabricException&) {
+      workerThrew = true;
+    }
+  });
+  worker.join();
+  EXPECT_FALSE(workerThrew);
+  EXPECT_FALSE(workerOwns);
+
+  EXPECT_TRUE(MemoryHeaps::get(MemoryHeap::Temp).ownedByCurrentThread());
+  auto* resource = MemoryHeaps::resource(MemoryHeap::Temp);
+  void* block = resource->allocate(128);
+  resource->deallocate(block, 128);
+}
+
+TEST(MemoryHeapsTest, ConfigureAfterCreationThrows) {
+  MemoryHeaps::resource(MemoryHeap::Temp);
+  EXPECT_THROW(MemoryHeaps::configure({}), FabricException);
+}
+
+TEST(MemoryHeapsTest, RegisterMetricsPublishesPerHeapGauges) {
+  MetricsRegistry registry;
+  MemoryHeaps::registerMetrics(registry);
+  auto text = registry.renderPrometheus();
+  EXPECT_NE(text.find("fabric_heap_chunk_storage_used_bytes"), std::string::npos);
+  EXPECT_NE(text.find("fabric_heap_mesh_committed_bytes"), std::string::npos);
+  EXPECT_NE(text.find("fabric_heap_temp_peak_bytes"), std::string::npos);
+}
@@ -0,0 +1,114 @@
+#include "fabric/utils/Metrics.hh"
+#include "fabric/utils/ErrorHandling.hh"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+TEST(MetricsTest, CounterSumsAcrossThreads) {
+  Counter counter;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&counter] {
+      for (int i = 0; i < 10000; ++i) {
+        counter.add();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.value(), 80000u);
+}
+
+TEST(MetricsTest, GaugeSetAndAdd) {
+  Gauge gauge;
+  gauge.set(2.5);
+  gauge.add(1.5);
+  gauge.add(-1.0);
+  EXPECT_DOUBLE_EQ(gauge.value(), 3.0);
+}
+
+TEST(MetricsTest, HistogramBucketsAreContiguous) {
+  for (size_t i = 0; i + 1 < 200; ++i) {
+    EXPECT_EQ(Histogram::bucketUpperBound(i) + 1, Histogram::bucketLowerBound(i + 1)) << "bucket " << i;
+  }
+  for (uint64_t v : {0ull, 1ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, ~0ull}) {
+    size_t idx = Histogram::bucketIndex(v);
+    ASSERT_LT(idx, Histogram::kBucketCount);
+    EXPECT_LE(Histogram::bucketLowerBound(idx), v);
+    EXPECT_GE(Histogram::bucketUpperBound(idx), v);
+  }
+}
+
+TEST(MetricsTest, HistogramSmallValuesAreExact) {
+  Histogram h;
+  for (uint64_t v = 1; v <= 10; ++v) {
+    h.record(v);
+  }
+  EXPECT_EQ(h.count(), 10u);
+  EXPECT_EQ(h.sum(), 55u);
+  EXPECT_EQ(h.max(), 10u);
+  EXPECT_EQ(h.percentile(0.5), 5u);
+  EXPECT_EQ(h.percentile(1.0), 10u);
+}
+
+TEST(MetricsTest, HistogramPercentileWithinRelativeError) {
+  Histogram h;
+  for (uint64_t v = 1; v <= 100000; ++v) {
+    h.record(v * 1000);
+  }
+  double p99 = static_cast<double>(h.percentile(0.99));
+  EXPECT_NEAR(p99, 99000000.0, 99000000.0 / Histogram::kSubBuckets);
+  EXPECT_EQ(h.percentile(0.0), h.percentile(0.000001));
+}
+
+TEST(MetricsTest, RegistryReturnsStableReferences) {
+  MetricsRegistry registry;
+  auto& a = registry.counter("fabric_test_total", "help");
+  auto& b = registry.counter("fabric_test_total");
+  EXPECT_EQ(&a, &b);
+  EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST(MetricsTest, RegistryRejectsTypeMismatch) {
+  MetricsRegistry registry;
+  registry.counter("fabric_test_metric");
+  EXPECT_THROW(registry.gauge("fabric_test_metric"), FabricException);
+}
+
+TEST(MetricsTest, RegistryRejectsInvalidNames) {
+  MetricsRegistry registry;
+  EXPECT_THROW(registry.counter("1bad"), FabricException);
+  EXPECT_THROW(registry.counter("has-dash"), FabricException);
+  EXPECT_TRUE(MetricsRegistry::isValidName("fabric:ok_name1"));
+}
+
+TEST(MetricsTest, RemoveDropsMetric) {
+  MetricsRegistry registry;
+  registry.gauge("fabric_test_gauge");
+  EXPECT_TRUE(registry.contains("fabric_test_gauge"));
+  registry.remove("fabric_test_gauge");
+  EXPECT_FALSE(registry.contains("fabric_test_gauge"));
+}
+
+TEST(MetricsTest, RendersPrometheusText) {
+  MetricsRegistry registry;
+  registry.counter("fabric_events_total", "Events seen").add(3);
+  registry.gauge("fabric_queue_depth").set(7);
+  registry.gaugeCallback("fabric_dirty", "Dirty chunks", [] { return 4.0; });
+  auto& h = registry.histogram("fabric_tick_seconds", "Tick time", 1e-9);
+  h.record(2097152);
+
+  auto text = registry.renderPrometheus();
+  EXPECT_NE(text.find("# HELP fabric_events_total Events seen\n"), std::string::npos);
+  EXPECT_NE(text.find("# TYPE fabric_events_total counter\nfabric_events_total 3\n"), std::string::npos);
+  EXPECT_NE(text.find("# TYPE fabric_queue_depth gauge\nfabric_queue_depth 7\n"), std::string::npos);
+  EXPECT_NE(text.find("fabric_dirty 4\n"), std::string::npos);
+  EXPECT_NE(text.find("# TYPE fabric_tick_seconds summary\n"), std::string::npos);
+  EXPECT_NE(text.find("fabric_tick_seconds{quantile=\"0.99\"} 0.002097152\n"), std::string::npos);
+  EXPECT_NE(text.find("fabric_tick_seconds_count 1\n"), std::string::npos);
+}
@@ -0,0 +1,118 @@
+#include "fabric/utils/TaskGraph.hh"
+#include "fabric/utils/ThreadPoolExecutor.hh"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace fabric;
+
+namespace {
+
+// 0 -> 2, 1 -> 2, 2 -> 3
+TaskGraph diamond() {
+  TaskGraph graph;
+  graph.dependents = {{2}, {2}, {3}, {}};
+  graph.dependencyCounts = {0, 0, 2, 1};
+  return graph;
+}
+
+size_t positionOf(const std::vector<size_t>& order, size_t task) {
+  return static_cast<size_t>(std::find(order.begin(), order.end(), task) - order.begin());
+}
+
+} // namespace
+
+TEST(TaskGraphTest, RunsInDependencyOrderOnCallingThread) {
+  auto graph = diamond();
+  std::vector<size_t> ran;
+  graph.run = [&](size_t i) {
+    ran.push_back(i);
+    return true;
+  };
+
+  auto order = runTaskGraph(graph, nullptr);
+  EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3}));
+  EXPECT_EQ(ran, order);
+}
+
+TEST(TaskGraphTest, FailureSkipsDependents) {
+  auto graph = diamond();
+  graph.blocked = {false, true, false, false};
+  std::vector<size_t> ran;
+  std::vector<size_t> skipped;
+  graph.run = [&](size_t i) {
+    ran.push_back(i);
+    return true;
+  };
+  graph.skip = [&](size_t i) { skipped.push_back(i); };
+
+  auto order = runTaskGraph(graph, nullptr);
+  EXPECT_EQ(order.size(), 4u);
+  EXPECT_EQ(ran, (std::vector<size_t>{0}));
+  EXPECT_EQ(skipped, (std::vector<size_t>{1, 2, 3}));
+
+  graph.blocked.clear();
+  ran.clear();
+  skipped.clear();
+  graph.run = [&](size_t i) {
+    ran.push_back(i);
+    return i != 0;
+  };
+  runTaskGraph(graph, nullptr);
+  EXPECT_EQ(ran, (std::vector<size_t>{0, 1}));
+  EXPECT_EQ(skipped, (std::vector<size_t>{2, 3}));
+}
+
+TEST(TaskGraphTest, CallingThreadTasksStayOnCaller) {
+  auto graph = diamond();
+  Utils::ThreadPoolExecutor pool(2);
+  const auto caller = std::this_thread::get_id();
+  std::mutex mutex;
+  std::vector<std::thread::id> threads(4);
+  graph.run = [&](size_t i) {
+    std::lock_guard<std::mutex> lock(mutex);
+    threads[i] = std::this_thread::get_id();
+    return true;
+  };
+  graph.onCallingThread = [](size_t i) { return i == 2; };
+
+  auto order = runTaskGraph(graph, &pool);
+  ASSERT_EQ(order.size(), 4u);
+  EXPECT_LT(positionOf(order, 0), positionOf(order, 2));
+  EXPECT_LT(positionOf(order, 1), positionOf(order, 2));
+  EXPECT_LT(positionOf(order, 2), positionOf(order, 3));
+  EXPECT_EQ(threads[2], caller);
+  EXPECT_NE(threads[3], caller);
+}
+
+TEST(TaskGraphTest, ParallelForRunsEveryIndexOnce) {
+  Utils::ThreadPoolExecutor pool(3);
+  std::vector<std::atomic<int>> hits(100);
+  parallelFor(hits.size(), &pool, [&](size_t i) { hits[i].fetch_add(1); });
+  for (const auto& hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+
+  std::vector<int> serial(5, 0);
+  parallelFor(serial.size(), nullptr, [&](size_t i) { serial[i] = static_cast<int>(i); });
+  EXPECT_EQ(serial, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(TaskGraphTest, ParallelForRethrowsAfterHelpersFinish) {
+  Utils::ThreadPoolExecutor pool(2);
+  std::atomic<int> ran{0};
+  EXPECT_THROW(parallelFor(64, &pool,
+                           [&](size_t i) {
+                             ran.fetch_add(1);
+                             if (i == 3) {
+                               throw std::runtime_error("boom");
+                             }
+                           }),
+               std::runtime_error);
+  EXPECT_GE(ran.load(), 4);
+  EXPECT_LE(ran.load(), 64);
+}